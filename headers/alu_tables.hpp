@@ -0,0 +1,58 @@
+#pragma once
+
+#include "int_types.hpp"
+
+#include <array>
+#include <cstddef>
+
+namespace emulator
+{
+    /*
+        Lookup tables for the arithmetic and logic instructions of the intel 8080.
+
+        The tables are generated at compile time (see alu_tables.cpp). Flags are stored in the same format 
+        as CpuState::packFlags, that is the format in which the PUSH PSW instruction stores them.
+    */
+    namespace alu
+    {
+        // Masks of the individual state flags in the packed flags format.
+        constexpr byte signFlag = 0x80;
+        constexpr byte zeroFlag = 0x40;
+        constexpr byte auxiliaryCarryFlag = 0x10;
+        constexpr byte parityFlag = 0x04;
+        constexpr byte carryFlag = 0x01;
+
+        // Zero, sign and parity flags corresponding to a result, indexed by the result.
+        extern const std::array<byte, 0x100> zspFlags;
+
+        // Flags set by adding an operand and a carry to the accumulator (ADD, ADC, ADI and ACI)
+        // and by subtracting an operand and a borrow from the accumulator (SUB, SBB, SUI, SBI, CMP and CPI).
+        // Indexed by arithmeticIndex(accumulator, operand, carry).
+        extern const std::array<byte, 0x20000> addFlags;
+        extern const std::array<byte, 0x20000> subtractFlags;
+
+        // Flags set by the INR and DCR instructions, indexed by the value before the instruction.
+        // These instructions do not affect the carry flag, hence it is never set in these tables.
+        extern const std::array<byte, 0x100> incrementFlags;
+        extern const std::array<byte, 0x100> decrementFlags;
+
+        struct DecimalAdjustment
+        {
+            byte result;
+            byte flags;
+        };
+
+        // Accumulator and flags after the DAA instruction, indexed by decimalAdjustIndex(accumulator, CY, CA).
+        extern const std::array<DecimalAdjustment, 0x400> decimalAdjustments;
+
+        inline std::size_t arithmeticIndex(byte accumulator, byte operand, byte carry)
+        {
+            return (static_cast<std::size_t>(carry) << 16) | (static_cast<std::size_t>(accumulator) << 8) | operand;
+        }
+
+        inline std::size_t decimalAdjustIndex(byte accumulator, byte carry, byte auxiliaryCarry)
+        {
+            return (static_cast<std::size_t>(auxiliaryCarry) << 9) | (static_cast<std::size_t>(carry) << 8) | accumulator;
+        }
+    } // namespace alu
+} // namespace emulator
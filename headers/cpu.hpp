@@ -2,13 +2,23 @@
 
 #include "int_types.hpp"
 #include "cpu_state.hpp"
+#include "cpu_policies.hpp"
+#include "defines.hpp"
+#include "predecode_cache.hpp"
+
+#include <memory>
 
 namespace emulator
 {
-    class Memory;
     class IO;
-
-    class Cpu
+    class OpcodeProfiler;
+
+    /*
+        Base class of the intel 8080 emulation. Holds the cpu state and the instruction and machine cycle
+        counters, which do not depend on how the cpu accesses memory and io.
+        See BasicCpu for the implementation of the instructions.
+    */
+    class CpuBase
     {
         public:
             /*
@@ -26,9 +36,30 @@ namespace emulator
                 RST6 = 48,
                 RST7 = 56
             };
-            
+
+            /*
+                Methods by which Cpu::run dispatches instructions.
+                Switch: executes every instruction through Cpu::executeInstructionCycle.
+                Threaded: jumps directly from the implementation of one instruction to the next
+                (requires EMULATOR_THREADED_DISPATCH, otherwise Switch is used).
+                Predecoded: as Threaded, but takes the opcodes and operands from a PredecodeCache
+                instead of reading them from memory (requires EMULATOR_THREADED_DISPATCH, otherwise Switch is used).
+                Also skips the iterations of idle loops (see PredecodeCache::findIdleLoop) while the
+                cpu polls memory which only an interrupt can change. The cache holds an entry for every
+                address, 512KB which the cpu allocates on the heap when it first runs with this method.
+                Fused: as Predecoded, but executes the sequences of instructions in superinstructions.hpp
+                as superinstructions (requires EMULATOR_THREADED_DISPATCH, otherwise Switch is used).
+            */
+            enum class DispatchMethod
+            {
+                Switch,
+                Threaded,
+                Predecoded,
+                Fused
+            };
+
         public:
-            explicit Cpu(Memory&, IO&);
+            virtual ~CpuBase() {}
 
             // Resets the cpu state and instruction and machine cycle counters.
             void reset();
@@ -36,7 +67,14 @@ namespace emulator
             // Execute the instruction pointed at by the program counter.
             // Returns the number of machine cycles needed to execute the command.
             // If cpu is in halted state, does nothing and returns 0.
-            std::size_t executeInstructionCycle();
+            virtual std::size_t executeInstructionCycle() = 0;
+
+            // Execute instructions until at least the given number of machine cycles has been executed
+            // or the cpu is halted. A derived class may also return early, e.g. at a breakpoint.
+            // This is the entry point by which a machine should run the cpu: it passes the number
+            // of machine cycles until its next scheduled event (such as an interrupt) as budget.
+            // Returns the number of machine cycles executed.
+            virtual std::size_t run(std::size_t machineCycles) = 0;
 
             // Execute instructions until a halted state is reached.
             // Caution: If memory is loaded with a program that does not reach an halted state
@@ -44,61 +82,161 @@ namespace emulator
             // Returns the number of machine cycles executed.
             std::size_t executeUntilHalt();
 
-            const Memory& getMemory() const { return memory; }
             const CpuState& getState() const { return state; }
 
             const std::size_t getExecutedInstructionCyles() const { return executedInstructionCycles; }
             const std::size_t getExecutedMachineCyles() const { return executedMachineCycles; }
 
+            // Restores the cpu state and the instruction and machine cycle counters, e.g. from a SaveState.
+            void setState(const CpuState& state_, std::size_t executedInstructionCycles_, std::size_t executedMachineCycles_)
+            {
+                state = state_;
+                executedInstructionCycles = executedInstructionCycles_;
+                executedMachineCycles = executedMachineCycles_;
+            }
+
             // Emulates the the response of the intel 8080 when the INTERRUPT input is set to high
             // and a RSTn instruction is put on the data bus.
             // Caution: Does not completely accurately mimick the intel 8080.
             // Namely, the RSTn instruction is immediately executed when this method is callled.
             // Rather than waiting for the appropriate number of machine cycles.
             // Returns the number of machine cycles needed to execute the command.
-            std::size_t issueRSTInterrupt(byte address);
+            virtual std::size_t issueRSTInterrupt(byte address) = 0;
 
             std::size_t issueRSTInterrupt(RestartInstructions instruction)
             {
                 return issueRSTInterrupt(static_cast<byte>(instruction));
             }
 
-            void halt() { state.halted = true; } 
+            void halt() { state.halted = true; }
             void resume() { state.halted = false; }
             void setProgramCounter(word address) { state.PC = address; }
 
+            DispatchMethod getDispatchMethod() const { return dispatchMethod; }
+            void setDispatchMethod(DispatchMethod method) { dispatchMethod = method; }
+
+            // Records every instruction which run executes in the given profiler, or none if it is nullptr.
+            // The profiler is not owned by the cpu.
+            void setProfiler(OpcodeProfiler* profiler_) { profiler = profiler_; }
+
         protected:
-            Memory& memory;
-            IO& io;
+            // A halted cpu with interrupts enabled waits for the machine to issue an interrupt, at the end
+            // of the budget of run at the latest. Instead of executing nothing for the rest of the budget,
+            // run advances the machine cycle counter straight to its end (targetMachineCycles).
+            void skipHaltedMachineCycles(std::size_t targetMachineCycles)
+            {
+                if (state.halted && state.interruptsEnabled && executedMachineCycles < targetMachineCycles)
+                    executedMachineCycles = targetMachineCycles;
+            }
+
             CpuState state;
 
             std::size_t executedInstructionCycles = 0;
             std::size_t executedMachineCycles = 0;
 
+            DispatchMethod dispatchMethod = DispatchMethod::Threaded;
+
+            OpcodeProfiler* profiler = nullptr;
+    };
+
+    /*
+        Emulation of the intel 8080 processor.
+
+        The template parameters determine how the cpu accesses the rest of the system, such that a machine
+        can instantiate a core in which every memory and io access is inlined:
+            MemoryPolicy: class providing get, set, getWord and setWord templated on whether the bounds
+                of the address are checked (see Memory). The predecoded dispatch method also requires
+                the page watching of Memory.
+            IOPolicy: class providing get and set for the IN and OUT instructions (see IO).
+                If this is a final class the calls are not virtual.
+            CheckPolicy: class determining which runtime checks are performed (see cpu_policies.hpp).
+
+        The members are defined in cpu_impl.hpp, which should only be included by the source file
+        that explicitly instantiates a particular cpu.
+    */
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    class BasicCpu : public CpuBase
+    {
+        public:
+            explicit BasicCpu(MemoryPolicy&, IOPolicy&);
+
+            std::size_t executeInstructionCycle() override;
+            std::size_t run(std::size_t machineCycles) override;
+
+            // Execute instructions like run, but also return as soon as predicate(getState()) is true
+            // after an instruction. The predicate is not checked before the first instruction,
+            // so a run which stopped at an address can be continued from that address.
+            // The predicate is called after every instruction, so it should be cheap and inlinable.
+            // Returns the number of machine cycles executed.
+            template <class Predicate>
+            std::size_t runUntil(std::size_t machineCycles, Predicate predicate);
+
+            using CpuBase::issueRSTInterrupt;
+            std::size_t issueRSTInterrupt(byte address) override;
+
+            const MemoryPolicy& getMemory() const { return memory; }
+
+        protected:
+            MemoryPolicy& memory;
+            IOPolicy& io;
+
         private:
-            // Sets the zero, sign and parity flags depending on the state of register A.
-            void setZSPFlags(byte result);
+            // The predicate of run, which never stops the cpu. Only with this predicate the cpu skips
+            // idle loops, since any other may have to see every instruction.
+            struct NeverStop
+            {
+                bool operator()(const CpuState&) const { return false; }
+            };
+
+            #if EMULATOR_THREADED_DISPATCH
+                // If predecoded is set, the instructions are fetched from predecodeCache.
+                template <bool predecoded, class Predicate>
+                std::size_t runThreaded(std::size_t machineCycles, Predicate& predicate);
+            #endif
+
+            // Throws an EmulatorException if the check policy checks for invalid opcodes.
+            void checkUndocumentedOpcode(byte opCode);
 
-            void executeINR(byte& reg);
-            void executeDCR(byte& reg);
+            // Memory accesses, with or without bounds checking depending on the check policy.
+            byte readMemory(word address) const;
+            word readMemoryWord(word address) const;
+            void writeMemory(word address, byte value);
+            void writeMemoryWord(word address, word value);
 
-            void executeDAD(word value);
+            // The helpers below operate on the state they are given, which is either the member state
+            // or the local copy of runThreaded. The machine cycles of an instruction are counted by the
+            // instruction itself, except for the conditional instructions of which the helper returns them.
 
-            void executeADD(byte value, byte carry = 0);
-            void executeSUB(byte value, byte carry = 0);
-            void executeANA(byte value);
-            void executeORA(byte value);
-            void executeXRA(byte value);
-            void executeCMP(byte value);
+            static void executeINR(CpuState& state, byte& reg);
+            static void executeDCR(CpuState& state, byte& reg);
 
-            void executeDAA();
+            static void executeDAD(CpuState& state, word value);
 
-            void executeRET();
-            void executeConditionalRET(bool condition);
-            void executeConditionalJMP(bool condition);
-            void executeConditionalCALL(bool condition);
+            static void executeADD(CpuState& state, byte value, byte carry = 0);
+            static void executeSUB(CpuState& state, byte value, byte carry = 0);
+            static void executeANA(CpuState& state, byte value);
+            static void executeORA(CpuState& state, byte value);
+            static void executeXRA(CpuState& state, byte value);
+            static void executeCMP(CpuState& state, byte value);
 
-            void executeRST(byte address);
-            void setEnableInterrupts(bool enabled);
+            static void executeDAA(CpuState& state);
+
+            void executeRET(CpuState& state);
+            std::size_t executeConditionalRET(CpuState& state, bool condition);
+            void executeConditionalJMP(CpuState& state, bool condition, word target);
+            std::size_t executeConditionalCALL(CpuState& state, bool condition, word target);
+
+            void executeRST(CpuState& state, byte address);
+            static void setEnableInterrupts(CpuState& state, bool enabled);
+
+            // Created when the cpu first runs with the predecoded or fused dispatch method,
+            // and created again when it switches between these.
+            std::unique_ptr<PredecodeCache> predecodeCache;
     };
+
+    // The cpu which accesses memory and io through the generic Memory and IO classes
+    // and performs the checks configured in defines.hpp.
+    using Cpu = BasicCpu<Memory, IO, DefaultCheckPolicy>;
+
+    extern template class BasicCpu<Memory, IO, DefaultCheckPolicy>;
 } // namespace emulator
@@ -0,0 +1,507 @@
+#pragma once
+
+#include "cpu.hpp"
+
+#include "memory.hpp"
+#include "io.hpp"
+#include "emulator_exception.hpp"
+#include "to_hex_string.hpp"
+#include "alu_tables.hpp"
+#include "opcode_profiler.hpp"
+
+#include <type_traits>
+
+namespace emulator
+{
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::BasicCpu(MemoryPolicy& memory_, IOPolicy& io_): memory(memory_), io(io_)
+    {}
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    std::size_t BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeInstructionCycle()
+    {
+        if (state.halted)
+            return 0;
+
+        std::size_t previousExecutedMachineCycles = executedMachineCycles;
+
+        byte opCode = readMemory(state.PC);
+
+        // According to table on page 2-16 of i8080 manual the program counter is always first
+        // incremented by one. Then if an instruction consists of more bytes the program counter
+        // is increased further.
+        ++state.PC;
+
+        word address = 0;
+        word intermediate = 0;
+        byte data = 0;
+
+        #define INSTRUCTION(code) case code:
+        #define NEXT_INSTRUCTION break
+        #define HALT_INSTRUCTION break
+        #define IMMEDIATE_BYTE readMemory(state.PC)
+        #define IMMEDIATE_WORD readMemoryWord(state.PC)
+        #define STORE_MACHINE_CYCLES
+
+        switch (opCode)
+        {
+            #include "cpu_instructions.inl"
+        }
+
+        #undef INSTRUCTION
+        #undef NEXT_INSTRUCTION
+        #undef HALT_INSTRUCTION
+        #undef IMMEDIATE_BYTE
+        #undef IMMEDIATE_WORD
+        #undef STORE_MACHINE_CYCLES
+
+        ++executedInstructionCycles;
+
+        return executedMachineCycles - previousExecutedMachineCycles;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    std::size_t BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::run(std::size_t machineCycles)
+    {
+        std::size_t previousExecutedMachineCycles = executedMachineCycles;
+
+        // The predicate is called before every instruction but the first, which is recorded
+        // by the previous run (or missed by the first).
+        if (profiler != nullptr)
+        {
+            runUntil(machineCycles, [this](const CpuState& cpuState)
+            {
+                profiler->record(readMemory(cpuState.PC));
+                return false;
+            });
+        }
+        else
+            runUntil(machineCycles, NeverStop());
+
+        skipHaltedMachineCycles(previousExecutedMachineCycles + machineCycles);
+
+        return executedMachineCycles - previousExecutedMachineCycles;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    template <class Predicate>
+    std::size_t BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::runUntil(std::size_t machineCycles, Predicate predicate)
+    {
+        #if EMULATOR_THREADED_DISPATCH
+            if (dispatchMethod == DispatchMethod::Threaded)
+                return runThreaded<false>(machineCycles, predicate);
+
+            if (dispatchMethod == DispatchMethod::Predecoded || dispatchMethod == DispatchMethod::Fused)
+            {
+                bool fused = dispatchMethod == DispatchMethod::Fused;
+
+                if (!predecodeCache || predecodeCache->fusesSuperinstructions() != fused)
+                {
+                    predecodeCache.reset();
+                    predecodeCache = std::make_unique<PredecodeCache>(memory, fused);
+                }
+
+                return runThreaded<true>(machineCycles, predicate);
+            }
+        #endif
+
+        std::size_t previousExecutedMachineCycles = executedMachineCycles;
+        std::size_t targetMachineCycles = executedMachineCycles + machineCycles;
+
+        while (!state.halted && executedMachineCycles < targetMachineCycles)
+        {
+            BasicCpu::executeInstructionCycle();
+
+            if (predicate(static_cast<const CpuState&>(state)))
+                break;
+        }
+
+        return executedMachineCycles - previousExecutedMachineCycles;
+    }
+
+    #if EMULATOR_THREADED_DISPATCH
+        template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+        template <bool predecoded, class Predicate>
+        std::size_t BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::runThreaded(std::size_t machineCycles, Predicate& predicate)
+        {
+            // Every instruction jumps directly to the implementation of the next instruction
+            // through this table of label addresses, instead of returning to a single switch statement.
+            // This gives the branch predictor a separate indirect jump per instruction to learn from.
+            // The superinstructions follow the opcodes, in the order of Superinstruction, and finally
+            // the detection of idle loops.
+            #define OPCODE_ROW(high) \
+                &&opcode0x##high##0, &&opcode0x##high##1, &&opcode0x##high##2, &&opcode0x##high##3, \
+                &&opcode0x##high##4, &&opcode0x##high##5, &&opcode0x##high##6, &&opcode0x##high##7, \
+                &&opcode0x##high##8, &&opcode0x##high##9, &&opcode0x##high##A, &&opcode0x##high##B, \
+                &&opcode0x##high##C, &&opcode0x##high##D, &&opcode0x##high##E, &&opcode0x##high##F
+
+            static void* const dispatchTable[PredecodeCache::idleLoopDispatchIndex + 1] =
+            {
+                OPCODE_ROW(0), OPCODE_ROW(1), OPCODE_ROW(2), OPCODE_ROW(3),
+                OPCODE_ROW(4), OPCODE_ROW(5), OPCODE_ROW(6), OPCODE_ROW(7),
+                OPCODE_ROW(8), OPCODE_ROW(9), OPCODE_ROW(A), OPCODE_ROW(B),
+                OPCODE_ROW(C), OPCODE_ROW(D), OPCODE_ROW(E), OPCODE_ROW(F),
+                &&superinstructionDecrementJump, &&superinstructionAndJump,
+                &&superinstructionLoadAndJump, &&superinstructionLoadDecrementJump,
+                &&superinstructionCompareJump, &&superinstructionLoadIncrement,
+                &&superinstructionStoreIncrement, &&superinstructionCopyIncrement,
+                &&idleLoop
+            };
+
+            #undef OPCODE_ROW
+
+            if (this->state.halted)
+                return 0;
+
+            // The registers and counters are copied into locals, which shadow the members in cpu_instructions.inl.
+            // The compiler has to assume that every byte written to memory may alias a member,
+            // whereas locals of which the address does not escape can be kept in host registers for the whole batch.
+            CpuState state = this->state;
+            std::size_t executedMachineCycles = this->executedMachineCycles;
+            std::size_t executedInstructionCycles = this->executedInstructionCycles;
+
+            auto writeBack = [&]()
+            {
+                this->state = state;
+                this->executedMachineCycles = executedMachineCycles;
+                this->executedInstructionCycles = executedInstructionCycles;
+            };
+
+            const std::size_t previousExecutedMachineCycles = executedMachineCycles;
+            const std::size_t targetMachineCycles = executedMachineCycles + machineCycles;
+
+            byte opCode = 0;
+            word operand = 0;
+            word dispatchIndex = 0;
+            word address = 0;
+            word intermediate = 0;
+            byte data = 0;
+
+            PredecodeCache* cache = predecodeCache.get();
+
+            // The state at the start of an idle loop when the cpu last got there, with the counters and
+            // the invalidation count of the cache at that time (see idleLoop below).
+            bool idleLoopVisited = false;
+            CpuState idleLoopState;
+            std::size_t idleLoopInstructionCycles = 0;
+            std::size_t idleLoopMachineCycles = 0;
+            std::size_t idleLoopInvalidationCount = 0;
+
+            // See Cpu::executeInstructionCycle for the order in which the program counter is incremented.
+            // The decoded entry is copied, since the instruction may write to memory and thereby discard it.
+            #define FETCH() \
+                if constexpr (predecoded) \
+                { \
+                    const PredecodeCache::Entry& entry = cache->get<CheckPolicy::checkBounds>(state.PC); \
+                    opCode = entry.opCode; \
+                    operand = entry.operand; \
+                    dispatchIndex = entry.dispatchIndex; \
+                } \
+                else \
+                    dispatchIndex = opCode = readMemory(state.PC); \
+                ++state.PC
+            #define DISPATCH() \
+                FETCH(); \
+                goto *dispatchTable[dispatchIndex]
+
+            #define INSTRUCTION(code) opcode##code:
+            #define NEXT_INSTRUCTION \
+                ++executedInstructionCycles; \
+                if (executedMachineCycles >= targetMachineCycles || predicate(static_cast<const CpuState&>(state))) \
+                    goto finished; \
+                DISPATCH()
+            #define HALT_INSTRUCTION \
+                ++executedInstructionCycles; \
+                goto finished
+            #define SUPERINSTRUCTION(name, machineCycles) \
+                superinstruction##name: \
+                if (executedMachineCycles + (machineCycles) > targetMachineCycles) \
+                    goto *dispatchTable[opCode]
+            #define NEXT_IN_SEQUENCE(condition) \
+                ++executedInstructionCycles; \
+                if (predicate(static_cast<const CpuState&>(state))) \
+                    goto finished; \
+                opCode = readMemory(state.PC); \
+                if (!(condition)) \
+                { \
+                    DISPATCH(); \
+                } \
+                ++state.PC
+            #define IMMEDIATE_BYTE (predecoded ? static_cast<byte>(operand) : readMemory(state.PC))
+            #define IMMEDIATE_WORD (predecoded ? operand : readMemoryWord(state.PC))
+            #define STORE_MACHINE_CYCLES this->executedMachineCycles = executedMachineCycles
+
+            try
+            {
+                DISPATCH();
+
+                #include "cpu_instructions.inl"
+                #include "cpu_superinstructions.inl"
+
+            // Reached at the start of an idle loop, with the program counter past its first instruction.
+            // If the cpu gets back there in the same state after exactly the instructions of one iteration,
+            // without instructions being changed in between, that iteration ran the loop as it is in memory.
+            // Since it does not write memory, every following iteration runs the same way and ends in the
+            // same state, until an interrupt. The iterations which fit in the budget are skipped, by counting
+            // their instruction and machine cycles, such that the cpu stops after the same instruction.
+            idleLoop:
+                if constexpr (predecoded)
+                {
+                    if constexpr (std::is_same_v<Predicate, NeverStop>)
+                    {
+                        if (idleLoopVisited && state == idleLoopState &&
+                            cache->getInvalidationCount() == idleLoopInvalidationCount)
+                        {
+                            std::size_t loopInstructionCycles = executedInstructionCycles - idleLoopInstructionCycles;
+
+                            if (loopInstructionCycles == cache->findIdleLoop(state.PC - 1))
+                            {
+                                std::size_t loopMachineCycles = executedMachineCycles - idleLoopMachineCycles;
+                                std::size_t iterations = (targetMachineCycles - executedMachineCycles - 1) / loopMachineCycles;
+
+                                executedInstructionCycles += iterations * loopInstructionCycles;
+                                executedMachineCycles += iterations * loopMachineCycles;
+                            }
+                        }
+
+                        idleLoopVisited = true;
+                        idleLoopState = state;
+                        idleLoopInstructionCycles = executedInstructionCycles;
+                        idleLoopMachineCycles = executedMachineCycles;
+                        idleLoopInvalidationCount = cache->getInvalidationCount();
+                    }
+
+                    goto *dispatchTable[cache->get<CheckPolicy::checkBounds>(state.PC - 1).instructionIndex];
+                }
+                else
+                    goto finished;
+
+            finished:
+                writeBack();
+            }
+            catch (...)
+            {
+                // Leave the cpu in the state in which the error occurred, such that it can be inspected.
+                writeBack();
+                throw;
+            }
+
+            #undef FETCH
+            #undef DISPATCH
+            #undef SUPERINSTRUCTION
+            #undef NEXT_IN_SEQUENCE
+            #undef INSTRUCTION
+            #undef NEXT_INSTRUCTION
+            #undef HALT_INSTRUCTION
+            #undef IMMEDIATE_BYTE
+            #undef IMMEDIATE_WORD
+            #undef STORE_MACHINE_CYCLES
+
+            return executedMachineCycles - previousExecutedMachineCycles;
+        }
+    #endif
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    std::size_t BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::issueRSTInterrupt(byte address)
+    {
+        if constexpr (CheckPolicy::checkInvalidOpcodes)
+        {
+            if (address > 56 || (address % 8) != 0)
+                throw EmulatorException("Invalid address (0x" + toHexString(address) + ") supplied to for RST interrupt in Cpu::issueRSTInterrupt.");
+        }
+
+        if (state.interruptsEnabled)
+        {
+            executeRST(state, address);
+
+            // After an interrupt the processing is resumed and further interrupts are disabled.
+            // Any code handling an interrupt must call the EI instruction for it to receive 
+            // any more interrupts.
+            state.halted = false;
+            state.interruptsEnabled = false;
+
+            executedMachineCycles += 11;
+            return 11;
+        }
+        else
+            return 0;             
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeINR(CpuState& state, byte& reg)
+    {
+        // The carry flag is not set by the INR instruction. Even if the register overflows.
+        // The auxiliary flag is set however. See alu_tables.cpp.
+        state.setIncrementFlags(reg);
+        ++reg;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeDCR(CpuState& state, byte& reg)
+    {
+        // Also the DCR instruction does not set the carry (borrow) flag. The auxiliary flag is set.
+        state.setDecrementFlags(reg);
+        --reg;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeDAD(CpuState& state, word value)
+    {
+        state.setCY(value > (0xFFFF - state.getHL()));
+        state.setHL(state.getHL() + value);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeADD(CpuState& state, byte value, byte carry)
+    {
+        // The carry and auxiliary carry flags are computed by the table as described in alu_tables.cpp.
+        state.setAddFlags(state.A, value, carry);
+        state.A += value + carry;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeSUB(CpuState& state, byte value, byte carry)
+    {
+        // The carry flag is set when a borrow occurs.
+        // The auxiliary carry is computed using the 2's complement representation of value, see alu_tables.cpp.
+        state.setSubtractFlags(state.A, value, carry);
+        state.A -= value + carry;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeANA(CpuState& state, byte value)
+    {
+        byte auxiliaryCarry = ((state.A | value) & 0x08) << 1;
+        state.A &= value;
+        state.setLogicFlags(state.A, auxiliaryCarry);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeORA(CpuState& state, byte value)
+    {
+        state.A |= value;
+        state.setLogicFlags(state.A, 0);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeXRA(CpuState& state, byte value)
+    {
+        state.A ^= value;
+        state.setLogicFlags(state.A, 0);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeCMP(CpuState& state, byte value)
+    {
+        // In a intel 8080 the CMP command is performed by doing a SUB into a temporary register
+        // So all flags are set as if a subtraction was performed.
+        state.setSubtractFlags(state.A, value, 0);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeDAA(CpuState& state)
+    {
+        // The information given about the DAA instruction in the intel 8080 manual is
+        // not entirely correct. It suggests that the addition of 6 on the lower 4 bits
+        // and higher 4 bits is done separately. 
+        // However at http://www.righto.com/2013/08/reverse-engineering-8085s-decimal.html
+        // it is stated that the addition is done once with value 0x00, 0x06, 0x60 or 0x66.
+        // The resulting table is generated in alu_tables.cpp.
+        const alu::DecimalAdjustment& adjustment = 
+            alu::decimalAdjustments[alu::decimalAdjustIndex(state.A, state.getCY(), state.getCA())];
+
+        state.A = adjustment.result;
+        state.unpackFlags(adjustment.flags);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeRET(CpuState& state)
+    {
+        state.PC = readMemoryWord(state.SP);
+        state.SP += 2;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    std::size_t BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeConditionalRET(CpuState& state, bool condition)
+    {
+        if (condition)
+        {
+            executeRET(state);
+            return 11;
+        }
+        else
+            return 5;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeConditionalJMP(CpuState& state, bool condition, word target)
+    {
+        if (condition)
+            state.PC = target;
+        else
+            state.PC += 2;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    std::size_t BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeConditionalCALL(CpuState& state, bool condition, word target)
+    {
+        if (condition)
+        {
+            writeMemoryWord(state.SP - 2, state.PC + 2);
+            state.SP -= 2;
+            state.PC = target;
+
+            return 17;
+        }
+        else
+        {
+            state.PC += 2;
+            return 11;
+        }
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::executeRST(CpuState& state, byte address)
+    {
+        writeMemoryWord(state.SP - 2, state.PC);
+        state.SP -= 2;
+        state.PC = address;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::setEnableInterrupts(CpuState& state, bool enabled)
+    {
+        state.interruptsEnabled = enabled;
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::checkUndocumentedOpcode(byte opCode)
+    {
+        if constexpr (CheckPolicy::checkInvalidOpcodes)
+            throw EmulatorException("Invalid opcode (0x" + toHexString(opCode) + ") encountered in Cpu::executeInstructionCycle.");
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    byte BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::readMemory(word address) const
+    {
+        return memory.template get<CheckPolicy::checkBounds>(address);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    word BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::readMemoryWord(word address) const
+    {
+        return memory.template getWord<CheckPolicy::checkBounds>(address);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::writeMemory(word address, byte value)
+    {
+        memory.template set<CheckPolicy::checkBounds>(address, value);
+    }
+
+    template <class MemoryPolicy, class IOPolicy, class CheckPolicy>
+    void BasicCpu<MemoryPolicy, IOPolicy, CheckPolicy>::writeMemoryWord(word address, word value)
+    {
+        memory.template setWord<CheckPolicy::checkBounds>(address, value);
+    }
+} // namespace emulator
@@ -0,0 +1,986 @@
+/*
+    Implementation of every intel 8080 instruction, indexed by opcode.
+
+    This file is included by the instruction dispatchers in cpu_impl.hpp, which define the macros
+        INSTRUCTION(opCode)     Marks the start of the implementation of the given opcode.
+        NEXT_INSTRUCTION        Marks the end of an instruction, after which the next instruction is executed.
+        HALT_INSTRUCTION        Marks the end of an instruction after which the cpu is halted.
+        IMMEDIATE_BYTE          The byte following the opcode, which the program counter points at.
+        IMMEDIATE_WORD          The word following the opcode, which the program counter points at.
+        STORE_MACHINE_CYCLES    Stores the machine cycles executed so far in the member of the cpu, such that
+                                the io sees them (see CpuBase::getExecutedMachineCyles).
+    The immediate operands are either read from memory or taken from the predecode cache (see PredecodeCache).
+
+    The local variables opCode, address, intermediate and data are expected to be declared by the dispatcher.
+    The names state and executedMachineCycles refer either to the members of the cpu or to local copies
+    of them, which BasicCpu::runUntil keeps in registers while it runs.
+*/
+
+// NOP
+INSTRUCTION(0x00)
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// Undocumented opcodes which are treated as a NOP.
+// Only allowed if we do not check for invalid op codes.
+INSTRUCTION(0x10)
+INSTRUCTION(0x20)
+INSTRUCTION(0x30)
+INSTRUCTION(0x08)
+INSTRUCTION(0x18)
+INSTRUCTION(0x28)
+INSTRUCTION(0x38)
+    checkUndocumentedOpcode(opCode);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// LXI RP, Load register pair immediate
+// Note: the cpu is little endian, so the high byte (B, D or H) is after
+// the low byte (C, E or L) in memory. IMMEDIATE_WORD takes care of this.
+
+// BC
+INSTRUCTION(0x01)
+    state.setBC(IMMEDIATE_WORD);
+    state.PC += 2;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// DE
+INSTRUCTION(0x11)
+    state.setDE(IMMEDIATE_WORD);
+    state.PC += 2;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// HL
+INSTRUCTION(0x21)
+    state.setHL(IMMEDIATE_WORD);
+    state.PC += 2;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// SP
+INSTRUCTION(0x31)
+    state.SP = IMMEDIATE_WORD;
+    state.PC += 2;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// STAX, store accumulator indirect.
+// Store the contents of register A in memory with address stored in either BC or DE.
+
+// BC
+INSTRUCTION(0x02)
+    writeMemory(state.getBC(), state.A);
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// DE
+INSTRUCTION(0x12)
+    writeMemory(state.getDE(), state.A);
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// SHLD
+// Move content of HL into memory
+INSTRUCTION(0x22)
+    address = IMMEDIATE_WORD;
+    writeMemoryWord(address, state.getHL());
+    state.PC += 2;
+    executedMachineCycles += 16;
+    NEXT_INSTRUCTION;
+
+// STA
+// Move content of A into memory
+INSTRUCTION(0x32)
+    address = IMMEDIATE_WORD;
+    writeMemory(address, state.A);
+    state.PC += 2;
+    executedMachineCycles += 13;
+    NEXT_INSTRUCTION;
+
+// INX
+// Increment register pair by one. Note: no status flags are affected.
+
+// BC
+INSTRUCTION(0x03)
+    state.setBC(state.getBC() + 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// DE
+INSTRUCTION(0x13)
+    state.setDE(state.getDE() + 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// HL
+INSTRUCTION(0x23)
+    state.setHL(state.getHL() + 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// SP
+INSTRUCTION(0x33)
+    ++state.SP;
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// DCX
+// Descrease register pair by one. Note: no status flags are affected.
+
+// BC
+INSTRUCTION(0x0B)
+    state.setBC(state.getBC() - 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// DE
+INSTRUCTION(0x1B)
+    state.setDE(state.getDE() - 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// HL
+INSTRUCTION(0x2B)
+    state.setHL(state.getHL() - 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// SP
+INSTRUCTION(0x3B)
+    --state.SP;
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// INR, increase register by one
+// Note: the CY flag is not set
+
+// B
+INSTRUCTION(0x04)
+    executeINR(state, state.B);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// D
+INSTRUCTION(0x14)
+    executeINR(state, state.D);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// H
+INSTRUCTION(0x24)
+    executeINR(state, state.H);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// M
+INSTRUCTION(0x34)
+    address = state.getHL();
+    data = readMemory(address);
+    executeINR(state, data);
+    writeMemory(address, data);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// C
+INSTRUCTION(0x0C)
+    executeINR(state, state.C);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// E
+INSTRUCTION(0x1C)
+    executeINR(state, state.E);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// L
+INSTRUCTION(0x2C)
+    executeINR(state, state.L);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// A
+INSTRUCTION(0x3C)
+    executeINR(state, state.A);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// DCR, decrease register by 1
+// Note: the CY flag is not set
+
+// B
+INSTRUCTION(0x05)
+    executeDCR(state, state.B);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// D
+INSTRUCTION(0x15)
+    executeDCR(state, state.D);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// H
+INSTRUCTION(0x25)
+    executeDCR(state, state.H);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// M
+INSTRUCTION(0x35)
+    address = state.getHL();
+    data = readMemory(address);
+    executeDCR(state, data);
+    writeMemory(address, data);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// C
+INSTRUCTION(0x0D)
+    executeDCR(state, state.C);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// E
+INSTRUCTION(0x1D)
+    executeDCR(state, state.E);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// L
+INSTRUCTION(0x2D)
+    executeDCR(state, state.L);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// A
+INSTRUCTION(0x3D)
+    executeDCR(state, state.A);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// MVI
+// Move data to register or memory immediate
+
+// B
+INSTRUCTION(0x06)
+    state.B = IMMEDIATE_BYTE;
+    state.PC += 1;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// D
+INSTRUCTION(0x16)
+    state.D = IMMEDIATE_BYTE;
+    state.PC += 1;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// H
+INSTRUCTION(0x26)
+    state.H = IMMEDIATE_BYTE;
+    state.PC += 1;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// M
+INSTRUCTION(0x36)
+    writeMemory(state.getHL(), IMMEDIATE_BYTE);
+    state.PC += 1;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// C
+INSTRUCTION(0x0E)
+    state.C = IMMEDIATE_BYTE;
+    state.PC += 1;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// E
+INSTRUCTION(0x1E)
+    state.E = IMMEDIATE_BYTE;
+    state.PC += 1;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// L
+INSTRUCTION(0x2E)
+    state.L = IMMEDIATE_BYTE;
+    state.PC += 1;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// A
+INSTRUCTION(0x3E)
+    state.A = IMMEDIATE_BYTE;
+    state.PC += 1;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// RCL
+// bitwise rotate left
+INSTRUCTION(0x07)
+    state.setCY((state.A & 0x80) != 0);
+    state.A = (state.A << 1) | (state.A >> 7);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// RAL
+// bitwise rotate left through carry
+INSTRUCTION(0x17)
+    intermediate = (state.A & 0x80) >> 7;
+    state.A = (state.A << 1) | state.getCY();
+    state.setCY(intermediate);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// DAA
+// Decimal Adjust Accumulator
+INSTRUCTION(0x27)
+    executeDAA(state);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// STC
+// Set carry to 1
+INSTRUCTION(0x37)
+    state.setCY(true);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// DAD
+// Add register pair to HL
+
+// BC
+INSTRUCTION(0x09)
+    executeDAD(state, state.getBC());
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// DE
+INSTRUCTION(0x19)
+    executeDAD(state, state.getDE());
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// HL
+INSTRUCTION(0x29)
+    executeDAD(state, state.getHL());
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// SP
+INSTRUCTION(0x39)
+    executeDAD(state, state.SP);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// LDAX
+// Load accumulator from memory
+// Address stored in register
+
+// BC
+INSTRUCTION(0x0A)
+    state.A = readMemory(state.getBC());
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// DE
+INSTRUCTION(0x1A)
+    state.A = readMemory(state.getDE());
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// LHLD
+// Load HL from memory
+
+INSTRUCTION(0x2A)
+    address = IMMEDIATE_WORD;
+    state.setHL(readMemoryWord(address));
+    state.PC += 2;
+    executedMachineCycles += 16;
+    NEXT_INSTRUCTION;
+
+// LDA
+// Load accumulator from memory
+// address stored in instruction
+
+INSTRUCTION(0x3A)
+    address = IMMEDIATE_WORD;
+    state.A = readMemory(address);
+    state.PC += 2;
+    executedMachineCycles += 13;
+    NEXT_INSTRUCTION;
+
+// RRC
+// Rotate right
+
+INSTRUCTION(0x0F)
+    state.setCY((state.A & 0x01) != 0);
+    state.A = (state.A >> 1) | (state.A << 7);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// RAR
+// Rotate right through carry
+
+INSTRUCTION(0x1F)
+    intermediate = state.A & 0x01;
+    state.A = (state.A >> 1) | (state.getCY() << 7);
+    state.setCY(intermediate);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// CMA
+// Take bitwise complement of A register
+
+INSTRUCTION(0x2F)
+    state.A = ~state.A;
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// CMC
+// The carry flag is inverted
+
+INSTRUCTION(0x3F)
+    state.setCY(!state.getCY());
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// MOV
+// Move register/memory to register/memory
+// The registers are decoded from the opcode, which has the form 01DDDSSS, see CpuState::getRegister.
+
+INSTRUCTION(0x40) INSTRUCTION(0x41) INSTRUCTION(0x42) INSTRUCTION(0x43) INSTRUCTION(0x44) INSTRUCTION(0x45) INSTRUCTION(0x47) // to B
+INSTRUCTION(0x48) INSTRUCTION(0x49) INSTRUCTION(0x4A) INSTRUCTION(0x4B) INSTRUCTION(0x4C) INSTRUCTION(0x4D) INSTRUCTION(0x4F) // to C
+INSTRUCTION(0x50) INSTRUCTION(0x51) INSTRUCTION(0x52) INSTRUCTION(0x53) INSTRUCTION(0x54) INSTRUCTION(0x55) INSTRUCTION(0x57) // to D
+INSTRUCTION(0x58) INSTRUCTION(0x59) INSTRUCTION(0x5A) INSTRUCTION(0x5B) INSTRUCTION(0x5C) INSTRUCTION(0x5D) INSTRUCTION(0x5F) // to E
+INSTRUCTION(0x60) INSTRUCTION(0x61) INSTRUCTION(0x62) INSTRUCTION(0x63) INSTRUCTION(0x64) INSTRUCTION(0x65) INSTRUCTION(0x67) // to H
+INSTRUCTION(0x68) INSTRUCTION(0x69) INSTRUCTION(0x6A) INSTRUCTION(0x6B) INSTRUCTION(0x6C) INSTRUCTION(0x6D) INSTRUCTION(0x6F) // to L
+INSTRUCTION(0x78) INSTRUCTION(0x79) INSTRUCTION(0x7A) INSTRUCTION(0x7B) INSTRUCTION(0x7C) INSTRUCTION(0x7D) INSTRUCTION(0x7F) // to A
+    state.getRegister(opCode >> 3) = state.getRegister(opCode);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0x70) INSTRUCTION(0x71) INSTRUCTION(0x72) INSTRUCTION(0x73) INSTRUCTION(0x74) INSTRUCTION(0x75) INSTRUCTION(0x77) // to M
+    writeMemory(state.getHL(), state.getRegister(opCode));
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0x46) INSTRUCTION(0x4E) INSTRUCTION(0x56) INSTRUCTION(0x5E) INSTRUCTION(0x66) INSTRUCTION(0x6E) INSTRUCTION(0x7E) // M to
+    state.getRegister(opCode >> 3) = readMemory(state.getHL());
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0x76) // HLT
+    executedMachineCycles += 7;
+    state.halted = true;
+    HALT_INSTRUCTION;
+
+// ADD
+// Add value of specified register or memory to accumulator
+
+INSTRUCTION(0x80) INSTRUCTION(0x81) INSTRUCTION(0x82) INSTRUCTION(0x83) INSTRUCTION(0x84) INSTRUCTION(0x85) INSTRUCTION(0x87)
+    executeADD(state, state.getRegister(opCode));
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0x86) // M
+    executeADD(state, readMemory(state.getHL()));
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// SUB
+// Subtract value of specified register or memory from accumulator
+
+INSTRUCTION(0x90) INSTRUCTION(0x91) INSTRUCTION(0x92) INSTRUCTION(0x93) INSTRUCTION(0x94) INSTRUCTION(0x95) INSTRUCTION(0x97)
+    executeSUB(state, state.getRegister(opCode));
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0x96) // M
+    executeSUB(state, readMemory(state.getHL()));
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// ANA
+// Do a bitwise logical AND on the value of the accumulator and the specified register or memory.
+
+INSTRUCTION(0xA0) INSTRUCTION(0xA1) INSTRUCTION(0xA2) INSTRUCTION(0xA3) INSTRUCTION(0xA4) INSTRUCTION(0xA5) INSTRUCTION(0xA7)
+    executeANA(state, state.getRegister(opCode));
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0xA6) // M
+    executeANA(state, readMemory(state.getHL()));
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// ORA
+// Do a bitwise logical or on the value of the accumulator and specified register or memory.
+
+INSTRUCTION(0xB0) INSTRUCTION(0xB1) INSTRUCTION(0xB2) INSTRUCTION(0xB3) INSTRUCTION(0xB4) INSTRUCTION(0xB5) INSTRUCTION(0xB7)
+    executeORA(state, state.getRegister(opCode));
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0xB6) // M
+    executeORA(state, readMemory(state.getHL()));
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// ADC (Add with carry)
+// Add value of specified register or memory plus the carry bit to the contents of the accumulator
+
+INSTRUCTION(0x88) INSTRUCTION(0x89) INSTRUCTION(0x8A) INSTRUCTION(0x8B) INSTRUCTION(0x8C) INSTRUCTION(0x8D) INSTRUCTION(0x8F)
+    executeADD(state, state.getRegister(opCode), state.getCY());
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0x8E) // M
+    executeADD(state, readMemory(state.getHL()), state.getCY());
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// SBB (Subtract with borrow)
+// Subtract value of specified register or memory plus the carry bit from the contents of the accumulator
+
+INSTRUCTION(0x98) INSTRUCTION(0x99) INSTRUCTION(0x9A) INSTRUCTION(0x9B) INSTRUCTION(0x9C) INSTRUCTION(0x9D) INSTRUCTION(0x9F)
+    executeSUB(state, state.getRegister(opCode), state.getCY());
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0x9E) // M
+    executeSUB(state, readMemory(state.getHL()), state.getCY());
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// XRA
+// Perform a bitwise logical or with the value of the specified register or memory and the contents of the accumulator.
+
+INSTRUCTION(0xA8) INSTRUCTION(0xA9) INSTRUCTION(0xAA) INSTRUCTION(0xAB) INSTRUCTION(0xAC) INSTRUCTION(0xAD) INSTRUCTION(0xAF)
+    executeXRA(state, state.getRegister(opCode));
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0xAE) // M
+    executeXRA(state, readMemory(state.getHL()));
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// CMP
+// Compare value of specified register or memory with the value of the accumulator
+
+INSTRUCTION(0xB8) INSTRUCTION(0xB9) INSTRUCTION(0xBA) INSTRUCTION(0xBB) INSTRUCTION(0xBC) INSTRUCTION(0xBD) INSTRUCTION(0xBF)
+    executeCMP(state, state.getRegister(opCode));
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+INSTRUCTION(0xBE) // M
+    executeCMP(state, readMemory(state.getHL()));
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// RNZ
+// Return when zero flag is not set
+INSTRUCTION(0xC0)
+    executedMachineCycles += executeConditionalRET(state, !state.getZ());
+    NEXT_INSTRUCTION;
+
+// RNC
+// Return if the carry flag is not set
+INSTRUCTION(0xD0)
+    executedMachineCycles += executeConditionalRET(state, !state.getCY());
+    NEXT_INSTRUCTION;
+
+// RPO
+// Return if the parity flag is set to odd (=0)
+INSTRUCTION(0xE0)
+    executedMachineCycles += executeConditionalRET(state, !state.getP());
+    NEXT_INSTRUCTION;
+
+// RP
+// Return if sign flag is not set (plus)
+INSTRUCTION(0xF0)
+    executedMachineCycles += executeConditionalRET(state, !state.getS());
+    NEXT_INSTRUCTION;
+
+// RZ
+// Return if zero flag is set
+INSTRUCTION(0xC8)
+    executedMachineCycles += executeConditionalRET(state, state.getZ());
+    NEXT_INSTRUCTION;
+
+// RC
+// Return if carry flag is set
+INSTRUCTION(0xD8)
+    executedMachineCycles += executeConditionalRET(state, state.getCY());
+    NEXT_INSTRUCTION;
+
+// RPE
+// Return is parity flag is even (= 1)
+INSTRUCTION(0xE8)
+    executedMachineCycles += executeConditionalRET(state, state.getP());
+    NEXT_INSTRUCTION;
+
+// RM
+// Return is sign flag is set (minus)
+INSTRUCTION(0xF8)
+    executedMachineCycles += executeConditionalRET(state, state.getS());
+    NEXT_INSTRUCTION;
+
+// POP
+// Load register from stack
+
+// BC
+INSTRUCTION(0xC1)
+    state.setBC(readMemoryWord(state.SP));
+    state.SP += 2;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// DE
+INSTRUCTION(0xD1)
+    state.setDE(readMemoryWord(state.SP));
+    state.SP += 2;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// HL
+INSTRUCTION(0xE1)
+    state.setHL(readMemoryWord(state.SP));
+    state.SP += 2;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// POP PSW
+// Load accumulator and flag status from stack
+INSTRUCTION(0xF1)
+    state.unpackFlags(readMemory(state.SP));
+    state.A = readMemory(state.SP + 1);
+    state.SP += 2;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JNZ
+// Jump if zero flag is not set
+INSTRUCTION(0xC2)
+    executeConditionalJMP(state, !state.getZ(), IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JNC
+// Jump if carry flag is not set
+INSTRUCTION(0xD2)
+    executeConditionalJMP(state, !state.getCY(), IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JPO
+// Jump is parity flag is set to odd (= 0)
+INSTRUCTION(0xE2)
+    executeConditionalJMP(state, !state.getP(), IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JP
+// Jump if sign flag is not set (positive)
+INSTRUCTION(0xF2)
+    executeConditionalJMP(state, !state.getS(), IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JZ
+// Jump if zero flag is set
+INSTRUCTION(0xCA)
+    executeConditionalJMP(state, state.getZ(), IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JC
+// Jump if carry flag is set
+INSTRUCTION(0xDA)
+    executeConditionalJMP(state, state.getCY(), IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JPE
+// Jump is parity flag is even (= 1)
+INSTRUCTION(0xEA)
+    executeConditionalJMP(state, state.getP(), IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JM
+// Jump is sign flag is set (minus)
+INSTRUCTION(0xFA)
+    executeConditionalJMP(state, state.getS(), IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// JMP
+// Jump to memory address specified by intruction code
+INSTRUCTION(0xC3)
+    executeConditionalJMP(state, true, IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// Undocumented opcode which is treated as a JMP.
+INSTRUCTION(0xCB)
+    checkUndocumentedOpcode(opCode);
+    executeConditionalJMP(state, true, IMMEDIATE_WORD);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// OUT
+// Put data on the data bus
+INSTRUCTION(0xD3)
+    STORE_MACHINE_CYCLES;
+    io.set(IMMEDIATE_BYTE, state.A);
+    state.PC += 1;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// XTHL
+// Exchange register HL with top of the stack
+INSTRUCTION(0xE3)
+    intermediate = readMemoryWord(state.SP);
+    writeMemoryWord(state.SP, state.getHL());
+    state.setHL(intermediate);
+    executedMachineCycles += 18;
+    NEXT_INSTRUCTION;
+
+// DI
+// Disable interrupts
+INSTRUCTION(0xF3)
+    setEnableInterrupts(state, false);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// CNZ
+// Call if zero flag is not set
+INSTRUCTION(0xC4)
+    executedMachineCycles += executeConditionalCALL(state, !state.getZ(), IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// CNC
+// Call if carry flag is not set
+INSTRUCTION(0xD4)
+    executedMachineCycles += executeConditionalCALL(state, !state.getCY(), IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// CPO
+// Call is parity flag is set to odd (= 0)
+INSTRUCTION(0xE4)
+    executedMachineCycles += executeConditionalCALL(state, !state.getP(), IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// CP
+// Call if sign flag is not set (positive)
+INSTRUCTION(0xF4)
+    executedMachineCycles += executeConditionalCALL(state, !state.getS(), IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// CZ
+// Call if zero flag is set
+INSTRUCTION(0xCC)
+    executedMachineCycles += executeConditionalCALL(state, state.getZ(), IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// CC
+// Call if carry flag is set
+INSTRUCTION(0xDC)
+    executedMachineCycles += executeConditionalCALL(state, state.getCY(), IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// CPE
+// Call is parity flag is even (= 1)
+INSTRUCTION(0xEC)
+    executedMachineCycles += executeConditionalCALL(state, state.getP(), IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// CM
+// Call is sign flag is set (minus)
+INSTRUCTION(0xFC)
+    executedMachineCycles += executeConditionalCALL(state, state.getS(), IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// PUSH
+// Load register onto stack
+
+// BC
+INSTRUCTION(0xC5)
+    writeMemoryWord(state.SP - 2, state.getBC());
+    state.SP -= 2;
+    executedMachineCycles += 11;
+    NEXT_INSTRUCTION;
+
+// DE
+INSTRUCTION(0xD5)
+    writeMemoryWord(state.SP - 2, state.getDE());
+    state.SP -= 2;
+    executedMachineCycles += 11;
+    NEXT_INSTRUCTION;
+
+// HL
+INSTRUCTION(0xE5)
+    writeMemoryWord(state.SP - 2, state.getHL());
+    state.SP -= 2;
+    executedMachineCycles += 11;
+    NEXT_INSTRUCTION;
+
+// PUSH PSW
+// Load accumulator and flag status onto stack
+INSTRUCTION(0xF5)
+    writeMemory(state.SP - 1, state.A);
+    writeMemory(state.SP - 2, state.packFlags());
+    state.SP -= 2;
+    executedMachineCycles += 11;
+    NEXT_INSTRUCTION;
+
+// ADI
+// Add to accumulator immediate (value encoded in instruction).
+INSTRUCTION(0xC6)
+    executeADD(state, IMMEDIATE_BYTE);
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// SUI
+// Subtract from accumulator immediate (value encoded in instruction).
+INSTRUCTION(0xD6)
+    executeSUB(state, IMMEDIATE_BYTE);
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// ANI
+// Perform bitwise AND with accumulator and immediate (value encoded in instruction).
+INSTRUCTION(0xE6)
+    executeANA(state, IMMEDIATE_BYTE);
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// ORI
+// Perform bitwise OR with accumulator and immediate (value encoded in instruction).
+INSTRUCTION(0xF6)
+    executeORA(state, IMMEDIATE_BYTE);
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// RST (Restart)
+// Change PC to address defined by bits 3, 4, 5 of the instruction opcode
+INSTRUCTION(0xC7)
+INSTRUCTION(0xD7)
+INSTRUCTION(0xE7)
+INSTRUCTION(0xF7)
+INSTRUCTION(0xCF)
+INSTRUCTION(0xDF)
+INSTRUCTION(0xEF)
+INSTRUCTION(0xFF)
+    executeRST(state, opCode & 0b0011'1000);
+    executedMachineCycles += 11;
+    NEXT_INSTRUCTION;
+
+// RET
+// Return from subroutine
+INSTRUCTION(0xC9)
+    executeRET(state);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// Undocumented opcode which is treated as a RET.
+INSTRUCTION(0xD9)
+    checkUndocumentedOpcode(opCode);
+    executeRET(state);
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// PCHL
+// Jump to address specified by HL register
+INSTRUCTION(0xE9)
+    state.PC = state.getHL();
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// SPHL
+// Contents of HL register is moved in SP
+INSTRUCTION(0xF9)
+    state.SP = state.getHL();
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// IN
+// Get data on the data bus
+INSTRUCTION(0xDB)
+    STORE_MACHINE_CYCLES;
+    state.A = io.get(IMMEDIATE_BYTE);
+    state.PC += 1;
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// XCHG
+// Exchange HL with DE
+INSTRUCTION(0xEB)
+    std::swap(state.H, state.D);
+    std::swap(state.L, state.E);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// EI
+// Enable interrupts
+INSTRUCTION(0xFB)
+    setEnableInterrupts(state, true);
+    executedMachineCycles += 4;
+    NEXT_INSTRUCTION;
+
+// CALL
+// Call subroutine at memory address specified by instruction code
+INSTRUCTION(0xCD)
+    executedMachineCycles += executeConditionalCALL(state, true, IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// Undocumented opcodes which are treated as a CALL.
+INSTRUCTION(0xDD)
+INSTRUCTION(0xED)
+INSTRUCTION(0xFD)
+    checkUndocumentedOpcode(opCode);
+    executedMachineCycles += executeConditionalCALL(state, true, IMMEDIATE_WORD);
+    NEXT_INSTRUCTION;
+
+// ACI
+// Add to accumulator immediate with carry (value encoded in instruction).
+INSTRUCTION(0xCE)
+    executeADD(state, IMMEDIATE_BYTE, state.getCY());
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// SBI
+// Subtract from accumulator immediate with borrow (value encoded in instruction).
+INSTRUCTION(0xDE)
+    executeSUB(state, IMMEDIATE_BYTE, state.getCY());
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// XRI
+// Perform bitwise XOR with accumulator and immediate (value encoded in instruction).
+INSTRUCTION(0xEE)
+    executeXRA(state, IMMEDIATE_BYTE);
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
+
+// CPI
+// Perform comparison between accumulator and immediate (value encoded in instruction).
+INSTRUCTION(0xFE)
+    executeCMP(state, IMMEDIATE_BYTE);
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_INSTRUCTION;
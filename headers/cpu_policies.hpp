@@ -0,0 +1,34 @@
+#pragma once
+
+#include "defines.hpp"
+
+namespace emulator
+{
+    /*
+        Check policies for BasicCpu. Determine which runtime checks are performed by the cpu.
+            checkBounds: whether every memory access checks the address against the bounds of the memory
+                and whether writes to ROM are refused.
+            checkInvalidOpcodes: whether an EmulatorException is thrown when an unspecified opcode is encountered.
+    */
+
+    // Performs all checks. Meant for debugging.
+    struct CheckedPolicy
+    {
+        static constexpr bool checkBounds = true;
+        static constexpr bool checkInvalidOpcodes = true;
+    };
+
+    // Performs no checks at all. Meant for running well-behaved programs as fast as possible.
+    struct UncheckedPolicy
+    {
+        static constexpr bool checkBounds = false;
+        static constexpr bool checkInvalidOpcodes = false;
+    };
+
+    // Performs the checks configured in defines.hpp.
+    struct DefaultCheckPolicy
+    {
+        static constexpr bool checkBounds = EMULATOR_CHECK_BOUNDS;
+        static constexpr bool checkInvalidOpcodes = EMULATOR_CHECK_INVALID_OPCODES;
+    };
+} // namespace emulator
@@ -1,7 +1,11 @@
 #pragma once
 
+#include "alu_tables.hpp"
+#include "defines.hpp"
 #include "int_types.hpp"
 
+#include <type_traits>
+
 namespace emulator
 {
     /*
@@ -9,48 +13,144 @@ namespace emulator
         Stores the values of the 7 byte sized registers A, B, C, D, E, H, L,
         the values of the program counter (PC) and the stack pointer (SP),
         the halted state and interrupt state,
-        and finally the zero (Z), sign (S), parity (P), carry (CY) and auxiliary carry (CA) state flags.         
+        and finally the zero (Z), sign (S), parity (P), carry (CY) and auxiliary carry (CA) state flags.
+
+        The byte registers and the flags (F) share an array with the register pairs BC, DE and HL, which
+        are ordered such that the pairs are native words of the host and the array is indexed by the
+        3 bit register fields of the opcodes (see getRegister). The struct is trivially copyable.
+
+        The state flags are only accessible through getZ() etc. With EMULATOR_LAZY_FLAGS the arithmetic and
+        logic instructions do not compute the flags, but record their operation, operands and result
+        (see setAddFlags etc.). A flag is computed from this record when it is read, which for most results
+        never happens since the next instruction which sets the flags overwrites the record.
     */
     struct CpuState
     {
-        byte A = 0, B = 0, C = 0, D = 0, E = 0, H = 0, L = 0;
+        // The instruction which last set the state flags.
+        enum class FlagsOperation : byte
+        {
+            None,       // The flags are stored in F.
+            Add,        // ADD, ADC, ADI and ACI
+            Subtract,   // SUB, SBB, SUI, SBI, CMP and CPI
+            Increment,  // INR
+            Decrement,  // DCR
+            Logic       // ANA, ORA, XRA, ANI, ORI and XRI
+        };
 
-        word PC = 0, SP = 0;
+        // F holds the flags in the format of packFlags (without the bit that is always set),
+        // if flagsOperation is None.
+        union
+        {
+            byte registers[8] = {};
+            word registerPairs[4];
+
+            #if EMULATOR_LITTLE_ENDIAN
+                struct { byte C, B, E, D, L, H, A, F; };
+            #else
+                struct { byte B, C, D, E, H, L, F, A; };
+            #endif
+        };
 
-        byte Z : 1, S : 1, P : 1, CY : 1, CA : 1;
+        word PC = 0, SP = 0;
 
         bool halted = false;
         bool interruptsEnabled = false;
 
-        explicit CpuState(): Z(0), S(0), P(0), CY(0), CA(0) {}
+        FlagsOperation flagsOperation = FlagsOperation::None;
+
+        // Record of the last instruction which set the flags, if flagsOperation is not None.
+        // For Add and Subtract these are the accumulator, the operand and the carry (borrow) of the
+        // instruction, for Increment and Decrement flagsOperand is the value before the instruction
+        // and flagsCarry holds CY, which these instructions leave unchanged. For Logic, flagsCarry holds CA.
+        byte flagsAccumulator = 0, flagsOperand = 0, flagsCarry = 0, flagsResult = 0;
+
+        // Returns the register denoted by the lowest 3 bits of index, as encoded in the opcodes:
+        // B, C, D, E, H, L, F and A. Index 6 denotes the memory pointed at by HL in the opcodes,
+        // but the flags here.
+        byte& getRegister(byte index) { return registers[(index & 0x07) ^ registerIndexSwap]; }
+        byte getRegister(byte index) const { return registers[(index & 0x07) ^ registerIndexSwap]; }
 
         // Helper functions for accessing the register pairs B and C, D and E and H and L
         // as a packed word.
-        word getBC() const { return bytesAsWord(B, C); }
-        word getDE() const { return bytesAsWord(D, E); }
-        word getHL() const { return bytesAsWord(H, L); }
+        word getBC() const { return registerPairs[0]; }
+        word getDE() const { return registerPairs[1]; }
+        word getHL() const { return registerPairs[2]; }
+
+        void setBC(word value) { registerPairs[0] = value; }
+        void setDE(word value) { registerPairs[1] = value; }
+        void setHL(word value) { registerPairs[2] = value; }
+
+        // The values of the individual state flags.
+        // Every instruction which sets the zero, sign and parity flags derives them from its 8 bit result,
+        // hence these do not need the tables in alu_tables.hpp.
+        bool getZ() const { return flagsOperation == FlagsOperation::None ? (F & alu::zeroFlag) != 0 : flagsResult == 0; }
+        bool getS() const { return flagsOperation == FlagsOperation::None ? (F & alu::signFlag) != 0 : (flagsResult & 0x80) != 0; }
+        bool getP() const { return ((flagsOperation == FlagsOperation::None ? F : alu::zspFlags[flagsResult]) & alu::parityFlag) != 0; }
+        bool getCA() const { return (computeFlags() & alu::auxiliaryCarryFlag) != 0; }
+
+        bool getCY() const
+        {
+            switch (flagsOperation)
+            {
+                case FlagsOperation::None:
+                    return (F & alu::carryFlag) != 0;
+                case FlagsOperation::Add:
+                    return flagsAccumulator + flagsOperand + flagsCarry > 0xFF;
+                case FlagsOperation::Subtract:
+                    return flagsOperand + flagsCarry > flagsAccumulator;
+                default:
+                    return (flagsCarry & alu::carryFlag) != 0;
+            }
+        }
+
+        // Sets the carry flag, leaving the other flags unchanged. Used by the STC, CMC, DAD and rotate instructions.
+        void setCY(bool value)
+        {
+            F = (computeFlags() & ~alu::carryFlag) | (value ? alu::carryFlag : 0);
+            flagsOperation = FlagsOperation::None;
+        }
+
+        // Set the flags for the arithmetic and logic instructions. The arguments are the operands of the
+        // instruction, that is the registers before it is executed.
+        void setAddFlags(byte accumulator, byte operand, byte carry)
+        {
+            recordFlags(FlagsOperation::Add, accumulator, operand, carry, accumulator + operand + carry);
+        }
+
+        void setSubtractFlags(byte accumulator, byte operand, byte carry)
+        {
+            recordFlags(FlagsOperation::Subtract, accumulator, operand, carry, accumulator - operand - carry);
+        }
+
+        void setIncrementFlags(byte value)
+        {
+            recordFlags(FlagsOperation::Increment, 0, value, getCY(), value + 1);
+        }
+
+        void setDecrementFlags(byte value)
+        {
+            recordFlags(FlagsOperation::Decrement, 0, value, getCY(), value - 1);
+        }
 
-        void setBC(word value) { wordAsBytePair(value, B, C); }
-        void setDE(word value) { wordAsBytePair(value, D, E); }
-        void setHL(word value) { wordAsBytePair(value, H, L); }
+        void setLogicFlags(byte result, byte auxiliaryCarry)
+        {
+            recordFlags(FlagsOperation::Logic, 0, 0, auxiliaryCarry, result);
+        }
 
         // Packs the values of the state flags into a byte in the same manner as the intel 8080 stores 
         // the flags internally. 
         // Used for the PUSH PSW instruction. 
         byte packFlags() const
         {
-           return (S << 7) | (Z << 6) | (CA << 4) | (P << 2) | (1 << 1) | CY;
+            return computeFlags() | (1 << 1);
         }
 
         // Unpacks the values of the state flags from a byte that was packed by packFlags().
         // Used for the OP PSW instruction.
         void unpackFlags(byte value)
         {
-            S = (value >> 7) & 0x01;
-            Z = (value >> 6) & 0x01;
-            CA = (value >> 4) & 0x01;
-            P = (value >> 2) & 0x01;
-            CY = value & 0x01;
+            F = value & (alu::signFlag | alu::zeroFlag | alu::auxiliaryCarryFlag | alu::parityFlag | alu::carryFlag);
+            flagsOperation = FlagsOperation::None;
         }
 
         // Note that according to the intel specifications the only effect of RESET
@@ -60,12 +160,62 @@ namespace emulator
         // from a different run before reset() was called.
         void reset()
         {
-            A = B = C = D = E = H = L = 0;
-            PC = SP = 0;
-            Z = S = P = CY = CA = 0;
+            *this = CpuState();
+        }
 
-            halted = false;
-            interruptsEnabled = false;
+        // Are the states identical, including how the flags are recorded?
+        // Two identical states execute the same instructions in the same way.
+        bool operator==(const CpuState& other) const
+        {
+            return registerPairs[0] == other.registerPairs[0] && registerPairs[1] == other.registerPairs[1] &&
+                registerPairs[2] == other.registerPairs[2] && registerPairs[3] == other.registerPairs[3] &&
+                PC == other.PC && SP == other.SP && halted == other.halted &&
+                interruptsEnabled == other.interruptsEnabled && flagsOperation == other.flagsOperation &&
+                flagsAccumulator == other.flagsAccumulator && flagsOperand == other.flagsOperand &&
+                flagsCarry == other.flagsCarry && flagsResult == other.flagsResult;
         }
+
+        bool operator!=(const CpuState& other) const { return !(*this == other); }
+
+        private:
+            // On a little endian host the high byte of every register pair is stored after the low byte,
+            // hence the registers are swapped in pairs with respect to the order of the opcodes.
+            static constexpr byte registerIndexSwap = EMULATOR_LITTLE_ENDIAN ? 1 : 0;
+
+            byte computeFlags() const
+            {
+                switch (flagsOperation)
+                {
+                    case FlagsOperation::Add:
+                        return alu::addFlags[alu::arithmeticIndex(flagsAccumulator, flagsOperand, flagsCarry)];
+                    case FlagsOperation::Subtract:
+                        return alu::subtractFlags[alu::arithmeticIndex(flagsAccumulator, flagsOperand, flagsCarry)];
+                    case FlagsOperation::Increment:
+                        return alu::incrementFlags[flagsOperand] | flagsCarry;
+                    case FlagsOperation::Decrement:
+                        return alu::decrementFlags[flagsOperand] | flagsCarry;
+                    case FlagsOperation::Logic:
+                        return alu::zspFlags[flagsResult] | flagsCarry;
+                    default:
+                        return F;
+                }
+            }
+
+            void recordFlags(FlagsOperation operation, byte accumulator, byte operand, byte carry, byte result)
+            {
+                flagsOperation = operation;
+                flagsAccumulator = accumulator;
+                flagsOperand = operand;
+                flagsCarry = carry;
+                flagsResult = result;
+
+                if constexpr (!EMULATOR_LAZY_FLAGS)
+                {
+                    F = computeFlags();
+                    flagsOperation = FlagsOperation::None;
+                }
+            }
     };
+
+    static_assert(std::is_trivially_copyable_v<CpuState>, "Snapshots of the cpu state are copied as bytes.");
 } // namespace emulator
@@ -0,0 +1,104 @@
+/*
+    Implementation of the superinstructions (see superinstructions.hpp), which the predecoded dispatch
+    of BasicCpu executes for the instructions that the PredecodeCache has fused.
+
+    This file is included by BasicCpu::runThreaded after cpu_instructions.inl. Besides the macros
+    described there, it defines
+        SUPERINSTRUCTION(name, machineCycles)
+            Marks the start of the implementation of the given superinstruction, which executes at most
+            the given number of machine cycles. If these exceed the budget of the cpu, the first instruction
+            is executed on its own, such that the cpu stops after the same instruction as without fusion.
+        NEXT_IN_SEQUENCE(condition)
+            Marks the end of an instruction in the sequence. Like NEXT_INSTRUCTION it counts the instruction
+            and returns if the predicate holds. The opcode of the next instruction is read from memory, which
+            may have been written since the sequence was fused. Only if the opcode satisfies the condition,
+            the instruction is executed as part of the sequence, otherwise it is dispatched as usual.
+    Only the first instruction takes its operand from the predecode cache, the following ones read it from memory.
+    Each instruction counts the same machine cycles as its implementation in cpu_instructions.inl.
+*/
+
+// DCR r ; JNZ or JZ
+SUPERINSTRUCTION(DecrementJump, 15);
+    executeDCR(state, state.getRegister(opCode >> 3));
+    executedMachineCycles += 5;
+    NEXT_IN_SEQUENCE(isZeroJump(opCode));
+    executeConditionalJMP(state, state.getZ() == ((opCode & 0x08) != 0), readMemoryWord(state.PC));
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// ANA A ; JNZ or JZ
+SUPERINSTRUCTION(AndJump, 14);
+    executeANA(state, state.A);
+    executedMachineCycles += 4;
+    NEXT_IN_SEQUENCE(isZeroJump(opCode));
+    executeConditionalJMP(state, state.getZ() == ((opCode & 0x08) != 0), readMemoryWord(state.PC));
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// LDA ; ANA A ; JNZ or JZ
+// The loops in which Space Invaders waits for the interrupts.
+SUPERINSTRUCTION(LoadAndJump, 27);
+    state.A = readMemory(IMMEDIATE_WORD);
+    state.PC += 2;
+    executedMachineCycles += 13;
+    NEXT_IN_SEQUENCE(opCode == 0xA7);
+    executeANA(state, state.A);
+    executedMachineCycles += 4;
+    NEXT_IN_SEQUENCE(isZeroJump(opCode));
+    executeConditionalJMP(state, state.getZ() == ((opCode & 0x08) != 0), readMemoryWord(state.PC));
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// LDA ; DCR A ; JNZ or JZ
+SUPERINSTRUCTION(LoadDecrementJump, 28);
+    state.A = readMemory(IMMEDIATE_WORD);
+    state.PC += 2;
+    executedMachineCycles += 13;
+    NEXT_IN_SEQUENCE(opCode == 0x3D);
+    executeDCR(state, state.A);
+    executedMachineCycles += 5;
+    NEXT_IN_SEQUENCE(isZeroJump(opCode));
+    executeConditionalJMP(state, state.getZ() == ((opCode & 0x08) != 0), readMemoryWord(state.PC));
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// CPI ; JNZ or JZ
+SUPERINSTRUCTION(CompareJump, 17);
+    executeCMP(state, IMMEDIATE_BYTE);
+    ++state.PC;
+    executedMachineCycles += 7;
+    NEXT_IN_SEQUENCE(isZeroJump(opCode));
+    executeConditionalJMP(state, state.getZ() == ((opCode & 0x08) != 0), readMemoryWord(state.PC));
+    executedMachineCycles += 10;
+    NEXT_INSTRUCTION;
+
+// MOV r, M ; INX H
+SUPERINSTRUCTION(LoadIncrement, 12);
+    state.getRegister(opCode >> 3) = readMemory(state.getHL());
+    executedMachineCycles += 7;
+    NEXT_IN_SEQUENCE(opCode == 0x23);
+    state.setHL(state.getHL() + 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// MOV M, r ; INX H
+SUPERINSTRUCTION(StoreIncrement, 12);
+    writeMemory(state.getHL(), state.getRegister(opCode));
+    executedMachineCycles += 7;
+    NEXT_IN_SEQUENCE(opCode == 0x23);
+    state.setHL(state.getHL() + 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
+
+// LDAX D ; MOV M, A ; INX H
+// Copies a byte in the loops with which Space Invaders copies blocks of memory.
+SUPERINSTRUCTION(CopyIncrement, 19);
+    state.A = readMemory(state.getDE());
+    executedMachineCycles += 7;
+    NEXT_IN_SEQUENCE(opCode == 0x77);
+    writeMemory(state.getHL(), state.A);
+    executedMachineCycles += 7;
+    NEXT_IN_SEQUENCE(opCode == 0x23);
+    state.setHL(state.getHL() + 1);
+    executedMachineCycles += 5;
+    NEXT_INSTRUCTION;
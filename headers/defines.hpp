@@ -6,5 +6,41 @@
 // Should the cpu class check whether unspecified opcodes are used?
 #define EMULATOR_CHECK_INVALID_OPCODES true
 
+// Should the cpu compute the state flags only when they are read, instead of after every
+// arithmetic and logic instruction? See CpuState.
+#define EMULATOR_LAZY_FLAGS true
+
+// Is the host little endian? Determines the order of the registers in CpuState.
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    #define EMULATOR_LITTLE_ENDIAN false
+#else
+    #define EMULATOR_LITTLE_ENDIAN true
+#endif
+
+// Can the cpu class dispatch instructions with computed gotos (threaded code)?
+// Requires the 'labels as values' extension supported by GCC and Clang.
+#if defined(__GNUC__)
+    #define EMULATOR_THREADED_DISPATCH true
+#else
+    #define EMULATOR_THREADED_DISPATCH false
+#endif
+
+// Can the JitCpu translate intel 8080 code into native code at runtime?
+// Requires an x86-64 host, otherwise the JitCpu only interprets.
+#if defined(__x86_64__) || defined(_M_X64)
+    #define EMULATOR_JIT_SUPPORTED true
+#else
+    #define EMULATOR_JIT_SUPPORTED false
+#endif
+
+// Can the Upscaler expand palette indices into pixels with the SSSE3 instruction pshufb?
+// Requires an x86-64 host and a compiler which emits it for a single function (GCC, Clang or MSVC).
+// Whether the processor supports it is checked at runtime.
+#if (defined(__GNUC__) && defined(__x86_64__)) || defined(_M_X64)
+    #define EMULATOR_SSSE3_SUPPORTED true
+#else
+    #define EMULATOR_SSSE3_SUPPORTED false
+#endif
+
 // Should any errors reported by sfml be saved into an error_log.txt file?
 #define EMULATOR_LOG_SFML_ERRORS false
\ No newline at end of file
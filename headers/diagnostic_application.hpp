@@ -18,6 +18,9 @@ namespace emulator
             static constexpr std::size_t romSize = 0;
             static constexpr std::size_t ramSize = 0x10000;
 
+            // Number of machine cycles the cpu runs between handling console events.
+            static constexpr std::size_t machineCyclesPerUpdate = 100'000;
+
             explicit DiagnosticApplication();
             virtual ~DiagnosticApplication();
 
@@ -26,7 +29,9 @@ namespace emulator
         private:
             void beginTest(const std::string& filename);
 
+            // Handles the traps if the program counter changed since the previous call.
             void handleTestIO();
+            void handleTraps();
             void printOutput();
 
             void beginChooseTestPrompt();
@@ -2,13 +2,16 @@
 
 #include "cpu.hpp"
 
-#include <set>
+#include <bitset>
+#include <string>
 
 namespace emulator
 {
     /*
         Extention of the base cpu class which has the ability to set breakpoints.
         The cpu automatically enters the halted state whenever it encounters a breakpoint.
+        Additionally traps can be set, at which run returns without halting the cpu.
+        These allow the application to emulate calls to an operating system.
     */
     class DiagnosticCpu : public Cpu
     {
@@ -17,12 +20,21 @@ namespace emulator
             
             // Execute the instruction currently pointed at by the program counter.
             // Returns the number of machine cycles the instruction took to execute.
-            std::size_t executeInstructionCycle();
+            std::size_t executeInstructionCycle() override;
+
+            // Execute instructions until the given number of machine cycles has been executed,
+            // or a breakpoint or trap is reached. Breakpoints halt the cpu, traps do not.
+            // Returns the number of machine cycles executed.
+            std::size_t run(std::size_t machineCycles) override;
             
             void addBreakpoint(word address);
             void removeBreakpoint(word address);
             void toggleBreakpoint(word address);
-            bool isBreakpoint(word address);
+            bool isBreakpoint(word address) const;
+
+            void addTrap(word address);
+            void removeTrap(word address);
+            bool isTrap(word address) const;
 
             // Saves or loads the set of breakpoints to a file specified by path.
             // Throws an EmulatorException is the file specified by path could not be opened.
@@ -30,6 +42,8 @@ namespace emulator
             void loadBreakpoints(const std::string& path);
 
         private:
-            std::set<word> breakpoints;
+            // Bit sets rather than sets, since run looks up the program counter after every instruction.
+            std::bitset<0x10000> breakpoints;
+            std::bitset<0x10000> traps;
     };
 } // namespace emulator
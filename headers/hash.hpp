@@ -0,0 +1,23 @@
+#pragma once
+
+#include "int_types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace emulator
+{
+    // 64 bit FNV-1a hash of size bytes, with which ROM images and the contents of memory are identified.
+    inline std::uint64_t hashBytes(const byte* data, std::size_t size)
+    {
+        std::uint64_t hash = 0xCBF29CE484222325;
+
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            hash ^= data[i];
+            hash *= 0x100000001B3;
+        }
+
+        return hash;
+    }
+} // namespace emulator
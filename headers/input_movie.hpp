@@ -0,0 +1,53 @@
+#pragma once
+
+#include "int_types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace emulator
+{
+    /*
+        Recording of the input of a run of Space Invaders: the bytes of the input ports 1 and 2 as latched
+        in every frame (see SpaceInvadersIO::latchInput), along with the hash of the ROM which was run.
+        Since the interrupts and the input latch are scheduled on the machine cycles of the cpu, replaying
+        the input from reset reproduces the run exactly (see ReplayApplication).
+
+        The file starts with the magic "I8080MOV", the version and the hash of the ROM (see hashBytes),
+        followed by runs of frames with the same input: the number of frames (2 bytes) and the bytes of the
+        ports 1 and 2. All numbers are little endian.
+    */
+    class InputMovie
+    {
+        public:
+            static constexpr std::uint16_t version = 1;
+
+            struct Frame
+            {
+                byte port1;
+                byte port2;
+            };
+
+            explicit InputMovie(std::uint64_t romHash = 0);
+
+            // Appends the input of the next frame.
+            void addFrame(byte port1, byte port2) { frames.push_back(Frame{port1, port2}); }
+
+            const Frame& getFrame(std::size_t frame) const { return frames[frame]; }
+            std::size_t getFrameCount() const { return frames.size(); }
+
+            std::uint64_t getRomHash() const { return romHash; }
+
+            // Throws an EmulatorException if the file can not be written.
+            void save(const std::string& path) const;
+
+            // Throws an EmulatorException if the file can not be read or is not a movie of this version.
+            static InputMovie load(const std::string& path);
+
+        private:
+            std::uint64_t romHash;
+            std::vector<Frame> frames;
+    };
+} // namespace emulator
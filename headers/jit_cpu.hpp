@@ -0,0 +1,158 @@
+#pragma once
+
+#include "cpu.hpp"
+#include "memory.hpp"
+#include "io.hpp"
+#include "x64_emitter.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace emulator
+{
+    /*
+        Emulation of the intel 8080 which translates basic blocks of 8080 code into x86-64 code at runtime.
+
+        A block runs from its start address up to and including the first jump, call, return or restart
+        instruction. Blocks end before the IN, OUT and HLT instructions, which are executed by the interpreter
+        of BasicCpu, as are interrupts (issueRSTInterrupt). Blocks continue into each other through a table
+        indexed by the 8080 address (block chaining), so the translated code only returns to run when it
+        reaches code that is not translated yet, or when the budget of machine cycles is exhausted.
+        The budget is checked at the start of every block, which only runs if it fits in the remaining budget,
+        such that the cpu stops at the same instruction as the interpreter. The cycles of a block are
+        counted at its exits.
+
+        The pages of memory from which code is translated are watched (see MemoryWatcher). Any write to
+        the bytes of a block, by the translated code itself or through Memory, invalidates that block.
+        A write by the translated code which invalidates a block ends the current block, hence self
+        modifying code behaves exactly as on the interpreter.
+
+        The translated code is only executable while no block is being translated (see x64::CodeBuffer).
+        Memory is accessed without bounds checking, like a cpu with the UncheckedPolicy does.
+        On hosts other than x86-64 (see EMULATOR_JIT_SUPPORTED), and on systems which refuse executable
+        memory, all code is interpreted.
+    */
+    class JitCpu : public BasicCpu<Memory, IO, UncheckedPolicy>, private MemoryWatcher
+    {
+        public:
+            explicit JitCpu(Memory&, IO&);
+            ~JitCpu();
+
+            std::size_t run(std::size_t machineCycles) override;
+
+            // Discards all translated code.
+            void flush();
+
+            std::size_t getTranslatedBlockCount() const { return translatedBlockCount; }
+            std::size_t getInvalidatedBlockCount() const { return invalidatedBlockCount; }
+
+        private:
+            /*
+                The cpu state as seen by the translated code, which addresses it relative to RBX.
+                The byte registers are ordered such that BC, DE, HL and PSW (A and the flags in the format of
+                CpuState::packFlags) can be accessed as little endian words.
+            */
+            struct Context
+            {
+                byte C, B, E, D, L, H, F, A;
+                word SP, PC;
+                byte interruptsEnabled;
+
+                std::uint64_t executedInstructionCycles;
+                std::uint64_t executedMachineCycles;
+                std::uint64_t targetMachineCycles;
+
+                const Memory::PageTable* pageTable;
+                const void* const* blocks;
+                const byte* pageWatchCounts;
+                JitCpu* cpu;
+            };
+
+            // Progress of the translation of a block: the address of the next instruction to translate
+            // and the number of instructions and machine cycles executed by the block up to that instruction.
+            struct Progress
+            {
+                std::uint32_t address;
+                std::uint32_t instructions;
+                std::uint32_t machineCycles;
+            };
+
+            using EnterFunction = void (*)(Context* context, const void* code);
+
+            #if EMULATOR_JIT_SUPPORTED
+                // Runs translated code starting at code, until it returns through exitCode.
+                void enter(const void* code, std::size_t targetMachineCycles);
+
+                // Translates the block starting at address.
+                // Returns nullptr if the instruction at address can not be translated.
+                const void* translate(word address);
+
+                // Emits the translation of the instruction at progress.address and advances progress past it.
+                // Returns whether the instruction ends the block.
+                bool translateInstruction(Progress& progress);
+
+                // The machine cycles executed by the block starting at address if every condition is met.
+                std::uint32_t getMaxBlockMachineCycles(word address) const;
+
+                // Whether the instruction at address can be part of a block.
+                bool isTranslatable(std::uint32_t address) const;
+
+                void emitStubs();
+
+                // Emits code which counts the executed instructions and machine cycles and continues at target.
+                void emitJump(word target, std::uint32_t instructions, std::uint32_t machineCycles);
+                // As emitJump, with the target in EAX.
+                void emitJumpToRax(std::uint32_t instructions, std::uint32_t machineCycles);
+                void emitCounters(std::uint32_t instructions, std::uint32_t machineCycles);
+
+                // Emits code which notifies memory if the size bytes written at the address in ESI lie in a
+                // watched page, and continues at resumeAddress if that invalidated any translated code.
+                void emitWriteCheck(std::uint32_t size, word resumeAddress, std::uint32_t instructions, std::uint32_t machineCycles);
+
+                // Emits code which looks up the page of the address in the register address (zero extended)
+                // in the read or write table of Memory::PageTable. Leaves the pointer to the page in the register
+                // page and the offset in the page in the register offset, so the byte is at(page, offset, 0).
+                void emitPageLookup(x64::Register address, x64::Register page, x64::Register offset, bool write);
+
+                // Emits code which reads the word at the address in ESI into EAX, and writes the word in AX
+                // at the address in ESI. The bytes are looked up separately, as they may lie in different pages.
+                void emitReadWord();
+                void emitWriteWord();
+
+                void emitLoadCarry();
+                void emitArithmetic(byte operation);
+                void emitCall(word target, word returnAddress, std::uint32_t instructions, std::uint32_t machineCycles);
+                void emitReturn(std::uint32_t instructions, std::uint32_t machineCycles);
+
+                // Called by the translated code when it writes to a watched page.
+                // Returns whether any block was invalidated.
+                static int onTranslatedCodeWrite(Context* context, std::uint32_t address, std::uint32_t size) noexcept;
+            #endif
+
+            void onMemoryWritten(std::size_t address, std::size_t size) override;
+            void invalidateBlock(word address);
+
+            Context context{};
+
+            x64::CodeBuffer codeBuffer;
+            x64::Emitter emitter;
+            std::size_t stubsSize = 0;
+
+            EnterFunction enterCode = nullptr;
+            const void* exitCode = nullptr;
+
+            // Translated code for every address, or exitCode if there is no block starting at that address.
+            std::vector<const void*> blocks;
+
+            // The end address (exclusive) of the block starting at an address.
+            std::vector<std::uint32_t> blockEnds;
+
+            // The start addresses of the blocks which contain bytes of each page.
+            std::vector<std::vector<word>> pageBlocks;
+
+            std::size_t translatedBlockCount = 0;
+            std::size_t invalidatedBlockCount = 0;
+    };
+
+    extern template class BasicCpu<Memory, IO, UncheckedPolicy>;
+} // namespace emulator
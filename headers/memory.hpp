@@ -1,38 +1,160 @@
 #pragma once
 
 #include "int_types.hpp"
+#include "defines.hpp"
 
+#include <array>
 #include <memory>
 #include <string>
 #include <vector>
 
 namespace emulator
 {
+    class MemoryArena;
+
+    /*
+        Interface for classes that keep information derived from the contents of memory, such as translated code.
+        A watcher is notified when memory in one of the pages it watches is written to, see Memory::addWatcher.
+    */
+    class MemoryWatcher
+    {
+        public:
+            virtual ~MemoryWatcher() {}
+
+            // Called when the bytes address through address + size - 1 are written,
+            // if at least one of them lies in a watched page. Memory::clear and Memory::loadMemoryFromFile
+            // notify the watchers of any write, including writes to pages that are not watched (such as ROM).
+            virtual void onMemoryWritten(std::size_t address, std::size_t size) = 0;
+    };
+
     /*
         Class that implements the emulation of the memory modules in a computer system containing an i8080.
+
+        The address space is divided into pages of pageSize bytes, each of which a page table maps to the memory
+        from which it is read and to which it is written:
+            ROM: read from the buffer, writes are ignored (they go to a page that is never read).
+            RAM: read from and written to the buffer.
+            A mirror of ROM or RAM: reads and writes go to the page it mirrors, see mapMirror.
+            Unmapped: reads return unmappedValue, writes are ignored.
+        Hence reading a byte is a single indexed load through the page table, without any branch.
+        Writing a byte only branches on whether the page is watched.
+
+        Memory either owns a buffer holding ROM and RAM, or reads ROM from an image shared by many instances
+        and allocates only its RAM from a MemoryArena. A shared ROM image is never written.
     */
     class Memory
     {
         public:
+            static constexpr std::size_t maxMemorySize = (1 << 16);
+
+            static constexpr std::size_t pageSize = 0x100;
+            static constexpr std::size_t pageCount = maxMemorySize / pageSize;
+
+            // The buffer owned by memory is padded beyond the address space, such that the operands
+            // of an instruction at any address can be read from it without checking its bounds.
+            static constexpr std::size_t paddingSize = 3;
+
+            // The value read from an unmapped page, as the data bus floats high.
+            static constexpr byte unmappedValue = 0xFF;
+
+            enum class PageType : byte
+            {
+                Unmapped,
+                Rom,
+                Ram
+            };
+
+            // The memory through which the pages are read and written, indexed by page. The ROM and RAM pages
+            // point to their offset in ROM and RAM (see getRom and getRam), a mirror to the page it mirrors.
+            // The two tables are adjacent, such that translated code can index both from one register.
+            struct PageTable
+            {
+                std::array<const byte*, pageCount> read;
+                std::array<byte*, pageCount> write;
+            };
+
             // Allocates romSize + ramSize memory. The block 0 through (romSize - 1) is read-only.
             // The block romSize through (romSize + ramSize - 1) is read and write memory.
-            // Throws an EmulatorException if romSize + ramSize > 0xFFFF (the maximal size that 
-            // can be indexed by a word).
+            // Pages beyond these are unmapped.
+            // Throws an EmulatorException if romSize + ramSize > 0xFFFF (the maximal size that
+            // can be indexed by a word), or if either is not a multiple of pageSize.
             explicit Memory(std::size_t romSize, std::size_t ramSize);
 
+            // Maps the romSize bytes at rom as ROM and allocates ramSize bytes of RAM after it from the arena.
+            // The ROM image is shared, hence it is only read: clear leaves it as it is, loading a file into it
+            // throws and bytes in it that are written through operator[] are discarded. The image and the arena
+            // have to outlive the memory. Throws an EmulatorException like the other constructor.
+            Memory(const byte* rom, std::size_t romSize, std::size_t ramSize, MemoryArena& arena);
+
+            Memory(const Memory&) = delete;
+            Memory& operator=(const Memory&) = delete;
+
+            // Returns a reference to the byte at address, which may also be in ROM (unless the ROM is shared).
+            // Since the byte can be written through the reference, the watchers of its page are notified
+            // before the reference is returned.
             byte& operator[] (word address);
 
-            void set(word address, byte value);
-            byte get(word address) const;
+            // The accessors below check the bounds of the address (and refuse writes to ROM) if checkBounds is set.
+            // By default this is determined by EMULATOR_CHECK_BOUNDS. The cpu selects it through its check policy.
+            // These are defined inline, so that the cpu can access memory without a function call.
+            template <bool checkBounds = EMULATOR_CHECK_BOUNDS>
+            void set(word address, byte value)
+            {
+                if constexpr (checkBounds)
+                    checkWriteAddress(address, 0, "Memory::set");
+
+                std::size_t page = address / pageSize;
+                pageTable.write[page][address % pageSize] = value;
+
+                if (pageWatchCounts[page] != 0)
+                    notifyWritten(address, 1);
+            }
+
+            template <bool checkBounds = EMULATOR_CHECK_BOUNDS>
+            byte get(word address) const
+            {
+                if constexpr (checkBounds)
+                    checkReadAddress(address, 0, "Memory::get");
+
+                return pageTable.read[address / pageSize][address % pageSize];
+            }
 
             // Helper functions for indexing two consecutive byes as a word.
             // Caution: the intel 8080 is a little endian system. Hence
             // a word in memory is stored as ... <low byte> <high byte> ...
             // Always use these functions to correctly read words stored in little endian fashion.
-            word getWord(word address) const;
-            void setWord(word address, word value);
+            // The address of the high byte wraps around at the end of memory, like on the intel 8080.
+            template <bool checkBounds = EMULATOR_CHECK_BOUNDS>
+            word getWord(word address) const
+            {
+                if constexpr (checkBounds)
+                    checkReadAddress(address, 1, "Memory::getWord");
+
+                // At this place we need to mind that the intel 8080 is a little endian processor.
+                // Hence the high byte is located at address + 1, the low byte at address.
+                // The bytes may lie in different pages.
+                return bytesAsWord(get<false>(static_cast<word>(address + 1)), get<false>(address));
+            }
+
+            template <bool checkBounds = EMULATOR_CHECK_BOUNDS>
+            void setWord(word address, word value)
+            {
+                if constexpr (checkBounds)
+                    checkWriteAddress(address, 1, "Memory::setWord");
 
-            // Fills the memory array with zeroes.
+                // Like in Memory::getWord we need to be mindful of the fact that the intel 8080 is little endian.
+                word highAddress = address + 1;
+                std::size_t lowPage = address / pageSize;
+                std::size_t highPage = highAddress / pageSize;
+
+                pageTable.write[lowPage][address % pageSize] = static_cast<byte>(value);
+                pageTable.write[highPage][highAddress % pageSize] = static_cast<byte>(value >> 8);
+
+                if ((pageWatchCounts[lowPage] | pageWatchCounts[highPage]) != 0)
+                    notifyWritten(address, 2);
+            }
+
+            // Fills the memory array with zeroes, except for a shared ROM.
             void clear();
 
             std::size_t getRomSize() const
@@ -52,21 +174,127 @@ namespace emulator
 
             // Loads the contents of the given file into memory at a given offset.
             // Throws an EmulatorException if the given file could not be opened.
-            // Throws an EmulatorException if the file does not fit in memory at the given offset.
+            // Throws an EmulatorException if the file does not fit in memory at the given offset,
+            // or if it would overlap a shared ROM.
             // Returns the index of the first byte after the contents of the loaded file.
             std::size_t loadMemoryFromFile(const std::string& path, std::size_t offset = 0);
 
             // Loads the contents of multiple files sequentially into memory at a given offset.
             void loadMemoryFromFiles(const std::vector<std::string> paths, std::size_t offset = 0);
 
+            // Reads the given file into an image that can be shared as ROM, padded with zeroes to a multiple of pageSize.
+            // Throws an EmulatorException if the file could not be opened or does not fit in memory.
+            static std::vector<byte> loadRomImage(const std::string& path);
+
+            // Maps the unmapped block address through address + size - 1 to the ROM or RAM block sourceAddress
+            // through sourceAddress + sourceSize - 1, which is repeated as often as it fits. All four have to be
+            // multiples of pageSize. Throws an EmulatorException if either block does not lie in the address space,
+            // or if the block to map overlaps ROM or RAM or the source block does not lie entirely in them.
+            void mapMirror(std::size_t address, std::size_t size, std::size_t sourceAddress, std::size_t sourceSize);
+
+            PageType getPageType(std::size_t page) const { return pageTypes[page]; }
+
+            // Watchers are notified of writes to the pages (of pageSize bytes) that are watched.
+            // A page stays watched until every call to watchPage is matched by a call to unwatchPage.
+            // Watching a page also watches its mirrors (and the page it mirrors), and a write to any of these
+            // is reported at the addresses of each of them that is watched, so that a watcher sees every address
+            // in its pages through which the written bytes can be read.
+            void addWatcher(MemoryWatcher* watcher);
+            void removeWatcher(MemoryWatcher* watcher);
+
+            void watchPage(std::size_t page);
+            void unwatchPage(std::size_t page);
+            bool isPageWatched(std::size_t page) const { return pageWatchCounts[page] != 0; }
+
+            // Notifies the watchers that the bytes address through address + size - 1 have been written,
+            // if any of them lies in a watched page.
+            void notifyWritten(std::size_t address, std::size_t size);
+
+            // Direct access to the memory backing ROM and RAM. An address in ROM is at the same offset in getRom,
+            // an address in RAM at its offset from getRomSize in getRam.
+            const byte* getRom() const { return rom; }
+            byte* getRam() { return ram; }
+            const byte* getRam() const { return ram; }
+
+            // Copies getRamSize bytes from source into RAM, e.g. from a SaveState, and notifies the watchers
+            // of the pages in RAM which are watched.
+            void loadRam(const byte* source);
+            bool sharesRom() const { return romShared; }
+
+            // Meant for code generated at runtime that accesses memory itself (see JitCpu). Such code has
+            // to check getPageWatchCounts and call notifyWritten when it writes to a watched page.
+            const PageTable& getPageTable() const { return pageTable; }
+            const byte* getPageWatchCounts() const { return pageWatchCounts.data(); }
+
         private:
+            // Throw an EmulatorException if the bytes address through address + extraBytes (wrapping around
+            // at the end of memory) can not be read or written respectively.
+            // The name of the calling function is used in the exception message.
+            void checkReadAddress(word address, std::size_t extraBytes, const char* function) const
+            {
+                for (std::size_t i = 0; i <= extraBytes; ++i)
+                {
+                    word byteAddress = static_cast<word>(address + i);
+
+                    if (pageTypes[byteAddress / pageSize] == PageType::Unmapped)
+                        throwAddressOutOfRange(byteAddress, function);
+                }
+            }
+
+            void checkWriteAddress(word address, std::size_t extraBytes, const char* function) const
+            {
+                checkReadAddress(address, extraBytes, function);
+
+                for (std::size_t i = 0; i <= extraBytes; ++i)
+                {
+                    word byteAddress = static_cast<word>(address + i);
+
+                    if (pageTypes[byteAddress / pageSize] == PageType::Rom)
+                        throwAddressInRom(byteAddress, function);
+                }
+            }
+
+            [[noreturn]] void throwAddressOutOfRange(word address, const char* function) const;
+            [[noreturn]] void throwAddressInRom(word address, const char* function) const;
+
+            // Notifies the watchers regardless of whether the written pages are watched, at the addresses
+            // of the written bytes in every page that maps to the same memory (or only in the watched ones).
+            void notifyWatchers(std::size_t address, std::size_t size, bool watchedAliasesOnly = false);
+
+            // Maps the pages of ROM and RAM to rom and ram, and the remaining pages as unmapped.
+            void mapPages();
+
+            // Links the pages which map to the same memory (see nextAliases) and counts how often each is watched.
+            void updateAliases();
+
             std::size_t romSize = 0;
             std::size_t ramSize = 0;
             std::size_t totalSize = 0;
 
+            // The buffer holding ROM and RAM, unless the ROM is shared.
             std::unique_ptr<byte[]> data;
 
-        public:
-            static constexpr std::size_t maxMemorySize = (1 << 16);
+            const byte* rom = nullptr;
+            byte* ram = nullptr;
+            bool romShared = false;
+
+            // The pages from which unmapped pages are read and to which writes to ROM and unmapped pages go.
+            std::array<byte, pageSize> unmappedPage;
+            std::array<byte, pageSize> ignoredPage{};
+
+            PageTable pageTable;
+            std::array<PageType, pageCount> pageTypes{};
+
+            // The pages which map to the same memory form a cycle, in which each page holds the next one.
+            // Unmapped pages (which are never written) and pages without mirrors hold themselves.
+            std::array<byte, pageCount> nextAliases{};
+            bool hasMirrors = false;
+
+            std::vector<MemoryWatcher*> watchers;
+
+            // Number of watchPage calls per page, and per page the sum of these over the pages which map
+            // to the same memory, which is what the accessors check.
+            std::array<byte, pageCount> pageWatchRequests{};
+            std::array<byte, pageCount> pageWatchCounts{};
     };
 } // namespace emulator
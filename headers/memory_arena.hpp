@@ -0,0 +1,79 @@
+#pragma once
+
+#include "int_types.hpp"
+
+#include <cstddef>
+#include <new>
+#include <utility>
+
+namespace emulator
+{
+    /*
+        Region of memory from which emulator instances allocate their state, such that many instances
+        (for batch simulation) are packed densely instead of being scattered across the heap.
+
+        The region is either provided by the caller or allocated by the arena, optionally from huge pages
+        to reduce TLB misses. Allocations are aligned to cache lines by default, such that instances
+        running on different threads never share one. Nothing is freed before the arena itself is destroyed,
+        and the arena does not run destructors: objects built with create have to be destroyed with destroy.
+
+        Combined with the constructor of Memory which shares a read-only ROM image (see Memory::Memory),
+        an instance only owns its RAM, page table and cpu state. Its cpu has to use the Threaded dispatch
+        (the default of BasicCpu), since the Predecoded and Fused dispatch allocate a PredecodeCache of 512KB
+        per cpu on the heap (see CpuBase::DispatchMethod). A Space Invaders instance, that is a Memory,
+        a SpaceInvadersIO and a SpaceInvadersCpu, then takes about 18KB of the arena.
+    */
+    class MemoryArena
+    {
+        public:
+            static constexpr std::size_t cacheLineSize = 64;
+
+            // Allocates from the size bytes at buffer, which the caller owns. The buffer has to
+            // outlive the arena and everything allocated from it.
+            MemoryArena(void* buffer, std::size_t size);
+
+            // Allocates an arena of (at least) size bytes. If hugePages is set, the arena is backed by huge pages
+            // if the system provides them, and by regular pages otherwise (see usesHugePages).
+            // Throws an EmulatorException if the memory could not be allocated.
+            explicit MemoryArena(std::size_t size, bool hugePages = false);
+            ~MemoryArena();
+
+            MemoryArena(const MemoryArena&) = delete;
+            MemoryArena& operator=(const MemoryArena&) = delete;
+
+            // Returns size bytes aligned to alignment, which has to be a power of two. The bytes are zeroed.
+            // Throws an EmulatorException if the arena has not enough space left.
+            void* allocate(std::size_t size, std::size_t alignment = cacheLineSize);
+
+            // Constructs an object in the arena, aligned to a cache line (or further if T requires).
+            template <class T, class... Args>
+            T* create(Args&&... args)
+            {
+                std::size_t alignment = alignof(T) > cacheLineSize ? alignof(T) : cacheLineSize;
+                return new (allocate(sizeof(T), alignment)) T(std::forward<Args>(args)...);
+            }
+
+            // Destroys an object constructed by create. Its memory is not reused.
+            template <class T>
+            void destroy(T* object)
+            {
+                if (object != nullptr)
+                    object->~T();
+            }
+
+            std::size_t getSize() const { return size; }
+            std::size_t getUsedSize() const { return used; }
+
+            // Whether the arena was allocated by itself from huge pages.
+            bool usesHugePages() const { return hugePages; }
+
+        private:
+            byte* data = nullptr;
+            std::size_t size = 0;
+            std::size_t used = 0;
+
+            // Whether the arena allocated data, which it then releases when it is destroyed.
+            bool ownsData = false;
+            bool hugePages = false;
+    };
+} // namespace emulator
@@ -796,6 +796,529 @@ namespace emulator
         1
     };
 
+    /*
+        Table containing the number of machine cycles of the instructions indexed by their corresponding opcodes.
+        For the conditional calls and returns these are the cycles when the condition is met,
+        instructionCyclesConditionNotMet contains the cycles when it is not.
+    */
+    const byte instructionCycles[] = {
+        4,
+        10,
+        7,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        7,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        7,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        7,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        16,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        16,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        13,
+        5,
+        10,
+        10,
+        10,
+        4,
+        4,
+        10,
+        13,
+        5,
+        5,
+        5,
+        7,
+        4,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        7,
+        7,
+        7,
+        7,
+        7,
+        7,
+        7,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        11,
+        10,
+        10,
+        10,
+        17,
+        11,
+        7,
+        11,
+        11,
+        10,
+        10,
+        10,
+        17,
+        17,
+        7,
+        11,
+        11,
+        10,
+        10,
+        10,
+        17,
+        11,
+        7,
+        11,
+        11,
+        10,
+        10,
+        10,
+        17,
+        17,
+        7,
+        11,
+        11,
+        10,
+        10,
+        18,
+        17,
+        11,
+        7,
+        11,
+        11,
+        5,
+        10,
+        4,
+        17,
+        17,
+        7,
+        11,
+        11,
+        10,
+        10,
+        4,
+        17,
+        11,
+        7,
+        11,
+        11,
+        5,
+        10,
+        4,
+        17,
+        17,
+        7,
+        11
+    };
+
+    const byte instructionCyclesConditionNotMet[] = {
+        4,
+        10,
+        7,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        7,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        7,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        7,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        16,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        16,
+        5,
+        5,
+        5,
+        7,
+        4,
+        4,
+        10,
+        13,
+        5,
+        10,
+        10,
+        10,
+        4,
+        4,
+        10,
+        13,
+        5,
+        5,
+        5,
+        7,
+        4,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        7,
+        7,
+        7,
+        7,
+        7,
+        7,
+        7,
+        7,
+        5,
+        5,
+        5,
+        5,
+        5,
+        5,
+        7,
+        5,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        4,
+        7,
+        4,
+        5,
+        10,
+        10,
+        10,
+        11,
+        11,
+        7,
+        11,
+        5,
+        10,
+        10,
+        10,
+        11,
+        17,
+        7,
+        11,
+        5,
+        10,
+        10,
+        10,
+        11,
+        11,
+        7,
+        11,
+        5,
+        10,
+        10,
+        10,
+        11,
+        17,
+        7,
+        11,
+        5,
+        10,
+        10,
+        18,
+        11,
+        11,
+        7,
+        11,
+        5,
+        5,
+        10,
+        4,
+        11,
+        17,
+        7,
+        11,
+        5,
+        10,
+        10,
+        4,
+        11,
+        11,
+        7,
+        11,
+        5,
+        5,
+        10,
+        4,
+        11,
+        17,
+        7,
+        11
+    };
+
     // Formats an argument string of an instruction.
     // Replaces any 'bb' in a argument format string with the hexadecimal representation of byte2
     // Replaces any 'wwww' with the hexadecimal representation of the word determined by byte2 and byte3.
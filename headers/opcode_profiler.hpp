@@ -0,0 +1,67 @@
+#pragma once
+
+#include "int_types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <unordered_map>
+#include <vector>
+
+namespace emulator
+{
+    /*
+        Counts how often every pair and triple of opcodes is executed in sequence, to find the sequences
+        which are worth fusing into a superinstruction (see superinstructions.hpp).
+
+        A cpu with a profiler (see CpuBase::setProfiler) records the opcode of every instruction it interprets.
+        Note that the translated code of the JitCpu and RecompiledCpu is not profiled.
+    */
+    class OpcodeProfiler
+    {
+        public:
+            struct Sequence
+            {
+                std::array<byte, 3> opCodes;
+                std::size_t length;
+                std::uint64_t count;
+            };
+
+            explicit OpcodeProfiler();
+
+            // Records that the instruction with the given opcode is executed.
+            void record(byte opCode)
+            {
+                history = ((history << 8) | opCode) & 0xFFFFFF;
+
+                // The first instructions after a reset have no predecessors in history.
+                if (instructionCount >= 1)
+                    ++pairCounts[history & 0xFFFF];
+
+                if (instructionCount >= 2)
+                    ++tripleCounts[history];
+
+                ++instructionCount;
+            }
+
+            void reset();
+
+            std::uint64_t getInstructionCount() const { return instructionCount; }
+
+            // Returns the given number of most executed sequences of two or three opcodes, most executed first.
+            std::vector<Sequence> getHottestSequences(std::size_t length, std::size_t count) const;
+
+            // Writes a table of the given number of most executed pairs and triples of opcodes.
+            void writeReport(std::ostream& stream, std::size_t count = 25) const;
+
+        private:
+            // Counts of the pairs, indexed by (first << 8) | second, and of the triples.
+            std::vector<std::uint64_t> pairCounts;
+            std::unordered_map<std::uint32_t, std::uint64_t> tripleCounts;
+
+            // The last three recorded opcodes, the last one in the lowest byte.
+            std::uint32_t history = 0;
+            std::uint64_t instructionCount = 0;
+    };
+} // namespace emulator
@@ -0,0 +1,107 @@
+#pragma once
+
+#include "int_types.hpp"
+#include "memory.hpp"
+#include "superinstructions.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+namespace emulator
+{
+    /*
+        Cache of the decoded instruction at every address, used by the predecoded dispatch of BasicCpu.
+        Saves the cpu fetching the opcode and the operands of an instruction from memory every time it executes.
+
+        Entries are decoded when they are first executed. The pages of memory (see Memory::pageSize) from which
+        instructions have been decoded are watched, and a write to such a page discards the entries of the
+        instructions which overlap the written bytes, so self modifying code is decoded again.
+        Pages of ROM (see Memory::getPageType) are never watched, since the cpu can not change them. Their entries
+        are only discarded when memory is cleared or loaded from a file.
+
+        If superinstructions are fused, an entry also records whether its instruction starts one of the
+        sequences in superinstructions.hpp. The following instructions of the sequence are not watched,
+        hence the cpu has to check them when it executes the superinstruction.
+
+        Likewise an entry records whether its instruction starts an idle loop (see findIdleLoop), in which
+        case the cpu first checks whether it can skip the loop before executing the instruction.
+    */
+    class PredecodeCache : private MemoryWatcher
+    {
+        public:
+            struct Entry
+            {
+                byte opCode;
+
+                // Length of the instruction in bytes, or 0 if the entry has not been decoded.
+                byte length;
+
+                // The immediate byte or word of the instruction, 0 if it has none.
+                word operand;
+
+                // The index in the dispatch table of the cpu of the instruction: the opcode,
+                // or 0x100 + superinstruction - 1 if the instruction starts a superinstruction.
+                word instructionIndex;
+
+                // The index to which the cpu dispatches: idleLoopDispatchIndex if an idle loop
+                // starts at the instruction, otherwise instructionIndex.
+                word dispatchIndex;
+            };
+
+            static constexpr word idleLoopDispatchIndex = 0x100 + superinstructionCount;
+
+            // The longest idle loop, in instructions.
+            static constexpr std::size_t maxIdleLoopLength = 16;
+
+            explicit PredecodeCache(Memory& memory, bool fuseSuperinstructions = false);
+            ~PredecodeCache();
+
+            PredecodeCache(const PredecodeCache&) = delete;
+            PredecodeCache& operator=(const PredecodeCache&) = delete;
+
+            // Returns the decoded instruction at address. The reference is valid until memory is written.
+            // If checkBounds is set, decoding an instruction outside of memory throws an EmulatorException.
+            template <bool checkBounds>
+            const Entry& get(word address)
+            {
+                Entry& entry = entries[address];
+
+                if (entry.length == 0)
+                    decode(address, checkBounds);
+
+                return entry;
+            }
+
+            // Discards all decoded entries.
+            void flush();
+
+            bool fusesSuperinstructions() const { return fuseSuperinstructions; }
+
+            // Returns the number of instructions of the idle loop starting at address, or 0 if none does.
+            // An idle loop is a sequence of instructions which neither write memory nor access io,
+            // ending in a jump back to address. The loop has no other branches and no register
+            // (such as a counter) which it reads before setting it and changes, so it polls memory
+            // until an interrupt handler writes to it.
+            // The instructions are read from memory, not from the entries.
+            std::size_t findIdleLoop(word address) const;
+
+            // The number of times that memory has been written in watched pages, cleared or loaded.
+            // The instructions which have been decoded are unchanged in memory while this count is.
+            std::size_t getInvalidationCount() const { return invalidationCount; }
+
+        private:
+            void decode(word address, bool checkBounds);
+
+            void onMemoryWritten(std::size_t address, std::size_t size) override;
+
+            Memory& memory;
+
+            bool fuseSuperinstructions;
+
+            std::vector<Entry> entries;
+            std::array<bool, Memory::pageCount> watchedPages{};
+
+            std::size_t invalidationCount = 0;
+    };
+} // namespace emulator
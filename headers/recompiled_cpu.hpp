@@ -0,0 +1,89 @@
+#pragma once
+
+#include "cpu.hpp"
+#include "memory.hpp"
+
+#include <cstdint>
+#include <vector>
+
+namespace emulator
+{
+    class SpaceInvadersIO;
+
+    extern template class BasicCpu<Memory, SpaceInvadersIO, UncheckedPolicy>;
+
+    /*
+        Emulation of the intel 8080 which runs code translated ahead of time into C++ by static_recompiler.py.
+
+        The translated program consists of a function per basic block of the ROM. The cpu calls the block
+        at the program counter, which returns with the program counter set to the address at which execution
+        continues. Addresses at which no block starts, such as targets of RET and PCHL that could not be
+        determined statically or code in RAM, are executed by the interpreter of BasicCpu, as are HLT and
+        interrupts (issueRSTInterrupt).
+
+        Like the JitCpu, a block only runs if it fits in the remaining budget of machine cycles, such that
+        the cpu stops at the same instruction as the interpreter. If the ROM in memory is not the ROM from
+        which the program was translated (see Program::romHash), all code is interpreted.
+    */
+    class RecompiledCpu : public BasicCpu<Memory, SpaceInvadersIO, UncheckedPolicy>, private MemoryWatcher
+    {
+        public:
+            // The cpu as seen by the translated code.
+            struct Context
+            {
+                CpuState& state;
+                Memory& memory;
+                SpaceInvadersIO& io;
+
+                std::size_t& executedInstructionCycles;
+                std::size_t& executedMachineCycles;
+            };
+
+            using BlockFunction = void (*)(Context& context);
+
+            struct Block
+            {
+                word address;
+
+                // The machine cycles executed by the block if every condition is met.
+                word maxMachineCycles;
+
+                BlockFunction function;
+            };
+
+            struct Program
+            {
+                // Hash (see hashRom) and size of the ROM from which the program was translated.
+                std::uint64_t romHash;
+                std::size_t romSize;
+
+                const Block* blocks;
+                std::size_t blockCount;
+            };
+
+            explicit RecompiledCpu(Memory&, SpaceInvadersIO&, const Program&);
+            ~RecompiledCpu();
+
+            std::size_t run(std::size_t machineCycles) override;
+
+            // 64 bit FNV-1a hash, with which a translated program identifies its ROM.
+            static std::uint64_t hashRom(const byte* data, std::size_t size);
+
+        private:
+            // Called when memory is cleared or loaded from a file, after which the ROM is compared again.
+            void onMemoryWritten(std::size_t address, std::size_t size) override;
+
+            bool matchesRom();
+
+            const Program& program;
+
+            // The block starting at every address, or nullptr.
+            std::vector<const Block*> blocks;
+
+            bool romCompared = false;
+            bool romMatches = false;
+    };
+
+    // Translated from roms/invaders.rom, see src/spaceinvaders_recompiled.cpp.
+    extern const RecompiledCpu::Program spaceInvadersProgram;
+} // namespace emulator
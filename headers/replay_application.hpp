@@ -0,0 +1,64 @@
+#pragma once
+
+#include "application.hpp"
+#include "input_movie.hpp"
+#include "memory.hpp"
+#include "scheduler.hpp"
+#include "spaceinvaders_application.hpp"
+#include "spaceinvaders_io.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+
+namespace emulator
+{
+    /*
+        Headless replay of an InputMovie of Space Invaders. The cabinet is emulated as by
+        SpaceInvadersApplication, with the same interrupts and input latch at the same machine cycles,
+        but without a window, audio or video and as fast as the host allows.
+
+        At the vertical blank of every frame the hash of the RAM (see hashBytes) is written to the output
+        as a line "<frame> <hash>". As the replay is deterministic, replays on different cpus (see
+        SpaceInvadersApplication::CpuType) produce the same hashes, and the first line at which they differ
+        is the first frame at which one of the cpus went wrong.
+    */
+    class ReplayApplication : public Application, private ScheduledDevice
+    {
+        public:
+            // Throws an EmulatorException if the movie can not be loaded.
+            ReplayApplication(const std::string& moviePath, SpaceInvadersApplication::CpuType cpuType, std::ostream& output);
+
+            ReplayApplication(const ReplayApplication&) = delete;
+            ReplayApplication& operator=(const ReplayApplication&) = delete;
+
+            // Replays every frame of the movie. Throws an EmulatorException if the movie was recorded
+            // with a different ROM.
+            void run() override;
+
+        private:
+            // The events of the CRT and the input latch in every frame, as in SpaceInvadersApplication.
+            enum FrameEvent
+            {
+                MidScreen,
+                VerticalBlank,
+                InputLatch
+            };
+
+            void onEvent(int event, std::size_t time) override;
+
+            InputMovie movie;
+            std::ostream& output;
+
+            Memory memory;
+            SpaceInvadersIO io;
+            std::unique_ptr<CpuBase> cpu;
+
+            Scheduler scheduler;
+
+            // The frames of which the input was latched and of which the vertical blank was reached.
+            std::size_t latchedFrames = 0;
+            std::size_t finishedFrames = 0;
+    };
+} // namespace emulator
@@ -0,0 +1,101 @@
+#pragma once
+
+#include "cpu.hpp"
+#include "cpu_state.hpp"
+#include "int_types.hpp"
+#include "memory.hpp"
+#include "spaceinvaders_io.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace emulator
+{
+    /*
+        Snapshot of a running Space Invaders machine: the cpu state and its cycle counters, the RAM and the state
+        of the io (see SpaceInvadersIO::State). The ROM is only identified by its hash (see hashBytes), and a state
+        is only loaded into a machine running the same ROM. The events of the CRT and the input latch are not saved,
+        as they recur at fixed times in every frame, from which the machine schedules them again after a load.
+
+        The snapshot has a fixed size and holds no pointers, such that save and load merely copy about 8KB,
+        without allocating. A file holds the same bytes and is read and written through a mapping of the file.
+        The bytes are laid out as on the host, hence a file records the byte order and the size of the
+        snapshot, and is only loaded by a build of the same version and layout.
+    */
+    class SaveState
+    {
+        public:
+            static constexpr std::uint16_t version = 3;
+
+            static constexpr std::size_t ramSize = 0x2000;
+
+            // The parts of the machine from which a state is saved and to which it is loaded.
+            struct Machine
+            {
+                CpuBase& cpu;
+                Memory& memory;
+                SpaceInvadersIO& io;
+                std::uint64_t romHash;
+            };
+
+            explicit SaveState();
+
+            // Saves the state of the machine. Throws an EmulatorException if its RAM is not ramSize bytes.
+            void save(const Machine& machine);
+
+            // Restores the machine to the saved state. Throws an EmulatorException, leaving the machine
+            // as it is, if the state is not a valid state or was saved from a machine with a different ROM.
+            void load(const Machine& machine) const;
+
+            // Throws an EmulatorException if the file can not be written.
+            void saveToFile(const std::string& path) const;
+
+            // Reads the state from the file. Throws an EmulatorException if the file can not be read,
+            // or is not a state of this version and layout.
+            void loadFromFile(const std::string& path);
+
+            std::uint64_t getRomHash() const { return romHash; }
+            std::size_t getExecutedMachineCycles() const { return static_cast<std::size_t>(executedMachineCycles); }
+
+        private:
+            // The cpu state, of which the flags and the enumeration are stored as bytes, since a file may hold
+            // any values. The registers are in the order of CpuState::getRegister.
+            struct SavedCpuState
+            {
+                std::array<byte, 8> registers;
+                word PC;
+                word SP;
+                byte halted;
+                byte interruptsEnabled;
+                byte flagsOperation;
+                byte flagsAccumulator;
+                byte flagsOperand;
+                byte flagsCarry;
+                byte flagsResult;
+            };
+
+            // Throws an EmulatorException if the header does not match this version and layout, or the cpu state
+            // is not one the cpu can be in.
+            void checkValid(const char* function) const;
+
+            CpuState getCpuState() const;
+
+            static constexpr std::uint16_t byteOrderMark = 0x0102;
+
+            std::array<char, 8> magic;
+            std::uint16_t fileVersion = version;
+            std::uint16_t byteOrder = byteOrderMark;
+            std::uint32_t size;
+            std::uint64_t romHash = 0;
+
+            SavedCpuState cpuState{};
+            std::uint64_t executedInstructionCycles = 0;
+            std::uint64_t executedMachineCycles = 0;
+
+            SpaceInvadersIO::State ioState{};
+
+            std::array<byte, ramSize> ram{};
+    };
+} // namespace emulator
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace emulator
+{
+    class CpuBase;
+
+    /*
+        Interface for the devices of a machine which act at given times, such as a CRT which issues
+        interrupts while it draws the screen. See Scheduler::schedule.
+    */
+    class ScheduledDevice
+    {
+        public:
+            virtual ~ScheduledDevice() {}
+
+            // Called when the cpu has reached the time at which the event was scheduled, with the
+            // event and the time that were passed to Scheduler::schedule.
+            virtual void onEvent(int event, std::size_t time) = 0;
+    };
+
+    /*
+        Queue of the events of a machine, keyed on the machine cycles executed by its cpu
+        (see CpuBase::getExecutedMachineCyles).
+
+        Scheduler::run executes the cpu exactly up to the next event, before which it calls the device
+        of the event. This makes the timing of the devices, and the interrupts they issue, depend only on
+        the instructions executed by the cpu, not on the host. Since the cpu completes the instruction during
+        which an event falls, the device is called at the first instruction boundary at or after its time.
+        A periodic event is scheduled again by its device, relative to the time it was scheduled at
+        (not the time at which it is called), so it does not drift.
+    */
+    class Scheduler
+    {
+        public:
+            // Schedules the event for the device at the given absolute time in machine cycles.
+            // Events at the same time are passed to their devices in the order in which they were scheduled.
+            void schedule(std::size_t time, ScheduledDevice& device, int event);
+
+            // Discards all events, e.g. when the cpu is reset and its machine cycle counter restarts at 0.
+            void clear();
+
+            bool hasEvents() const { return !events.empty(); }
+
+            // The time of the earliest event. Requires hasEvents().
+            std::size_t getNextEventTime() const { return events.front().time; }
+
+            // Runs the cpu for the given number of machine cycles, calling the device of every event which
+            // falls in between. Returns early if the cpu is halted for good (with interrupts disabled).
+            // Returns the number of machine cycles executed.
+            std::size_t run(CpuBase& cpu, std::size_t machineCycles);
+
+        private:
+            struct Event
+            {
+                std::size_t time;
+
+                // Counts the scheduled events, to order those at the same time.
+                std::uint64_t sequence;
+
+                ScheduledDevice* device;
+                int event;
+            };
+
+            // Orders the heap of events such that the earliest is at its front.
+            static bool isLater(const Event& left, const Event& right);
+
+            // Removes the earliest event and passes it to its device.
+            void dispatchNextEvent();
+
+            // Binary heap, see isLater.
+            std::vector<Event> events;
+
+            std::uint64_t scheduledEventCount = 0;
+    };
+} // namespace emulator
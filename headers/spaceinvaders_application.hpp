@@ -1,8 +1,14 @@
 #pragma once
 
 #include "application.hpp"
+#include "input_movie.hpp"
 #include "memory.hpp"
-#include "diagnostic_cpu.hpp"
+#include "opcode_profiler.hpp"
+#include "save_state.hpp"
+#include "scheduler.hpp"
+#include "spaceinvaders_audio.hpp"
+#include "spsc_queue.hpp"
+#include "spaceinvaders_cpu.hpp"
 #include "spaceinvaders_io.hpp"
 
 #include "consolegui/console.hpp"
@@ -11,41 +17,171 @@
 
 #include <SFML/Graphics.hpp>
 
-#include <set>
+#include <atomic>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <string>
 
 namespace emulator
 {
-    class SpaceInvadersApplication : public Application
+    /*
+        The Space Invaders cabinet. The interrupts of its CRT are scheduled on the machine cycles of the cpu
+        (see Scheduler), while the number of machine cycles to execute follows the time of the host.
+
+        The cpu, its io and the translation of video memory run on an emulation thread, such that neither
+        a slow presentation of the window stalls the emulation nor a burst of emulation delays presenting.
+        The emulation publishes a frame at every vertical blank, and the thread of the window draws the
+        newest frame whenever one is published (see SpaceInvadersVideo). Key events are passed from the
+        window to the emulation through a queue, and the sounds which the game switches on are played by
+        the thread of the window (see SpaceInvadersAudio).
+
+        F5 saves the state of the machine (see SaveState) to savestateFileName, F9 restores the state last saved.
+        Both happen on the emulation thread, between two runs of the cpu.
+
+        By default each half of the screen is rendered at the interrupt issued when the CRT has drawn it.
+        With scanline rendering, every scanline is rendered at the machine cycle at which the beam
+        finishes it instead (see SpaceInvadersVideo::updateScanline).
+    */
+    class SpaceInvadersApplication : public Application, private ScheduledDevice
     {
         public:
-            explicit SpaceInvadersApplication();
+            enum class CpuType
+            {
+                Unchecked,  // The cpu performs no checks at all.
+                Checked,    // The cpu checks every memory access and opcode (see CheckedPolicy).
+                Jit,        // The cpu translates the game into x86-64 code (see JitCpu).
+                Recompiled  // The cpu runs the game as translated ahead of time into C++ (see RecompiledCpu).
+            };
+
+            // If profile is set, the opcodes executed by the interpreter are profiled, and the report
+            // (see OpcodeProfiler::writeReport) is written to opcode_profile.txt when the window is closed.
+            // If scanlines is set, the screen is rendered scanline by scanline.
+            // The screen is scaled up with the given filter (see Upscaler).
+            explicit SpaceInvadersApplication(CpuType cpuType = CpuType::Unchecked, bool profile = false,
+                bool scanlines = false, Upscaler::Filter filter = Upscaler::Filter::Nearest);
 
             // Run the application.
             void run() override;
 
+            // Records the input latched in every frame (see InputMovie), which is saved to path when the window
+            // is closed or the emulation fails. Has to be called before run.
+            void recordInput(const std::string& path) { moviePath = path; }
+
+            // Starts the game from the state saved in the file (see SaveState::saveToFile), rather than from reset.
+            // Has to be called before run. A movie can not be recorded from a saved state.
+            void loadStateFromFile(const std::string& path) { initialStatePath = path; }
+
+            // The file to which F5 saves the state of the machine.
+            static constexpr const char* saveStateFileName = "savestate.bin";
+
+            // Creates a cpu of the given type running the game from memory.
+            static std::unique_ptr<CpuBase> createCpu(CpuType cpuType, Memory& memory, SpaceInvadersIO& io);
+
+            // Maps the memory of the cabinet: romSize bytes of ROM followed by ramSize bytes of RAM, mirrored.
+            static constexpr std::size_t romSize = 0x2000;
+            static constexpr std::size_t ramSize = 0x2000;
+            static_assert(ramSize == SaveState::ramSize, "A save state holds the RAM of the cabinet.");
+            static void mapMirrors(Memory& memory);
+
+            // By default the intel 8080 processor runs at 2 MHz.
+            static constexpr std::size_t clockFrequency = 2'000'000;
+
+            // The CRT in the space invaders cabinet had a refresh rate of 60Hz.
+            static constexpr std::size_t machineCyclesPerFrame = clockFrequency / 60;
+
+            // The time in a frame at which the CRT has drawn the top half of the screen.
+            static constexpr std::size_t midScreenMachineCycles = (machineCyclesPerFrame + 1) / 2;
+
+            // The time in a frame at which the buttons are latched into the input ports (see SpaceInvadersIO::latchInput),
+            // at most machineCyclesPerFrame. By default at the vertical blank, just before the interrupt.
+            static constexpr std::size_t inputLatchMachineCycles = machineCyclesPerFrame;
+            static_assert(inputLatchMachineCycles > 0 && inputLatchMachineCycles <= machineCyclesPerFrame,
+                "The input is latched once in every frame.");
+
+            // The time in a frame at which the CRT has drawn the given scanline, about 127 machine cycles per scanline.
+            static constexpr std::size_t scanlineEndMachineCycles(unsigned short scanline)
+            {
+                return (scanline + 1) * machineCyclesPerFrame / SpaceInvadersVideo::scanlineCount;
+            }
+
         private:
+            // The events of the CRT and the input latch in every frame (see ScheduledDevice::onEvent).
+            // The end of scanline i is the event FirstScanline + i.
+            enum FrameEvent
+            {
+                MidScreen,
+                VerticalBlank,
+                InputLatch,
+                FirstScanline
+            };
+
+            // A key pressed or released in the window.
+            struct KeyEvent
+            {
+                sf::Keyboard::Key key;
+                bool pressed;
+            };
+
             void onEvent(const sf::Event& event);
+            void onEvent(int event, std::size_t time) override;
+
+            // Runs the cpu on the emulation thread, following the time of the host, until running is cleared.
+            // An exception ends the emulation and is stored in emulationException.
+            void emulate();
+
+            // Schedules the next event of every kind after the given time of the cpu: the first frame from time 0,
+            // or the rest of the frame of a restored state.
+            void scheduleFrameEvents(std::size_t time);
+
+            // The parts of the machine which a SaveState covers.
+            SaveState::Machine getMachine();
+
+            // Saves the state of the machine into saveState and to saveStateFileName.
+            void saveMachineState();
+
+            // Restores the state last saved, if any, and schedules the frame events from its time.
+            // Ignored while input is recorded, as the movie could not be replayed.
+            void loadMachineState();
 
             void handleEvents();
             void update(float delta);
-            void draw();
 
             void reset();
             void quit();
 
             Memory memory;
             SpaceInvadersIO io;
-            DiagnosticCpu cpu;
+            SpaceInvadersAudio audio;
+            std::unique_ptr<CpuBase> cpu;
+            std::unique_ptr<OpcodeProfiler> profiler;
 
             sf::RenderWindow window;
 
             SpaceInvadersVideo video;
 
+            Scheduler scheduler;
+
+            bool scanlines;
+
             int machineCyclesToBeExecuted = 0;
-            sf::Clock screenTimer;
 
-            // The Space Invaders game updates the top and bottom halves of the screen at different times
-            // This flag records which has last been updated. 
-            bool upperHalf = true;
+            // Key events which the window passes to the emulation.
+            SpscQueue<KeyEvent, 64> keyEvents;
+
+            // Key events of the window which did not fit in keyEvents yet, oldest first. These are passed on
+            // whenever the events of the window are handled, such that no release of a key is lost.
+            std::deque<KeyEvent> pendingKeyEvents;
+
+            std::atomic<bool> running{false};
+            std::exception_ptr emulationException;
+
+            std::string moviePath;
+            std::unique_ptr<InputMovie> movie;
+
+            std::uint64_t romHash = 0;
+            std::string initialStatePath;
+            SaveState saveState;
+            bool hasSaveState = false;
     };
 } // namespace emulator
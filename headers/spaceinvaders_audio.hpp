@@ -0,0 +1,50 @@
+#pragma once
+
+#include "int_types.hpp"
+#include "spaceinvaders_io.hpp"
+
+#include <SFML/Audio.hpp>
+
+#include <cstddef>
+
+namespace emulator
+{
+    /*
+        Class that plays the sounds of the space invaders arcade system.
+
+        The game switches sounds on and off through the bits of the io ports 3 and 5, of which the writes
+        are logged by SpaceInvadersIO (see SpaceInvadersIO::popSoundWrite). Draining that log on the thread
+        of the window keeps the audio library, which may take locks, off the thread of the cpu. Writes which
+        the log dropped are caught up with from the current values of the ports (see SpaceInvadersIO::getSoundPort).
+    */
+    class SpaceInvadersAudio
+    {
+        public:
+            explicit SpaceInvadersAudio(SpaceInvadersIO& io);
+
+            SpaceInvadersAudio(const SpaceInvadersAudio&) = delete;
+            SpaceInvadersAudio& operator=(const SpaceInvadersAudio&) = delete;
+
+            // Plays the sounds switched on by the writes logged since the last update.
+            void update();
+
+            static constexpr std::size_t numberOfSounds = 9;
+            static constexpr float soundVolume = 20;
+
+        private:
+            // Plays the sounds switched on by a write of value to port 3 or 5.
+            void handleWrite(byte port, byte value);
+
+            // The sounds that are not meant to be repeating (that is, all but the ufo sound) are only played
+            // if the bit corresponding to that sound changed from 0 to 1 since the previous write to the port.
+            void handleNonrepeatingSounds(byte value, byte previousValue, std::size_t first, std::size_t number);
+
+            SpaceInvadersIO& io;
+
+            sf::SoundBuffer soundBuffers[numberOfSounds];
+            sf::Sound sounds[numberOfSounds];
+
+            byte port3Value = 0;
+            byte port5Value = 0;
+    };
+} // namespace emulator
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "cpu.hpp"
+
+namespace emulator
+{
+    class SpaceInvadersIO;
+
+    // The cpu of the Space Invaders cabinet. 
+    // Accesses the io ports of the cabinet directly through SpaceInvadersIO, rather than through virtual calls.
+    template <class CheckPolicy>
+    using SpaceInvadersCpu = BasicCpu<Memory, SpaceInvadersIO, CheckPolicy>;
+
+    extern template class BasicCpu<Memory, SpaceInvadersIO, CheckedPolicy>;
+    extern template class BasicCpu<Memory, SpaceInvadersIO, UncheckedPolicy>;
+} // namespace emulator
@@ -1,19 +1,32 @@
 #pragma once
 
 #include "io.hpp"
+#include "spsc_queue.hpp"
 
-#include <string>
-#include <map>
+#include <array>
+#include <atomic>
+#include <bitset>
+#include <cstdint>
 
 #include <SFML/Window/Keyboard.hpp>
-#include <SFML/Audio.hpp>
 
 namespace emulator
 {
+    class CpuBase;
+
     /*
         Class that emulates the IO ports founds in the space invaders arcade system.
+
+        The buttons of the cabinet are read from the keys set pressed by setKeyPressed, rather than from
+        the keyboard, such that the window may pass its key events from another thread. The buttons are
+        latched into the bytes of the input ports once per frame (see latchInput), so reading a port
+        is a plain load and the game sees the same buttons throughout a frame.
+
+        Writes to the ports of the sounds (3 and 5) are only logged, for SpaceInvadersAudio to play them on
+        another thread, such that the cpu never calls the audio library. The current values of these ports
+        are published as well, such that writes which are dropped from a full log are not lost for good.
     */
-    class SpaceInvadersIO : public IO
+    class SpaceInvadersIO final : public IO
     {
         public:
             explicit SpaceInvadersIO();
@@ -22,17 +35,97 @@ namespace emulator
             virtual byte get(byte port) const override;
             virtual void set(byte port, byte value) override;
 
+            // The buttons of the cabinet, in the order of their bits in InputState.
+            enum Input : byte
+            {
+                // According to https://www.computerarcheology.com/Arcade/SpaceInvaders/
+                // these first three inputs are not actually used by the game's code.
+                Fire,
+                Left,
+                Right,
+
+                CoinInserted,
+                TwoPlayersStart,
+                OnePlayerStart,
+
+                OnePlayerFire,
+                OnePlayerLeft,
+                OnePlayerRight,
+
+                TwoPlayerFire,
+                TwoPlayerLeft,
+                TwoPlayerRight,
+
+                inputCount
+            };
+
+            // The buttons which are pressed, bit i being set if input i is.
+            using InputState = std::uint16_t;
+
+            // Sets whether the key is pressed. Keys unknown to SFML are ignored.
+            void setKeyPressed(sf::Keyboard::Key key, bool pressed);
+
+            // The buttons of which the mapped keys are pressed.
+            InputState getPressedInputs() const;
+
+            // Latches the buttons of which the mapped keys are pressed into the input ports.
+            void latchInput() { latchInput(getPressedInputs()); }
+
+            // Latches the given buttons into the input ports, which the game reads until the next latch.
+            void latchInput(InputState inputs);
+
+            // Latches the bytes of the ports 1 and 2, e.g. as recorded in an InputMovie, such that the game
+            // reads exactly these. Port 0, which the game does not read, has no buttons pressed.
+            void latchInputPorts(byte port1, byte port2);
+
+            // The state of the cabinet which the game observes through the ports, as saved in a SaveState.
+            // The pressed keys and the log of sound writes belong to the host rather than the cabinet.
+            struct State
+            {
+                std::array<byte, 3> inputPorts;
+                byte offset;
+                word shiftRegister;
+                byte port3;
+                byte port5;
+            };
+
+            State getState() const;
+
+            // Restores the state. If the ports of the sounds change, the restored values are logged as writes,
+            // such that the sounds played follow the restored state.
+            void setState(const State& state);
+
+            // A write to a port of the sounds which changed its value.
+            struct SoundWrite
+            {
+                // The machine cycles executed by the cpu before the write (see setCpu), 0 without a cpu.
+                std::size_t time;
+                byte port;
+                byte value;
+            };
+
+            // Sets the cpu by which sound writes are timestamped.
+            void setCpu(const CpuBase* cpu_) { cpu = cpu_; }
+
+            // Removes the oldest logged sound write into write. Returns false if there is none.
+            // May be called on another thread than the cpu, but always the same one.
+            bool popSoundWrite(SoundWrite& write) { return soundWrites.pop(write); }
+
+            // The value last written to port 3 or 5, including writes which were dropped from the log.
+            // May be called on another thread than the cpu.
+            byte getSoundPort(byte port) const
+            {
+                return (port == 3 ? port3 : port5).load(std::memory_order_acquire);
+            }
+
+            // The number of sound writes which the log holds. The game changes the ports a few times per frame.
+            static constexpr std::size_t soundWriteCapacity = 256;
+
             // The space invaders arcade cabinet had some DIP switches (for the owner of the cabinet) 
             // which regulated some of the game options.
             static constexpr bool dip3 = false, dip4 = false, dip5 = false, dip6 = false, dip7 = false;
 
-            static constexpr std::size_t numberOfSounds = 9;
-            static constexpr float soundVolume = 20;
-
         private:
-            byte getPort0() const;
-            byte getPort1() const;
-            byte getPort2() const;
             byte getPort3() const;
 
             void setPort2(byte value);
@@ -41,17 +134,28 @@ namespace emulator
             void setPort5(byte value);
             void setPort6(byte value);
 
-            void handleNonrepeatingSounds(byte value, byte previousValue, std::size_t first, std::size_t number);
+            // Publishes the value of the port, and logs the write if it changes the value last logged.
+            void setSoundPort(byte port, byte value, std::atomic<byte>& portValue, byte& loggedValue);
 
-            std::map<std::string, sf::Keyboard::Key> keyMapping;
+            std::array<sf::Keyboard::Key, inputCount> keyMapping;
+            std::bitset<sf::Keyboard::KeyCount> pressedKeys;
+
+            // The ports 0, 1 and 2 as of the last latch.
+            std::array<byte, 3> inputPorts{};
 
             word shiftRegister = 0;
             byte offset = 0;
 
-            sf::SoundBuffer soundBuffers[numberOfSounds];
-            sf::Sound sounds[numberOfSounds];
+            const CpuBase* cpu = nullptr;
+
+            // Writes which are not popped before the log is full are dropped.
+            SpscQueue<SoundWrite, soundWriteCapacity> soundWrites;
+
+            std::atomic<byte> port3{0};
+            std::atomic<byte> port5{0};
 
-            byte previousPort3Input = 0;
-            byte previousPort5Input = 0;
+            // The values of the last logged writes, which differ from the ports after a write was dropped.
+            byte loggedPort3 = 0;
+            byte loggedPort5 = 0;
     };
 } // namespace emulator
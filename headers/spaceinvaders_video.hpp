@@ -1,14 +1,19 @@
 #pragma once
 
 #include "int_types.hpp"
+#include "memory.hpp"
+#include "triple_buffer.hpp"
+#include "upscaler.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <bitset>
+#include <cstdint>
 #include <memory>
+#include <vector>
 
 namespace emulator
 {
-    class Memory;
-
     /*
         Class for emulating the video system of the space invaders cabinet.
         Handles the interaction between the video buffer in the memory of the i8080 system
@@ -16,45 +21,113 @@ namespace emulator
 
         The video buffer is located at 2400 - 3FFF in the memory. Each bit encodes a pixel being
         either on (1) or off (0).
+
+        The CRT is rotated 90 degrees counter-clockwise in the cabinet, hence a row of the video buffer
+        (crtWidth pixels, 32 bytes) is shown as a column of the frame, from the bottom up. The video buffer is
+        translated into a frame in that orientation (see getFrame). The frame is scaled on the cpu (see Upscaler)
+        into a texture the size of the window, which also holds the border around the frame, so presenting
+        the screen takes a single draw call.
+
+        The pages of the video buffer are watched, such that writes mark the rows which they change.
+        Only rows written since they were last translated are translated again.
+
+        The emulation and the drawing may run on separate threads: the update functions and publishFrame
+        on the thread of the cpu, draw on the thread of the window. Completed frames are passed between
+        them through a triple buffer. Only the columns of a frame which differ from the frame drawn last
+        are scaled and uploaded to the texture.
+
+        The frame holds an index in a small palette per pixel: the background for a pixel that is off,
+        the colour of the overlay at the pixel for one that is on. Only the columns uploaded to the texture
+        are expanded into RGBA pixels, while they are scaled.
+
+        Blocks of 8 rows are translated at once, by transposing the 8x8 bits in each of their columns of bytes.
+        The byte holding the pixels of a row of the frame then selects the mask of its 8 pixels from a table,
+        which keeps the palette indices of the overlay at the pixels that are on.
+
+        Rows are translated from a copy of the video buffer, in which a row is latched when the CRT draws it.
+        Either a half of the screen is latched at once (see updateTopHalf), or every row is latched at the
+        time the beam reaches its scanline (see updateScanline), such that writes in the middle of a frame
+        end up in the frame exactly as on the CRT. The latter also spreads the translation across the frame.
     */
-    class SpaceInvadersVideo
+    class SpaceInvadersVideo : private MemoryWatcher
     {
         public:
-            SpaceInvadersVideo(sf::RenderWindow& window, Memory& memory);
+            // The frame is scaled by scalingFactor with the given filter.
+            SpaceInvadersVideo(sf::RenderWindow& window, Memory& memory,
+                Upscaler::Filter filter = Upscaler::Filter::Nearest);
+            ~SpaceInvadersVideo();
 
-            // Copies/translates the region in the video buffer of the i8080 system that corresponds to the 
-            // rectangle determined by (x, y, width, height) to the SFML/OpenGL texture.
-            // A pixel that is on will be drawn in the forground color, a pixel that is off will be drawn
-            // in the background color.
-            void update(unsigned short x, unsigned short y, unsigned short width, unsigned short height,
-                sf::Color foregroundColor, sf::Color backgroundColor);
+            SpaceInvadersVideo(const SpaceInvadersVideo&) = delete;
+            SpaceInvadersVideo& operator=(const SpaceInvadersVideo&) = delete;
 
             // Reads the part of video memory corresponding to the top half of the CRT
-            // and updates the sfml texture.
+            // and updates the sfml texture. Afterwards the rows of the top half are no longer dirty.
             void updateTopHalf();
 
             // Reads the part of video memory corresponding to the bottom half of the CRT
-            // and updates the sfml texture.
+            // and updates the sfml texture. Afterwards the rows of the bottom half are no longer dirty.
             void updateBottomHalf();
 
-            // Draw the SFML texture to the screen.
-            void draw();
+            // Latches the row of video memory drawn by the CRT at the given scanline, once the beam has
+            // reached its end. A scanline completing a block of 8 rows has the block translated into the frame.
+            // Scanlines from crtHeight on are in the vertical blank and leave the frame unchanged.
+            void updateScanline(unsigned short scanline);
+
+            // Publishes the frame for drawing, once the CRT has drawn it.
+            void publishFrame();
+
+            // Draw the SFML texture to the screen, if a frame has been published since it was last drawn.
+            // The columns of the frame which changed are scaled and uploaded first. The texture covers
+            // the whole window. Returns whether a frame was drawn.
+            bool draw();
+
+            // The colors of the palette of the frame.
+            enum PaletteIndex : byte
+            {
+                Black,
+                White,
+                Red,
+                Green,
+                paletteSize
+            };
+
+            // The translated frame as it is shown on the screen, frameWidth by frameHeight palette indices
+            // stored row by row. Owned by the thread of the cpu.
+            const byte* getFrame() const { return frame.get(); }
+
+            // The RGBA pixel (as the bytes red, green, blue and alpha) of every palette index.
+            const std::array<std::uint32_t, paletteSize>& getPalette() const { return palette; }
 
             // The resolution of the CRT in the space invaders cabinet is 256x224
             static constexpr unsigned short crtWidth = 256;
             static constexpr unsigned short crtHeight = 224;
 
+            // The CRT draws 262 scanlines per frame, of which the first crtHeight show the rows of the
+            // video buffer. The remaining scanlines are the vertical blank.
+            static constexpr unsigned short scanlineCount = 262;
+
             // We scale the 256x244 resolution up by scalingFactor
-            static constexpr float scalingFactor = 3;
+            static constexpr unsigned short scalingFactor = 3;
+
+            // The distance of the scaled frame from the top left corner of the window, and the width
+            // of the border around it.
+            static constexpr unsigned short frameOffset = 50;
+            static constexpr unsigned short borderWidth = 2;
 
             // Optimal size for the SFML window needed to contain the video display.
             // Note that the CRT in the cabinet is rorated 90 degrees. Hence
             // the optimal window width depends on the crt height and vice versa.
-            static constexpr unsigned short optimalWindowWidth = scalingFactor * crtHeight + 100;
-            static constexpr unsigned short optimalWindowHeight = scalingFactor * crtWidth + 100;
+            static constexpr unsigned short optimalWindowWidth = scalingFactor * crtHeight + 2 * frameOffset;
+            static constexpr unsigned short optimalWindowHeight = scalingFactor * crtWidth + 2 * frameOffset;
+
+            // The size of the rotated frame.
+            static constexpr unsigned short frameWidth = crtHeight;
+            static constexpr unsigned short frameHeight = crtWidth;
 
             // The in memory video buffer is located at addresses 2400 - 3FFF
             static constexpr unsigned short videoBufferAddress = 0x2400;
+            static constexpr unsigned short videoBufferSize = crtWidth * crtHeight / 8;
+            static constexpr unsigned short bytesPerRow = crtWidth / 8;
 
             // Constants which encode the coordinates of the colored overlays on the 
             // CRT. Measurements taken from
@@ -69,16 +142,57 @@ namespace emulator
             static constexpr unsigned short bottomWhiteRegionWidth2 = 122;
             static constexpr unsigned short bottomGreenRegionWidth = 86;
         private:
-            void updateCommonPart(unsigned short x, unsigned short y);
+            // Sets the color of the overlay in the rectangle of the video buffer determined by (x, y, width, height).
+            // Throws an EmulatorException if the rectangle does not lie on the CRT, or if x and width
+            // are not multiples of 8 (the pixels of a byte in the video buffer).
+            void setOverlay(unsigned short x, unsigned short y, unsigned short width, unsigned short height,
+                PaletteIndex color);
+            void buildOverlay();
+
+            // Uploads the background and the border around the frame to the texture.
+            void drawBorder();
+
+            // Latches and translates the count rows from first on (both multiples of 8).
+            void updateRows(unsigned short first, unsigned short count);
+
+            // Copies the row from video memory if it is dirty. Afterwards it is no longer dirty, but latched.
+            void latchRow(unsigned short row);
+
+            // Translates the block of 8 rows from blockRow on into the frame if any of them is latched.
+            // A pixel that is on will be drawn in the color of the overlay, a pixel that is off will be drawn in black.
+            // Afterwards the rows are no longer latched.
+            void translateBlock(unsigned short blockRow);
+
+            // Marks the rows of the video buffer which overlap the written bytes as dirty.
+            void onMemoryWritten(std::size_t address, std::size_t size) override;
 
             sf::RenderWindow& window;
 
             sf::Texture texture;
             sf::Sprite sprite;
-            std::unique_ptr<byte[]> videoData;
-            bool textureUpdateRequired = true;
+            std::unique_ptr<byte[]> frame;
+            std::array<std::uint32_t, paletteSize> palette;
+
+            Upscaler upscaler;
+
+            // The changed columns of the frame as scaled RGBA pixels, packed for uploading them to the texture.
+            std::unique_ptr<std::uint32_t[]> uploadData;
+
+            // The color of a pixel that is on, per byte of the video buffer. Stored by column of bytes,
+            // such that the bytes at the same offset in consecutive rows are adjacent, like in the frame.
+            std::vector<byte> overlay;
+
+            // The video buffer as it was when each of its rows was last latched.
+            std::vector<byte> latchedBuffer;
+
+            // The rows written in the video buffer since they were last latched, and the rows latched since they
+            // were last translated.
+            std::bitset<crtHeight> dirtyRows;
+            std::bitset<crtHeight> latchedRows;
 
-            sf::RectangleShape outline;
+            // The published frames, and the frame which is in the texture.
+            TripleBuffer<std::vector<byte>> frames;
+            std::vector<byte> drawnFrame;
 
             Memory& memory;
     };
@@ -0,0 +1,59 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+
+namespace emulator
+{
+    /*
+        Lock-free queue of at most capacity values, through which one thread (the producer) passes values
+        to one other thread (the consumer), such as input from the window to the emulation.
+
+        The positions of the producer and the consumer only ever increase, and are kept on separate
+        cache lines, such that the threads only share a cache line when one reads the position of the other.
+    */
+    template <class T, std::size_t capacity>
+    class SpscQueue
+    {
+        static_assert(capacity != 0 && (capacity & (capacity - 1)) == 0, "The capacity has to be a power of two.");
+
+        public:
+            // Appends the value. Returns false, dropping the value, if the queue is full.
+            // Called by the producer.
+            bool push(const T& value)
+            {
+                std::size_t position = tail.load(std::memory_order_relaxed);
+
+                if (position - head.load(std::memory_order_acquire) == capacity)
+                    return false;
+
+                values[position % capacity] = value;
+                tail.store(position + 1, std::memory_order_release);
+                return true;
+            }
+
+            // Removes the oldest value into value. Returns false if the queue is empty.
+            // Called by the consumer.
+            bool pop(T& value)
+            {
+                std::size_t position = head.load(std::memory_order_relaxed);
+
+                if (position == tail.load(std::memory_order_acquire))
+                    return false;
+
+                value = values[position % capacity];
+                head.store(position + 1, std::memory_order_release);
+                return true;
+            }
+
+        private:
+            static constexpr std::size_t cacheLineSize = 64;
+
+            std::array<T, capacity> values{};
+
+            // The position of the next value to pop, and of the next value to push.
+            alignas(cacheLineSize) std::atomic<std::size_t> head{0};
+            alignas(cacheLineSize) std::atomic<std::size_t> tail{0};
+    };
+} // namespace emulator
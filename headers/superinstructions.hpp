@@ -0,0 +1,70 @@
+#pragma once
+
+#include "int_types.hpp"
+
+#include <cstddef>
+
+namespace emulator
+{
+    /*
+        Sequences of instructions which the fused dispatch method of BasicCpu executes as a single
+        superinstruction: the instructions of a sequence are implemented one after the other
+        (see cpu_superinstructions.inl), without dispatching in between.
+
+        The sequences are the hottest ones in the profiles (see OpcodeProfiler) of invaders.rom and
+        8080EXER.COM, which are listed in the README. Jcc denotes either JNZ or JZ.
+    */
+    enum class Superinstruction : byte
+    {
+        None,
+        DecrementJump,      // DCR r ; Jcc (r is not M)
+        AndJump,            // ANA A ; Jcc
+        LoadAndJump,        // LDA ; ANA A ; Jcc
+        LoadDecrementJump,  // LDA ; DCR A ; Jcc
+        CompareJump,        // CPI ; Jcc
+        LoadIncrement,      // MOV r, M ; INX H
+        StoreIncrement,     // MOV M, r ; INX H
+        CopyIncrement       // LDAX D ; MOV M, A ; INX H
+    };
+
+    constexpr std::size_t superinstructionCount = 8;
+
+    // Is the opcode that of JNZ or JZ?
+    inline bool isZeroJump(byte opCode)
+    {
+        return (opCode & 0xF7) == 0xC2;
+    }
+
+    // Returns the superinstruction starting with an instruction with opcode first,
+    // followed by instructions with opcodes second and third.
+    inline Superinstruction findSuperinstruction(byte first, byte second, byte third)
+    {
+        constexpr byte DCR_A = 0x3D, ANA_A = 0xA7, LDA = 0x3A, CPI = 0xFE, INX_H = 0x23, LDAX_D = 0x1A, MOV_M_A = 0x77;
+
+        if ((first & 0xC7) == 0x05 && first != 0x35 && isZeroJump(second))
+            return Superinstruction::DecrementJump;
+
+        if (first == ANA_A && isZeroJump(second))
+            return Superinstruction::AndJump;
+
+        if (first == LDA && second == ANA_A && isZeroJump(third))
+            return Superinstruction::LoadAndJump;
+
+        if (first == LDA && second == DCR_A && isZeroJump(third))
+            return Superinstruction::LoadDecrementJump;
+
+        if (first == CPI && isZeroJump(second))
+            return Superinstruction::CompareJump;
+
+        if ((first & 0xC7) == 0x46 && first != 0x76 && second == INX_H)
+            return Superinstruction::LoadIncrement;
+
+        if ((first & 0xF8) == 0x70 && first != 0x76 && second == INX_H)
+            return Superinstruction::StoreIncrement;
+
+        if (first == LDAX_D && second == MOV_M_A && third == INX_H)
+            return Superinstruction::CopyIncrement;
+
+        return Superinstruction::None;
+    }
+} // namespace emulator
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+
+namespace emulator
+{
+    /*
+        Lock-free triple buffer, through which one thread (the producer) publishes values such as frames
+        to one other thread (the consumer). Neither thread ever waits for the other: the producer always has
+        a buffer of its own to write, and the consumer always reads the newest published buffer.
+        Values which the consumer does not take before the next one is published are skipped.
+
+        The three buffers are the back buffer (written by the producer), the front buffer (read by the
+        consumer) and the buffer in between, which is exchanged atomically with either of them.
+    */
+    template <class T>
+    class TripleBuffer
+    {
+        public:
+            explicit TripleBuffer(const T& initial = T()): buffers{initial, initial, initial} {}
+
+            TripleBuffer(const TripleBuffer&) = delete;
+            TripleBuffer& operator=(const TripleBuffer&) = delete;
+
+            // The buffer which the producer writes.
+            T& getBackBuffer() { return buffers[back]; }
+
+            // Publishes the back buffer, after which the producer writes another buffer (with older contents).
+            void publish()
+            {
+                back = middle.exchange(back | freshBit, std::memory_order_acq_rel) & indexMask;
+            }
+
+            // Makes the newest published buffer the front buffer, if one was published since the last call.
+            // Returns whether it did.
+            bool update()
+            {
+                if ((middle.load(std::memory_order_relaxed) & freshBit) == 0)
+                    return false;
+
+                front = middle.exchange(front, std::memory_order_acq_rel) & indexMask;
+                return true;
+            }
+
+            // The buffer which the consumer reads.
+            const T& getFrontBuffer() const { return buffers[front]; }
+
+        private:
+            // The buffer in between is tagged with freshBit when it was published and not yet taken.
+            static constexpr unsigned indexMask = 0x03;
+            static constexpr unsigned freshBit = 0x04;
+
+            std::array<T, 3> buffers;
+
+            unsigned back = 0;
+            std::atomic<unsigned> middle{1};
+            unsigned front = 2;
+    };
+} // namespace emulator
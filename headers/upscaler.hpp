@@ -0,0 +1,86 @@
+#pragma once
+
+#include "int_types.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace emulator
+{
+    /*
+        Scales a frame of palette indices by an integer factor into RGBA pixels (4 bytes: red, green, blue
+        and alpha), on the cpu. Drawing the scaled pixels as they are keeps the cost of presenting a frame
+        independent of the graphics driver, which may well render in software.
+
+        The filters are:
+        - Nearest: every index becomes a square of factor x factor pixels.
+        - ScaleNx: the Scale2x or Scale3x algorithm (for a factor of 2 or 3), which smooths the edges of
+          shapes by comparing the indices around a pixel (see https://www.scale2x.it/algorithm).
+        - Scanlines: like Nearest, but the last of the factor pixels of every column is dimmed. On the
+          rotated CRT of the Space Invaders cabinet, its scanlines are the columns of the frame.
+
+        Indices are scaled first, which is cheap since they are bytes. Rows of scaled indices are then
+        expanded into pixels, 16 pixels at a time with the SSSE3 instruction pshufb if the host supports it
+        and the palette (including the dimmed colors) has at most maxShufflePaletteSize colors. Otherwise
+        the colors are looked up one pixel at a time.
+    */
+    class Upscaler
+    {
+        public:
+            enum class Filter
+            {
+                Nearest,
+                ScaleNx,
+                Scanlines
+            };
+
+            // Scales frames of width x height indices into the colors of palette, which has paletteSize entries.
+            // Throws an EmulatorException if the factor is 0, if the filter is ScaleNx and the factor is not 2 or 3,
+            // or if the palette is empty or too large for the filter.
+            Upscaler(unsigned short width, unsigned short height, unsigned short factor, Filter filter,
+                const std::uint32_t* palette, std::size_t paletteSize);
+
+            // Scales the columns from first up to end of frame (stored row by row) into output, starting at its
+            // first pixel: column x of the frame becomes the factor columns from (x - first) * factor on.
+            // The rows of output are pitch pixels apart.
+            void scale(const byte* frame, unsigned short first, unsigned short end, std::uint32_t* output,
+                std::size_t pitch);
+
+            // The number of columns on either side of a column of the frame, of which the scaled pixels
+            // depend on that column. When a column changes, these have to be scaled again as well.
+            unsigned short getReach() const { return filter == Filter::ScaleNx ? 1 : 0; }
+
+            unsigned short getFactor() const { return factor; }
+            Filter getFilter() const { return filter; }
+
+        private:
+            // Scales row y of the frame into factor rows of indices, (end - first) * factor indices each.
+            void scaleNearest(const byte* frame, unsigned short y, unsigned short first, unsigned short end);
+            void scale2x(const byte* frame, unsigned short y, unsigned short first, unsigned short end);
+            void scale3x(const byte* frame, unsigned short y, unsigned short first, unsigned short end);
+
+            // pshufb looks up 16 indices in a table of 16 bytes, hence every byte of the colors
+            // of such a palette is looked up at once.
+            static constexpr std::size_t maxShufflePaletteSize = 16;
+
+            // Writes the colors of count indices into pixels.
+            void expand(const byte* indices, std::size_t count, std::uint32_t* pixels) const;
+
+            unsigned short width;
+            unsigned short height;
+            unsigned short factor;
+            Filter filter;
+
+            // For the Scanlines filter, the colors are followed by the dimmed colors.
+            std::vector<std::uint32_t> colors;
+
+            // Whether pixels are expanded with pshufb, from colorBytes: byte i of color c is colorBytes[i][c].
+            bool shuffle = false;
+            std::array<std::array<byte, maxShufflePaletteSize>, 4> colorBytes{};
+
+            // The scaled indices of a row of the frame, factor rows of width * factor indices.
+            std::vector<byte> scaledRows;
+    };
+} // namespace emulator
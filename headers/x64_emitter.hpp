@@ -0,0 +1,201 @@
+#pragma once
+
+#include "int_types.hpp"
+
+#include <cstddef>
+#include <cstdint>
+
+namespace emulator
+{
+    /*
+        Minimal emitter of x86-64 machine code, used by the JitCpu.
+        Only supports the instructions and addressing modes needed to translate intel 8080 code.
+    */
+    namespace x64
+    {
+        // General purpose registers, numbered as in the instruction encoding.
+        enum Register : byte
+        {
+            RAX, RCX, RDX, RBX, RSP, RBP, RSI, RDI,
+            R8, R9, R10, R11, R12, R13, R14, R15
+        };
+
+        // As a byte register the encoding of RSP denotes AH, provided the instruction has no REX prefix.
+        // The byte instructions below only emit a REX prefix for the registers R8 through R15,
+        // hence AL, CL, DL, BL and AH are the only byte registers that can be used with them,
+        // and AH can not be combined with a memory operand based on R8 through R15.
+        constexpr Register AH = RSP;
+
+        // Memory operand of the form [base + index * 2^scale + displacement].
+        struct Address
+        {
+            Register base;
+            bool hasIndex;
+            Register index;
+            byte scale;
+            std::int32_t displacement;
+        };
+
+        inline Address at(Register base, std::int32_t displacement = 0)
+        {
+            return {base, false, RAX, 0, displacement};
+        }
+
+        inline Address at(Register base, Register index, byte scale, std::int32_t displacement = 0)
+        {
+            return {base, true, index, scale, displacement};
+        }
+
+        // Condition codes, named after the flag they test.
+        enum class Condition : byte
+        {
+            Carry = 0x2,
+            NotCarry = 0x3,
+            Zero = 0x4,
+            NotZero = 0x5,
+            Above = 0x7     // Neither carry nor zero, that is unsigned greater than.
+        };
+
+        // Arithmetic and logic operations, numbered as in the instruction encoding.
+        enum class Operation : byte
+        {
+            Add, Or, Adc, Sbb, And, Sub, Xor, Cmp
+        };
+
+        // Shift and rotate operations, numbered as in the instruction encoding.
+        enum class Shift : byte
+        {
+            Rol, Ror, Rcl, Rcr, Shl, Shr
+        };
+
+        /*
+            Memory allocated from the operating system into which code is written and then executed.
+            The memory is either writable or executable but never both, as systems with a W^X policy
+            (such as SELinux denying execmem, PaX or OpenBSD) refuse memory which is.
+        */
+        class CodeBuffer
+        {
+            public:
+                // Allocates size bytes of writable memory. If the memory can not be allocated, or the system
+                // refuses to make it executable, the buffer is empty (getSize is 0).
+                explicit CodeBuffer(std::size_t size);
+                ~CodeBuffer();
+
+                // Makes the pages holding the length bytes at offset executable (and no longer writable),
+                // or writable (and no longer executable). Throws an EmulatorException if the system refuses.
+                void setExecutable(std::size_t offset, std::size_t length, bool executable);
+
+                CodeBuffer(const CodeBuffer&) = delete;
+                CodeBuffer& operator=(const CodeBuffer&) = delete;
+
+                byte* getData() const { return data; }
+                std::size_t getSize() const { return size; }
+
+            private:
+                byte* data = nullptr;
+                std::size_t size = 0;
+                std::size_t pageSize = 0;
+        };
+
+        /*
+            Appends instructions to a CodeBuffer.
+            Throws an EmulatorException if an instruction does not fit in the buffer.
+        */
+        class Emitter
+        {
+            public:
+                // Position of the 32 bit displacement of a forward jump, which is filled in by bind.
+                struct Label
+                {
+                    std::size_t position;
+                };
+
+                explicit Emitter(CodeBuffer& buffer);
+
+                const byte* getPosition() const { return buffer.getData() + size; }
+                std::size_t getSize() const { return size; }
+                std::size_t getFreeSpace() const { return buffer.getSize() - size; }
+
+                // Discards everything emitted after the given size.
+                void rewind(std::size_t size_) { size = size_; }
+
+                void movzxByte(Register destination, const Address& source);
+                void movzxWord(Register destination, const Address& source);
+                void movByte(const Address& destination, Register source);
+                void movByte(const Address& destination, byte value);
+                void movWord(const Address& destination, Register source);
+                void movWord(const Address& destination, word value);
+                void movDouble(Register destination, Register source);
+                void movDouble(Register destination, std::uint32_t value);
+                void movQuad(Register destination, Register source);
+                void movQuad(Register destination, const Address& source);
+                void movQuad(const Address& destination, Register source);
+                void movQuad(Register destination, std::uint64_t value);
+
+                void byteOperation(Operation operation, Register destination, Register source);
+                void byteOperation(Operation operation, Register destination, const Address& source);
+                void byteOperation(Operation operation, const Address& destination, Register source);
+                void byteOperation(Operation operation, Register destination, byte value);
+                void byteOperation(Operation operation, const Address& destination, byte value);
+                void wordOperation(Operation operation, Register destination, Register source);
+                void wordOperation(Operation operation, const Address& destination, std::int8_t value);
+                void doubleOperation(Operation operation, Register destination, Register source);
+                void doubleOperation(Operation operation, Register destination, std::int32_t value);
+                void quadOperation(Operation operation, Register destination, const Address& source);
+                void quadOperation(Operation operation, Register destination, std::int32_t value);
+
+                // Shifts or rotates a byte register by one bit.
+                void shiftByte(Shift shift, Register destination);
+                void shiftDouble(Shift shift, Register destination, byte count);
+
+                void incrementByte(const Address& destination);
+                void decrementByte(const Address& destination);
+                void incrementWord(const Address& destination);
+                void decrementWord(const Address& destination);
+                void notByte(const Address& destination);
+
+                void testByte(const Address& destination, byte value);
+                void testDouble(Register destination, Register source);
+                void setCondition(Condition condition, Register destination);
+
+                // Loads the sign, zero, auxiliary carry, parity and carry flags into AH.
+                void lahf();
+
+                // Forward jumps, of which the target is the position at which the label is bound.
+                Label jump();
+                Label jump(Condition condition);
+                void bind(Label label);
+
+                void jump(const void* target);
+                void jump(Condition condition, const void* target);
+                void jump(Register target);
+                void jump(const Address& target);
+                void call(Register target);
+
+                void push(Register source);
+                void pop(Register destination);
+                void ret();
+
+            private:
+                void emitByte(byte value);
+                void emitWord(word value);
+                void emitDouble(std::uint32_t value);
+                void emitQuad(std::uint64_t value);
+
+                // Emits the REX prefix if it is needed, for an instruction with a register and a memory operand,
+                // or with two register operands (of which destination is encoded in the r/m field).
+                void emitRex(bool wide, Register reg, const Address& address);
+                void emitRex(bool wide, Register reg, Register destination);
+
+                // Emits the ModRM byte and, if needed, the SIB byte and the displacement.
+                void emitOperand(byte reg, const Address& address);
+                void emitOperand(byte reg, Register destination);
+
+                // Emits the 32 bit displacement from the end of the instruction to the target.
+                void emitRelative(const void* target);
+
+                CodeBuffer& buffer;
+                std::size_t size = 0;
+        };
+    } // namespace x64
+} // namespace emulator
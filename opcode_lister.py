@@ -562,7 +562,7 @@ def generate_arguments_table(arguments):
     return arguments_table_string
 
 # Generate the C++ table containing the lengths of the instructions (sorted by opcode).
-def generate_lengths_table():
+def generate_lengths_table(lengths):
     lengths_table_string = "const byte instructionLengths[] = {\n"
 
     for i in range(255):
@@ -572,6 +572,17 @@ def generate_lengths_table():
     lengths_table_string += "};"
     return lengths_table_string
 
+# Generate a C++ table containing the number of machine cycles of the instructions (sorted by opcode).
+def generate_cycles_table(name, cycles):
+    cycles_table_string = f"const byte {name}[] = {{\n"
+
+    for i in range(255):
+        cycles_table_string += f"{cycles[i]},\n"
+    cycles_table_string += f"{cycles[255]}\n"
+
+    cycles_table_string += "};"
+    return cycles_table_string
+
 def main():
     # first we split the table into 16 rows. Each row starts with a 1 digit hexadecimal number.
     # we use this to as a parttern for the splitting.
@@ -584,6 +595,10 @@ def main():
     # the table consists of 16 x 16 entries. Sanity check that we found 16 rows.
     assert len(split_string) == 16, "Expected to find 16 opcode groups"
 
+    # Regex for matching the length and number of machine cycles of an opcode.
+    # Conditional calls and returns list the cycles with and without the condition met, e.g. 17/11.
+    timing_regex = re.compile("^([1-3])\s+([0-9]+)(?:/([0-9]+))?$", re.MULTILINE)
+
     # Regex for matching an individual opcode + arguments
     instruction_regex = re.compile("([A-Z*]{2,4})\s+([BCDEHLMA]|PSW|SP)?,?(a16|d8|d16|[BCDEHLMA])?")
 
@@ -594,6 +609,8 @@ def main():
     nmemonics = {}
     arguments = {}
     lengths = {}
+    cycles = {}
+    cycles_condition_not_met = {}
 
     # Some instructions in the table that act on double (word) registers
     # have the associated register listed by the sort name (i.e. B, D, H).
@@ -611,6 +628,15 @@ def main():
 
         assert len(instruction_matches) == 16, "Expected to find 16 opcode in a group"
 
+        timing_matches = re.findall(timing_regex, part)
+
+        assert len(timing_matches) == 16, "Expected to find 16 timings in a group"
+
+        for j, timing_match in enumerate(timing_matches):
+            opcode = i << 4 | j
+            cycles[opcode] = int(timing_match[1])
+            cycles_condition_not_met[opcode] = int(timing_match[2]) if timing_match[2] else cycles[opcode]
+
         for j, instruction_match in enumerate(instruction_matches):
             opcode = i << 4 | j
 
@@ -663,6 +689,9 @@ def main():
 
     assert len(nmemonics) == 256, "Expected to find 256 instructions total"
 
+    # The table lists 5 cycles for XCHG, the intel 8080 manual lists 4.
+    cycles[0xEB] = cycles_condition_not_met[0xEB] = 4
+
     print(generate_nmemonics_table(nmemonics))
     print()
 
@@ -670,6 +699,12 @@ def main():
     print()
 
     print(generate_lengths_table(lengths))
+    print()
+
+    print(generate_cycles_table("instructionCycles", cycles))
+    print()
+
+    print(generate_cycles_table("instructionCyclesConditionNotMet", cycles_condition_not_met))
 
 if __name__ == "__main__":
     main()
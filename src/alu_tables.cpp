@@ -0,0 +1,130 @@
+#include "alu_tables.hpp"
+
+namespace emulator
+{
+    namespace alu
+    {
+        namespace
+        {
+            // The generators below compute the flags in exactly the same way as the intel 8080 does,
+            // see the comments in Cpu::executeADD, Cpu::executeSUB and Cpu::executeDAA.
+
+            constexpr byte computeZSPFlags(byte result)
+            {
+                byte parity = 0;
+                for (byte value = result; value != 0; value >>= 1)
+                    parity ^= value & 0x01;
+
+                // For the parity bit, 1 indicates even parity.
+                return (result == 0 ? zeroFlag : 0) | (result & signFlag) | (parity == 0 ? parityFlag : 0);
+            }
+
+            constexpr byte computeAddFlags(byte accumulator, byte operand, byte carry)
+            {
+                byte result = accumulator + operand + carry;
+                bool CY = (accumulator + operand + carry) > 0xFF;
+                bool CA = ((accumulator & 0x0F) + (operand & 0x0F) + carry) > 0x0F;
+
+                return computeZSPFlags(result) | (CA ? auxiliaryCarryFlag : 0) | (CY ? carryFlag : 0);
+            }
+
+            constexpr byte computeSubtractFlags(byte accumulator, byte operand, byte carry)
+            {
+                byte result = accumulator - operand - carry;
+                bool CY = (operand + carry) > accumulator;
+                bool CA = ((accumulator & 0x0F) + ((~operand) & 0x0F) + !carry) > 0x0F;
+
+                return computeZSPFlags(result) | (CA ? auxiliaryCarryFlag : 0) | (CY ? carryFlag : 0);
+            }
+
+            constexpr std::array<byte, 0x100> generateZSPFlags()
+            {
+                std::array<byte, 0x100> table{};
+                for (std::size_t i = 0; i < table.size(); ++i)
+                    table[i] = computeZSPFlags(static_cast<byte>(i));
+                return table;
+            }
+
+            template <class Function>
+            constexpr std::array<byte, 0x20000> generateArithmeticFlags(Function computeFlags)
+            {
+                std::array<byte, 0x20000> table{};
+                for (std::size_t i = 0; i < table.size(); ++i)
+                {
+                    byte carry = static_cast<byte>(i >> 16);
+                    byte accumulator = static_cast<byte>(i >> 8);
+                    byte operand = static_cast<byte>(i);
+                    table[i] = computeFlags(accumulator, operand, carry);
+                }
+                return table;
+            }
+
+            constexpr std::array<byte, 0x100> generateIncrementFlags()
+            {
+                std::array<byte, 0x100> table{};
+                for (std::size_t i = 0; i < table.size(); ++i)
+                {
+                    byte value = static_cast<byte>(i);
+                    bool CA = (value & 0x0F) == 0x0F;
+                    table[i] = computeZSPFlags(value + 1) | (CA ? auxiliaryCarryFlag : 0);
+                }
+                return table;
+            }
+
+            constexpr std::array<byte, 0x100> generateDecrementFlags()
+            {
+                std::array<byte, 0x100> table{};
+                for (std::size_t i = 0; i < table.size(); ++i)
+                {
+                    byte value = static_cast<byte>(i);
+                    bool CA = (value & 0x0F) != 0;
+                    table[i] = computeZSPFlags(value - 1) | (CA ? auxiliaryCarryFlag : 0);
+                }
+                return table;
+            }
+
+            constexpr std::array<DecimalAdjustment, 0x400> generateDecimalAdjustments()
+            {
+                std::array<DecimalAdjustment, 0x400> table{};
+                for (std::size_t i = 0; i < table.size(); ++i)
+                {
+                    byte accumulator = static_cast<byte>(i);
+                    bool carry = (i >> 8) & 0x01;
+                    bool auxiliaryCarry = (i >> 9) & 0x01;
+
+                    byte correction = 0;
+                    if ((accumulator & 0x0F) >= 0x0A || auxiliaryCarry)
+                        correction += 0x06;
+
+                    bool CY = carry;
+                    if ((accumulator & 0xF0) >= 0xA0 || 
+                        ((accumulator & 0xF0) == 0x90 && ((accumulator & 0x0F) >= 0x0A)) ||
+                        carry)
+                    {
+                        correction += 0x60;
+                        CY = true;
+                    }
+
+                    // The correction is added as an ADD instruction, except that the carry flag
+                    // is unaffected if no carry out of the highest 4 bits occurs.
+                    byte flags = computeAddFlags(accumulator, correction, 0);
+                    flags = (flags & ~carryFlag) | (CY ? carryFlag : 0);
+
+                    table[i].result = accumulator + correction;
+                    table[i].flags = flags;
+                }
+                return table;
+            }
+        }
+
+        constexpr std::array<byte, 0x100> zspFlags = generateZSPFlags();
+
+        constexpr std::array<byte, 0x20000> addFlags = generateArithmeticFlags(computeAddFlags);
+        constexpr std::array<byte, 0x20000> subtractFlags = generateArithmeticFlags(computeSubtractFlags);
+
+        constexpr std::array<byte, 0x100> incrementFlags = generateIncrementFlags();
+        constexpr std::array<byte, 0x100> decrementFlags = generateDecrementFlags();
+
+        constexpr std::array<DecimalAdjustment, 0x400> decimalAdjustments = generateDecimalAdjustments();
+    } // namespace alu
+} // namespace emulator
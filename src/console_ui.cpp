@@ -11,6 +11,7 @@
 using Color = console::Color;
 
 #include <regex>
+#include <set>
 
 namespace emulator
 {
@@ -449,15 +450,15 @@ namespace emulator
         drawRegister("A", state.A, x, y);
 
         x += 4;
-        drawFlag("Z", state.Z, x, y);
+        drawFlag("Z", state.getZ(), x, y);
         x += 3;
-        drawFlag("S", state.S, x, y);
+        drawFlag("S", state.getS(), x, y);
         x += 3;
-        drawFlag("P", state.P, x, y);
+        drawFlag("P", state.getP(), x, y);
         x += 3;
-        drawFlag("CY", state.CY, x, y);
+        drawFlag("CY", state.getCY(), x, y);
         x += 3;
-        drawFlag("CA", state.CA, x, y);
+        drawFlag("CA", state.getCA(), x, y);
         
         x = 0;
         y = 2;
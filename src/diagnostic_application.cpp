@@ -28,19 +28,19 @@ namespace emulator
 
             if (state == State::CpuRunning)
             {
-                for (std::size_t i = 0; i < 10000 && state == State::CpuRunning; ++i)
-                {
-                    cpu.executeInstructionCycle();
-
-                    if (cpu.getState().halted)
-                    {
-                        cpu.resume();
-                        state = State::CpuPaused;
-                        continue;
-                    }
+                // Returns early when a breakpoint or one of the traps set in beginTest is reached.
+                cpu.run(machineCyclesPerUpdate);
 
-                    handleTestIO();
+                if (cpu.getState().halted)
+                {
+                    cpu.resume();
+                    state = State::CpuPaused;
+                    continue;
                 }
+
+                // The cpu has executed at least one instruction, so the program counter is checked
+                // even if it equals the previous one (e.g. for two consecutive calls to the BDOS).
+                handleTraps();
             }
         }
     }
@@ -58,6 +58,10 @@ namespace emulator
 
         memory[0x0005] = 0xC9;
 
+        // Running stops at the warm boot and BDOS entry points of CP/M, which are handled in handleTraps.
+        cpu.addTrap(0x0000);
+        cpu.addTrap(0x0005);
+
         cpu.setProgramCounter(0x100);
 
         consoleUI.draw();
@@ -72,6 +76,13 @@ namespace emulator
         if (pc == previousPC)
             return;
 
+        handleTraps();
+    }
+
+    void DiagnosticApplication::handleTraps()
+    {
+        word pc = cpu.getState().PC;
+
         if (pc == 0x0000)
         {
             console.getScreenBuffer(1).write("\nProgram terminated\n\n\n");
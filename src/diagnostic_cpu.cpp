@@ -1,5 +1,6 @@
 #include "diagnostic_cpu.hpp"
 
+#include "cpu_impl.hpp"
 #include "emulator_exception.hpp"
 
 #include <fstream>
@@ -19,30 +20,56 @@ namespace emulator
 
         return Cpu::executeInstructionCycle();
     }
+
+    std::size_t DiagnosticCpu::run(std::size_t machineCycles)
+    {
+        std::size_t executedCycles = runUntil(machineCycles, [this](const CpuState& cpuState)
+        {
+            if (profiler != nullptr)
+                profiler->record(memory.get(cpuState.PC));
+
+            return breakpoints[cpuState.PC] || traps[cpuState.PC];
+        });
+
+        if (isBreakpoint(state.PC))
+            halt();
+
+        return executedCycles;
+    }
     
     void DiagnosticCpu::addBreakpoint(word address)
     {
-        breakpoints.insert(address);
+        breakpoints.set(address);
     }
 
     void DiagnosticCpu::removeBreakpoint(word address)
     {
-        breakpoints.erase(address);
+        breakpoints.reset(address);
     }
 
     void DiagnosticCpu::toggleBreakpoint(word address)
     {
-        std::set<word>::iterator i = breakpoints.find(address);
+        breakpoints.flip(address);
+    }
+
+    bool DiagnosticCpu::isBreakpoint(word address) const
+    {
+        return breakpoints[address];
+    }
 
-        if (i == breakpoints.end())
-            breakpoints.insert(address);           
-        else
-            breakpoints.erase(i);  
+    void DiagnosticCpu::addTrap(word address)
+    {
+        traps.set(address);
     }
 
-    bool DiagnosticCpu::isBreakpoint(word address)
+    void DiagnosticCpu::removeTrap(word address)
     {
-        return breakpoints.count(address) != 0;
+        traps.reset(address);
+    }
+
+    bool DiagnosticCpu::isTrap(word address) const
+    {
+        return traps[address];
     }
 
     void DiagnosticCpu::saveBreakpoints(const std::string& path)
@@ -52,8 +79,11 @@ namespace emulator
         if (!file)
             throw EmulatorException("Unable to open file " + path + " in DiagnosticCpu::saveBreakpoints.");
 
-        for (word address : breakpoints)
-            file << address << ' ';
+        for (std::size_t address = 0; address < breakpoints.size(); ++address)
+        {
+            if (breakpoints[address])
+                file << address << ' ';
+        }
     }
 
     void DiagnosticCpu::loadBreakpoints(const std::string& path)
@@ -63,11 +93,11 @@ namespace emulator
         if (!file)
             throw EmulatorException("Unable to open file " + path + " in DiagnosticCpu::loadBreakpoints.");
 
-        breakpoints.clear();
+        breakpoints.reset();
         word address;
         while (file >> address)
         {
-            breakpoints.insert(breakpoints.end(), address);
+            breakpoints.set(address);
         }
     }
 } // namespace emulator
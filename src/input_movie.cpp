@@ -0,0 +1,108 @@
+#include "input_movie.hpp"
+
+#include "emulator_exception.hpp"
+
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+namespace emulator
+{
+    namespace
+    {
+        constexpr char magic[8] = {'I', '8', '0', '8', '0', 'M', 'O', 'V'};
+
+        // The longest run of frames in the file.
+        constexpr std::size_t maxRunLength = 0xFFFF;
+
+        void writeNumber(std::vector<byte>& data, std::uint64_t value, std::size_t size)
+        {
+            for (std::size_t i = 0; i < size; ++i)
+                data.push_back(static_cast<byte>(value >> (8 * i)));
+        }
+
+        std::uint64_t readNumber(const std::vector<byte>& data, std::size_t& offset, std::size_t size)
+        {
+            std::uint64_t value = 0;
+
+            for (std::size_t i = 0; i < size; ++i)
+                value |= static_cast<std::uint64_t>(data[offset + i]) << (8 * i);
+
+            offset += size;
+            return value;
+        }
+    } // namespace
+
+    InputMovie::InputMovie(std::uint64_t romHash_): romHash(romHash_)
+    {}
+
+    void InputMovie::save(const std::string& path) const
+    {
+        std::vector<byte> data(std::begin(magic), std::end(magic));
+        writeNumber(data, version, 2);
+        writeNumber(data, romHash, 8);
+
+        for (std::size_t frame = 0; frame < frames.size();)
+        {
+            std::size_t end = frame + 1;
+            while (end < frames.size() && end - frame < maxRunLength &&
+                frames[end].port1 == frames[frame].port1 && frames[end].port2 == frames[frame].port2)
+            {
+                ++end;
+            }
+
+            writeNumber(data, end - frame, 2);
+            data.push_back(frames[frame].port1);
+            data.push_back(frames[frame].port2);
+
+            frame = end;
+        }
+
+        std::ofstream file(path, std::ios::out | std::ios::binary);
+        file.write(reinterpret_cast<const char*>(data.data()), data.size());
+
+        if (!file)
+            throw EmulatorException("Unable to write file " + path + " in InputMovie::save.");
+    }
+
+    InputMovie InputMovie::load(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary);
+
+        if (!file)
+            throw EmulatorException("Unable to open file " + path + " in InputMovie::load.");
+
+        std::vector<byte> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        constexpr std::size_t headerSize = sizeof(magic) + 2 + 8;
+        constexpr std::size_t runSize = 4;
+
+        if (data.size() < headerSize || std::memcmp(data.data(), magic, sizeof(magic)) != 0 ||
+            (data.size() - headerSize) % runSize != 0)
+        {
+            throw EmulatorException("The file " + path + " is not an input movie in InputMovie::load.");
+        }
+
+        std::size_t offset = sizeof(magic);
+        std::uint64_t fileVersion = readNumber(data, offset, 2);
+
+        if (fileVersion != version)
+        {
+            throw EmulatorException("The input movie " + path + " has version " + std::to_string(fileVersion) +
+                " instead of " + std::to_string(version) + " in InputMovie::load.");
+        }
+
+        InputMovie movie(readNumber(data, offset, 8));
+
+        while (offset < data.size())
+        {
+            std::size_t length = static_cast<std::size_t>(readNumber(data, offset, 2));
+            Frame frame{data[offset], data[offset + 1]};
+            offset += 2;
+
+            movie.frames.insert(movie.frames.end(), length, frame);
+        }
+
+        return movie;
+    }
+} // namespace emulator
@@ -0,0 +1,958 @@
+#include "jit_cpu.hpp"
+
+#include "cpu_impl.hpp"
+#include "alu_tables.hpp"
+#include "opcode_info.hpp"
+
+#include <algorithm>
+#include <cstddef>
+
+namespace emulator
+{
+    template class BasicCpu<Memory, IO, UncheckedPolicy>;
+
+    namespace
+    {
+        using namespace x64;
+
+        // Registers which hold the same value for as long as the translated code runs.
+        // All of them are preserved across calls in both the System V and the Windows calling convention.
+        constexpr Register contextRegister = RBX;
+        constexpr Register pageTableRegister = RBP;
+        constexpr Register blocksRegister = R12;
+        constexpr Register pageWatchCountsRegister = R13;
+        constexpr Register instructionsRegister = R14;
+        constexpr Register machineCyclesRegister = R15;
+
+        #if defined(_WIN32)
+            constexpr Register argumentRegisters[] = {RCX, RDX, R8};
+            constexpr Register savedRegisters[] = {RBX, RBP, RSI, RDI, R12, R13, R14, R15};
+            // Aligns the stack to 16 bytes and reserves the shadow space of the called helper.
+            constexpr std::int32_t stackSpace = 40;
+        #else
+            constexpr Register argumentRegisters[] = {RDI, RSI, RDX};
+            constexpr Register savedRegisters[] = {RBX, RBP, R12, R13, R14, R15};
+            // Aligns the stack to 16 bytes.
+            constexpr std::int32_t stackSpace = 8;
+        #endif
+
+        constexpr std::size_t codeBufferSize = EMULATOR_JIT_SUPPORTED ? 16 * 1024 * 1024 : 0;
+
+        // Blocks are limited in length, such that the budget of machine cycles is checked regularly.
+        constexpr std::uint32_t maxBlockInstructions = 64;
+
+        // Upper bound of the size of the code of a block, no instruction translates into more than 256 bytes.
+        constexpr std::size_t maxBlockCodeSize = (maxBlockInstructions + 2) * 256;
+
+        // Displacement of the write table from the read table in Memory::PageTable.
+        constexpr std::int32_t writeTableOffset = offsetof(Memory::PageTable, write);
+
+        // Whether the instruction is a jump, call, return or restart, which ends a block.
+        bool endsBlock(byte opCode)
+        {
+            switch (opCode & 0xC7)
+            {
+                case 0xC0: case 0xC2: case 0xC4: case 0xC7:
+                    return true;
+            }
+
+            switch (opCode)
+            {
+                case 0xC3: case 0xCB: case 0xCD: case 0xDD: case 0xED: case 0xFD: case 0xC9: case 0xD9: case 0xE9:
+                    return true;
+            }
+
+            return false;
+        }
+
+        // Masks of the flags tested by the conditional instructions, indexed by bits 4 and 5 of the opcode.
+        // Bit 3 of the opcode determines whether the condition is met if the flag is set or if it is not set.
+        constexpr byte conditionFlags[] = {alu::zeroFlag, alu::carryFlag, alu::parityFlag, alu::signFlag};
+
+        static_assert(sizeof(alu::DecimalAdjustment) == 2 && offsetof(alu::DecimalAdjustment, result) == 0 &&
+            offsetof(alu::DecimalAdjustment, flags) == 1, "The translated DAA instruction indexes the table by bytes.");
+    }
+
+    // Addresses of the fields of the context, relative to the context register.
+    #define FIELD(name) x64::at(contextRegister, static_cast<std::int32_t>(offsetof(Context, name)))
+
+    JitCpu::JitCpu(Memory& memory_, IO& io_):
+        BasicCpu(memory_, io_), codeBuffer(codeBufferSize), emitter(codeBuffer),
+        blocks(0x10000), blockEnds(0x10000), pageBlocks(Memory::pageCount)
+    {
+        context.pageTable = &memory.getPageTable();
+        context.blocks = blocks.data();
+        context.pageWatchCounts = memory.getPageWatchCounts();
+        context.cpu = this;
+
+        #if EMULATOR_JIT_SUPPORTED
+            // Without executable memory all code is interpreted.
+            if (codeBuffer.getSize() != 0)
+            {
+                emitStubs();
+                codeBuffer.setExecutable(0, codeBuffer.getSize(), true);
+            }
+        #endif
+
+        std::fill(blocks.begin(), blocks.end(), exitCode);
+        memory.addWatcher(this);
+    }
+
+    JitCpu::~JitCpu()
+    {
+        flush();
+        memory.removeWatcher(this);
+    }
+
+    std::size_t JitCpu::run(std::size_t machineCycles)
+    {
+        #if EMULATOR_JIT_SUPPORTED
+            if (enterCode == nullptr)
+                return BasicCpu::run(machineCycles);
+
+            std::size_t previousExecutedMachineCycles = executedMachineCycles;
+            std::size_t targetMachineCycles = executedMachineCycles + machineCycles;
+
+            while (!state.halted && executedMachineCycles < targetMachineCycles)
+            {
+                const void* code = blocks[state.PC];
+
+                if (code == exitCode)
+                    code = translate(state.PC);
+
+                if (code != nullptr)
+                {
+                    std::size_t previousMachineCycles = executedMachineCycles;
+                    enter(code, targetMachineCycles);
+
+                    if (executedMachineCycles != previousMachineCycles)
+                        continue;
+                }
+
+                // The instruction can not be translated or the block does not fit in the remaining budget.
+                BasicCpu::executeInstructionCycle();
+            }
+
+            skipHaltedMachineCycles(targetMachineCycles);
+
+            return executedMachineCycles - previousExecutedMachineCycles;
+        #else
+            return BasicCpu::run(machineCycles);
+        #endif
+    }
+
+    void JitCpu::flush()
+    {
+        for (std::size_t page = 0; page < pageBlocks.size(); ++page)
+        {
+            if (!pageBlocks[page].empty())
+            {
+                pageBlocks[page].clear();
+                memory.unwatchPage(page);
+            }
+        }
+
+        std::fill(blocks.begin(), blocks.end(), exitCode);
+        emitter.rewind(stubsSize);
+    }
+
+    void JitCpu::onMemoryWritten(std::size_t address, std::size_t size)
+    {
+        std::size_t firstPage = address / Memory::pageSize;
+        std::size_t lastPage = std::min((address + size - 1) / Memory::pageSize, Memory::pageCount - 1);
+
+        for (std::size_t page = firstPage; page <= lastPage; ++page)
+        {
+            std::vector<word>& starts = pageBlocks[page];
+
+            // invalidateBlock removes the block from the list, so the index is only advanced if it is kept.
+            for (std::size_t i = 0; i < starts.size(); )
+            {
+                word start = starts[i];
+
+                if (start < address + size && address < blockEnds[start])
+                    invalidateBlock(start);
+                else
+                    ++i;
+            }
+        }
+    }
+
+    void JitCpu::invalidateBlock(word address)
+    {
+        blocks[address] = exitCode;
+
+        std::size_t lastPage = (blockEnds[address] - 1) / Memory::pageSize;
+        for (std::size_t page = address / Memory::pageSize; page <= lastPage; ++page)
+        {
+            std::vector<word>& starts = pageBlocks[page];
+            starts.erase(std::remove(starts.begin(), starts.end(), address), starts.end());
+
+            if (starts.empty())
+                memory.unwatchPage(page);
+        }
+
+        ++invalidatedBlockCount;
+    }
+
+    #if EMULATOR_JIT_SUPPORTED
+        void JitCpu::enter(const void* code, std::size_t targetMachineCycles)
+        {
+            context.A = state.A;
+            context.B = state.B;
+            context.C = state.C;
+            context.D = state.D;
+            context.E = state.E;
+            context.H = state.H;
+            context.L = state.L;
+            context.F = state.packFlags();
+            context.SP = state.SP;
+            context.PC = state.PC;
+            context.interruptsEnabled = state.interruptsEnabled;
+            context.executedInstructionCycles = executedInstructionCycles;
+            context.executedMachineCycles = executedMachineCycles;
+            context.targetMachineCycles = targetMachineCycles;
+
+            enterCode(&context, code);
+
+            state.A = context.A;
+            state.B = context.B;
+            state.C = context.C;
+            state.D = context.D;
+            state.E = context.E;
+            state.H = context.H;
+            state.L = context.L;
+            state.unpackFlags(context.F);
+            state.SP = context.SP;
+            state.PC = context.PC;
+            state.interruptsEnabled = context.interruptsEnabled != 0;
+            executedInstructionCycles = context.executedInstructionCycles;
+            executedMachineCycles = context.executedMachineCycles;
+        }
+
+        const void* JitCpu::translate(word address)
+        {
+            if (!isTranslatable(address))
+                return nullptr;
+
+            if (emitter.getFreeSpace() < maxBlockCodeSize)
+                flush();
+
+            // The code is never writable while it may run, only the pages the block is written to are made
+            // writable, which leaves the other blocks and the stubs executable.
+            std::size_t codeOffset = emitter.getSize();
+            codeBuffer.setExecutable(codeOffset, maxBlockCodeSize, false);
+
+            const void* code = emitter.getPosition();
+
+            // The block only runs if it can not exceed the budget, the remaining instructions are interpreted.
+            // Hence the cpu stops at the same instruction as the interpreter does, which keeps the timing of
+            // interrupts identical. The program counter in the context already holds the address of this block
+            // when it returns to run, since every jump into a block sets it (see emitJump).
+            emitter.movQuad(RAX, machineCyclesRegister);
+            emitter.quadOperation(Operation::Add, RAX, static_cast<std::int32_t>(getMaxBlockMachineCycles(address)));
+            emitter.quadOperation(Operation::Cmp, RAX, FIELD(targetMachineCycles));
+            emitter.jump(Condition::Above, exitCode);
+
+            Progress progress{address, 0, 0};
+            while (true)
+            {
+                if (progress.instructions == maxBlockInstructions || !isTranslatable(progress.address))
+                {
+                    emitJump(static_cast<word>(progress.address), progress.instructions, progress.machineCycles);
+                    break;
+                }
+
+                if (translateInstruction(progress))
+                    break;
+            }
+
+            codeBuffer.setExecutable(codeOffset, maxBlockCodeSize, true);
+
+            // Register the block, such that writes to its bytes invalidate it.
+            blocks[address] = code;
+            blockEnds[address] = progress.address;
+
+            std::size_t lastPage = (progress.address - 1) / Memory::pageSize;
+            for (std::size_t page = address / Memory::pageSize; page <= lastPage; ++page)
+            {
+                if (pageBlocks[page].empty())
+                    memory.watchPage(page);
+
+                pageBlocks[page].push_back(address);
+            }
+
+            ++translatedBlockCount;
+            return code;
+        }
+
+        std::uint32_t JitCpu::getMaxBlockMachineCycles(word address) const
+        {
+            std::uint32_t current = address;
+            std::uint32_t machineCycles = 0;
+
+            for (std::uint32_t instructions = 0; instructions < maxBlockInstructions && isTranslatable(current); ++instructions)
+            {
+                byte opCode = memory.get<false>(static_cast<word>(current));
+                machineCycles += instructionCycles[opCode];
+                current += instructionLengths[opCode];
+
+                if (endsBlock(opCode))
+                    break;
+            }
+
+            return machineCycles;
+        }
+
+        bool JitCpu::isTranslatable(std::uint32_t address) const
+        {
+            if (address >= Memory::maxMemorySize)
+                return false;
+
+            byte opCode = memory.get<false>(static_cast<word>(address));
+
+            // IN, OUT and HLT are left to the interpreter. As are instructions which do not fit in the
+            // address space, of which the interpreter reads the operands past the end of memory.
+            if (opCode == 0xDB || opCode == 0xD3 || opCode == 0x76)
+                return false;
+
+            return address + instructionLengths[opCode] <= Memory::maxMemorySize;
+        }
+
+        void JitCpu::emitStubs()
+        {
+            // void enterCode(Context* context, const void* code)
+            // Saves the registers which have to be preserved, loads the fixed registers and jumps to code.
+            enterCode = reinterpret_cast<EnterFunction>(const_cast<byte*>(emitter.getPosition()));
+
+            for (Register reg : savedRegisters)
+                emitter.push(reg);
+
+            emitter.quadOperation(Operation::Sub, RSP, stackSpace);
+
+            emitter.movQuad(contextRegister, argumentRegisters[0]);
+            emitter.movQuad(pageTableRegister, FIELD(pageTable));
+            emitter.movQuad(blocksRegister, FIELD(blocks));
+            emitter.movQuad(pageWatchCountsRegister, FIELD(pageWatchCounts));
+            emitter.movQuad(instructionsRegister, FIELD(executedInstructionCycles));
+            emitter.movQuad(machineCyclesRegister, FIELD(executedMachineCycles));
+            emitter.jump(argumentRegisters[1]);
+
+            // Stores the counters, restores the saved registers and returns from enterCode.
+            exitCode = emitter.getPosition();
+
+            emitter.movQuad(FIELD(executedInstructionCycles), instructionsRegister);
+            emitter.movQuad(FIELD(executedMachineCycles), machineCyclesRegister);
+            emitter.quadOperation(Operation::Add, RSP, stackSpace);
+
+            for (std::size_t i = std::size(savedRegisters); i > 0; --i)
+                emitter.pop(savedRegisters[i - 1]);
+
+            emitter.ret();
+
+            stubsSize = emitter.getSize();
+        }
+
+        bool JitCpu::translateInstruction(Progress& progress)
+        {
+            // Offsets in the context of the registers B, C, D, E, H, L and A, indexed as in the opcodes.
+            // Index 6 denotes the memory pointed at by HL (M), which is handled separately.
+            static const std::int32_t registerOffsets[8] =
+            {
+                offsetof(Context, B), offsetof(Context, C), offsetof(Context, D), offsetof(Context, E),
+                offsetof(Context, H), offsetof(Context, L), -1, offsetof(Context, A)
+            };
+
+            // Offsets of the register pairs BC, DE, HL and SP, indexed by bits 4 and 5 of the opcode.
+            // For PUSH and POP index 3 denotes PSW instead of SP.
+            static const std::int32_t pairOffsets[4] =
+            {
+                offsetof(Context, C), offsetof(Context, E), offsetof(Context, L), offsetof(Context, SP)
+            };
+
+            const word address = static_cast<word>(progress.address);
+            const byte opCode = memory.get<false>(address);
+            const byte length = instructionLengths[opCode];
+            const byte data = length >= 2 ? memory.get<false>(address + 1) : 0;
+            const word operand = length == 3 ? bytesAsWord(memory.get<false>(address + 2), data) : 0;
+
+            // The counters include this instruction, such that exits within the instruction continue after it.
+            progress.address += length;
+            progress.instructions += 1;
+            progress.machineCycles += instructionCyclesConditionNotMet[opCode];
+
+            const word next = static_cast<word>(progress.address);
+            const std::uint32_t instructions = progress.instructions;
+            const std::uint32_t machineCycles = progress.machineCycles;
+            const std::uint32_t conditionMetMachineCycles =
+                machineCycles + instructionCycles[opCode] - instructionCyclesConditionNotMet[opCode];
+
+            const byte destination = (opCode >> 3) & 0x07;
+            const byte source = opCode & 0x07;
+            const x64::Address pair = x64::at(contextRegister, pairOffsets[(opCode >> 4) & 0x03]);
+            // The byte at the address in ESI, after emitPageLookup(RSI, RDI, R8, write).
+            const x64::Address M = x64::at(RDI, R8, 0);
+
+            auto lookupM = [&](bool write)
+            {
+                emitPageLookup(RSI, RDI, R8, write);
+            };
+
+            // Conditional instructions skip to the code for the condition not being met.
+            auto jumpIfConditionNotMet = [&]()
+            {
+                emitter.testByte(FIELD(F), conditionFlags[(opCode >> 4) & 0x03]);
+                return emitter.jump((opCode & 0x08) ? Condition::Zero : Condition::NotZero);
+            };
+
+            // MOV
+            if (opCode >= 0x40 && opCode < 0x80)
+            {
+                if (source == 6)
+                {
+                    emitter.movzxWord(RSI, FIELD(L));
+                    lookupM(false);
+                    emitter.movzxByte(RAX, M);
+                }
+                else
+                    emitter.movzxByte(RAX, x64::at(contextRegister, registerOffsets[source]));
+
+                if (destination == 6)
+                {
+                    emitter.movzxWord(RSI, FIELD(L));
+                    lookupM(true);
+                    emitter.movByte(M, RAX);
+                    emitWriteCheck(1, next, instructions, machineCycles);
+                }
+                else
+                    emitter.movByte(x64::at(contextRegister, registerOffsets[destination]), RAX);
+
+                return false;
+            }
+
+            // ADD, ADC, SUB, SBB, ANA, XRA, ORA and CMP with a register or memory
+            if (opCode >= 0x80 && opCode < 0xC0)
+            {
+                if (source == 6)
+                {
+                    emitter.movzxWord(RSI, FIELD(L));
+                    lookupM(false);
+                    emitter.movzxByte(RCX, M);
+                }
+                else
+                    emitter.movzxByte(RCX, x64::at(contextRegister, registerOffsets[source]));
+
+                emitArithmetic(destination);
+                return false;
+            }
+
+            switch (opCode)
+            {
+                // NOP and the undocumented opcodes which are treated as a NOP
+                case 0x00: case 0x08: case 0x10: case 0x18: case 0x20: case 0x28: case 0x30: case 0x38:
+                    return false;
+
+                // LXI
+                case 0x01: case 0x11: case 0x21: case 0x31:
+                    emitter.movWord(pair, operand);
+                    return false;
+
+                // STAX
+                case 0x02: case 0x12:
+                    emitter.movzxWord(RSI, pair);
+                    lookupM(true);
+                    emitter.movzxByte(RAX, FIELD(A));
+                    emitter.movByte(M, RAX);
+                    emitWriteCheck(1, next, instructions, machineCycles);
+                    return false;
+
+                // LDAX
+                case 0x0A: case 0x1A:
+                    emitter.movzxWord(RSI, pair);
+                    lookupM(false);
+                    emitter.movzxByte(RAX, M);
+                    emitter.movByte(FIELD(A), RAX);
+                    return false;
+
+                // SHLD
+                case 0x22:
+                    emitter.movDouble(RSI, operand);
+                    emitter.movzxWord(RAX, FIELD(L));
+                    emitWriteWord();
+                    emitWriteCheck(2, next, instructions, machineCycles);
+                    return false;
+
+                // LHLD
+                case 0x2A:
+                    emitter.movDouble(RSI, operand);
+                    emitReadWord();
+                    emitter.movWord(FIELD(L), RAX);
+                    return false;
+
+                // STA
+                case 0x32:
+                    emitter.movDouble(RSI, operand);
+                    lookupM(true);
+                    emitter.movzxByte(RAX, FIELD(A));
+                    emitter.movByte(M, RAX);
+                    emitWriteCheck(1, next, instructions, machineCycles);
+                    return false;
+
+                // LDA
+                case 0x3A:
+                    emitter.movDouble(RSI, operand);
+                    lookupM(false);
+                    emitter.movzxByte(RAX, M);
+                    emitter.movByte(FIELD(A), RAX);
+                    return false;
+
+                // INX
+                case 0x03: case 0x13: case 0x23: case 0x33:
+                    emitter.incrementWord(pair);
+                    return false;
+
+                // DCX
+                case 0x0B: case 0x1B: case 0x2B: case 0x3B:
+                    emitter.decrementWord(pair);
+                    return false;
+
+                // INR and DCR
+                // The host instructions set the flags like the intel 8080 does, except that the auxiliary carry
+                // of DCR is inverted (see alu_tables.cpp). Neither changes the carry, which is loaded first.
+                case 0x04: case 0x0C: case 0x14: case 0x1C: case 0x24: case 0x2C: case 0x34: case 0x3C:
+                case 0x05: case 0x0D: case 0x15: case 0x1D: case 0x25: case 0x2D: case 0x35: case 0x3D:
+                {
+                    bool decrement = (opCode & 0x01) != 0;
+                    x64::Address target = M;
+
+                    // The byte of M is read from its page and incremented or decremented in the page to which
+                    // it is written, which differ for ROM.
+                    if (destination == 6)
+                    {
+                        emitter.movzxWord(RSI, FIELD(L));
+                        lookupM(false);
+                        emitter.movzxByte(RAX, M);
+                        lookupM(true);
+                        emitter.movByte(M, RAX);
+                    }
+                    else
+                        target = x64::at(contextRegister, registerOffsets[destination]);
+
+                    emitLoadCarry();
+
+                    if (decrement)
+                        emitter.decrementByte(target);
+                    else
+                        emitter.incrementByte(target);
+
+                    emitter.lahf();
+
+                    if (decrement)
+                        emitter.byteOperation(Operation::Xor, AH, alu::auxiliaryCarryFlag);
+
+                    emitter.movByte(FIELD(F), AH);
+
+                    if (destination == 6)
+                        emitWriteCheck(1, next, instructions, machineCycles);
+
+                    return false;
+                }
+
+                // MVI
+                case 0x06: case 0x0E: case 0x16: case 0x1E: case 0x26: case 0x2E: case 0x3E:
+                    emitter.movByte(x64::at(contextRegister, registerOffsets[destination]), data);
+                    return false;
+
+                case 0x36:
+                    emitter.movzxWord(RSI, FIELD(L));
+                    lookupM(true);
+                    emitter.movByte(M, data);
+                    emitWriteCheck(1, next, instructions, machineCycles);
+                    return false;
+
+                // RLC, RRC, RAL and RAR, which only affect the carry flag.
+                case 0x07: case 0x0F: case 0x17: case 0x1F:
+                {
+                    static const Shift shifts[] = {Shift::Rol, Shift::Ror, Shift::Rcl, Shift::Rcr};
+
+                    emitter.movzxByte(RAX, FIELD(A));
+
+                    if (opCode == 0x17 || opCode == 0x1F)
+                        emitLoadCarry();
+
+                    emitter.shiftByte(shifts[destination], RAX);
+                    emitter.setCondition(Condition::Carry, RCX);
+                    emitter.movByte(FIELD(A), RAX);
+                    emitter.byteOperation(Operation::And, FIELD(F), static_cast<byte>(~alu::carryFlag));
+                    emitter.byteOperation(Operation::Or, FIELD(F), RCX);
+                    return false;
+                }
+
+                // DAA, looked up in the same table as the interpreter uses.
+                case 0x27:
+                    emitter.movzxByte(RAX, FIELD(A));
+                    emitter.movzxByte(RDX, FIELD(F));
+                    emitter.movDouble(RCX, RDX);
+                    emitter.doubleOperation(Operation::And, RCX, alu::carryFlag);
+                    emitter.shiftDouble(Shift::Shl, RCX, 8);
+                    emitter.doubleOperation(Operation::Or, RAX, RCX);
+                    emitter.doubleOperation(Operation::And, RDX, alu::auxiliaryCarryFlag);
+                    emitter.shiftDouble(Shift::Shl, RDX, 5);
+                    emitter.doubleOperation(Operation::Or, RAX, RDX);
+                    emitter.movQuad(RDI, reinterpret_cast<std::uint64_t>(alu::decimalAdjustments.data()));
+                    emitter.movzxByte(RCX, x64::at(RDI, RAX, 1, 0));
+                    emitter.movzxByte(RDX, x64::at(RDI, RAX, 1, 1));
+                    emitter.byteOperation(Operation::Or, RDX, 0x02);
+                    emitter.movByte(FIELD(A), RCX);
+                    emitter.movByte(FIELD(F), RDX);
+                    return false;
+
+                // CMA
+                case 0x2F:
+                    emitter.notByte(FIELD(A));
+                    return false;
+
+                // STC
+                case 0x37:
+                    emitter.byteOperation(Operation::Or, FIELD(F), alu::carryFlag);
+                    return false;
+
+                // CMC
+                case 0x3F:
+                    emitter.byteOperation(Operation::Xor, FIELD(F), alu::carryFlag);
+                    return false;
+
+                // DAD
+                case 0x09: case 0x19: case 0x29: case 0x39:
+                    emitter.movzxWord(RAX, FIELD(L));
+                    emitter.movzxWord(RCX, pair);
+                    emitter.byteOperation(Operation::And, FIELD(F), static_cast<byte>(~alu::carryFlag));
+                    emitter.wordOperation(Operation::Add, RAX, RCX);
+                    emitter.setCondition(Condition::Carry, RDX);
+                    emitter.movWord(FIELD(L), RAX);
+                    emitter.byteOperation(Operation::Or, FIELD(F), RDX);
+                    return false;
+
+                // ADI, ACI, SUI, SBI, ANI, XRI, ORI and CPI
+                case 0xC6: case 0xCE: case 0xD6: case 0xDE: case 0xE6: case 0xEE: case 0xF6: case 0xFE:
+                    emitter.movDouble(RCX, data);
+                    emitArithmetic(destination);
+                    return false;
+
+                // JMP and the undocumented opcode which is treated as a JMP
+                case 0xC3: case 0xCB:
+                    emitJump(operand, instructions, machineCycles);
+                    return true;
+
+                // Conditional jumps
+                case 0xC2: case 0xCA: case 0xD2: case 0xDA: case 0xE2: case 0xEA: case 0xF2: case 0xFA:
+                {
+                    x64::Emitter::Label conditionNotMet = jumpIfConditionNotMet();
+                    emitJump(operand, instructions, conditionMetMachineCycles);
+                    emitter.bind(conditionNotMet);
+                    emitJump(next, instructions, machineCycles);
+                    return true;
+                }
+
+                // CALL and the undocumented opcodes which are treated as a CALL
+                case 0xCD: case 0xDD: case 0xED: case 0xFD:
+                    emitCall(operand, next, instructions, machineCycles);
+                    return true;
+
+                // Conditional calls
+                case 0xC4: case 0xCC: case 0xD4: case 0xDC: case 0xE4: case 0xEC: case 0xF4: case 0xFC:
+                {
+                    x64::Emitter::Label conditionNotMet = jumpIfConditionNotMet();
+                    emitCall(operand, next, instructions, conditionMetMachineCycles);
+                    emitter.bind(conditionNotMet);
+                    emitJump(next, instructions, machineCycles);
+                    return true;
+                }
+
+                // RET and the undocumented opcode which is treated as a RET
+                case 0xC9: case 0xD9:
+                    emitReturn(instructions, machineCycles);
+                    return true;
+
+                // Conditional returns
+                case 0xC0: case 0xC8: case 0xD0: case 0xD8: case 0xE0: case 0xE8: case 0xF0: case 0xF8:
+                {
+                    x64::Emitter::Label conditionNotMet = jumpIfConditionNotMet();
+                    emitReturn(instructions, conditionMetMachineCycles);
+                    emitter.bind(conditionNotMet);
+                    emitJump(next, instructions, machineCycles);
+                    return true;
+                }
+
+                // RST
+                case 0xC7: case 0xCF: case 0xD7: case 0xDF: case 0xE7: case 0xEF: case 0xF7: case 0xFF:
+                    emitCall(opCode & 0b0011'1000, next, instructions, machineCycles);
+                    return true;
+
+                // PCHL
+                case 0xE9:
+                    emitter.movzxWord(RAX, FIELD(L));
+                    emitJumpToRax(instructions, machineCycles);
+                    return true;
+
+                // SPHL
+                case 0xF9:
+                    emitter.movzxWord(RAX, FIELD(L));
+                    emitter.movWord(FIELD(SP), RAX);
+                    return false;
+
+                // XCHG
+                case 0xEB:
+                    emitter.movzxWord(RAX, FIELD(L));
+                    emitter.movzxWord(RCX, FIELD(E));
+                    emitter.movWord(FIELD(L), RCX);
+                    emitter.movWord(FIELD(E), RAX);
+                    return false;
+
+                // XTHL
+                case 0xE3:
+                    emitter.movzxWord(RSI, FIELD(SP));
+                    emitReadWord();
+                    emitter.movzxWord(RCX, FIELD(L));
+                    emitter.movWord(FIELD(L), RAX);
+                    emitter.movDouble(RAX, RCX);
+                    emitWriteWord();
+                    emitWriteCheck(2, next, instructions, machineCycles);
+                    return false;
+
+                // PUSH, of which PSW is stored in the context as a word of A and the flags.
+                case 0xC5: case 0xD5: case 0xE5: case 0xF5:
+                {
+                    x64::Address value = opCode == 0xF5 ? FIELD(F) : pair;
+
+                    emitter.movzxWord(RSI, FIELD(SP));
+                    emitter.doubleOperation(Operation::Sub, RSI, 2);
+                    emitter.doubleOperation(Operation::And, RSI, 0xFFFF);
+                    emitter.movWord(FIELD(SP), RSI);
+                    emitter.movzxWord(RAX, value);
+                    emitWriteWord();
+                    emitWriteCheck(2, next, instructions, machineCycles);
+                    return false;
+                }
+
+                // POP, of which POP PSW only keeps the bits of the flags (like CpuState::unpackFlags).
+                case 0xC1: case 0xD1: case 0xE1: case 0xF1:
+                {
+                    x64::Address value = opCode == 0xF1 ? FIELD(F) : pair;
+
+                    emitter.movzxWord(RSI, FIELD(SP));
+                    emitReadWord();
+
+                    if (opCode == 0xF1)
+                    {
+                        emitter.byteOperation(Operation::And, RAX, 0xD5);
+                        emitter.byteOperation(Operation::Or, RAX, 0x02);
+                    }
+
+                    emitter.movWord(value, RAX);
+                    emitter.wordOperation(Operation::Add, FIELD(SP), 2);
+                    return false;
+                }
+
+                // EI
+                case 0xFB:
+                    emitter.movByte(FIELD(interruptsEnabled), byte(1));
+                    return false;
+
+                // DI
+                case 0xF3:
+                    emitter.movByte(FIELD(interruptsEnabled), byte(0));
+                    return false;
+            }
+
+            throw EmulatorException("Opcode (0x" + toHexString(opCode) + ") can not be translated in JitCpu::translateInstruction.");
+        }
+
+        void JitCpu::emitJump(word target, std::uint32_t instructions, std::uint32_t machineCycles)
+        {
+            emitCounters(instructions, machineCycles);
+            emitter.movWord(FIELD(PC), target);
+            emitter.jump(x64::at(blocksRegister, static_cast<std::int32_t>(target * sizeof(void*))));
+        }
+
+        void JitCpu::emitJumpToRax(std::uint32_t instructions, std::uint32_t machineCycles)
+        {
+            emitCounters(instructions, machineCycles);
+            emitter.movWord(FIELD(PC), RAX);
+            emitter.jump(x64::at(blocksRegister, RAX, 3));
+        }
+
+        void JitCpu::emitCounters(std::uint32_t instructions, std::uint32_t machineCycles)
+        {
+            if (instructions != 0)
+            {
+                emitter.quadOperation(Operation::Add, instructionsRegister, static_cast<std::int32_t>(instructions));
+                emitter.quadOperation(Operation::Add, machineCyclesRegister, static_cast<std::int32_t>(machineCycles));
+            }
+        }
+
+        void JitCpu::emitWriteCheck(std::uint32_t size, word resumeAddress, std::uint32_t instructions, std::uint32_t machineCycles)
+        {
+            emitter.movDouble(RCX, RSI);
+            emitter.shiftDouble(Shift::Shr, RCX, 8);
+
+            if (size == 1)
+                emitter.byteOperation(Operation::Cmp, x64::at(pageWatchCountsRegister, RCX, 0), byte(0));
+            else
+            {
+                // A word may touch two pages, the second of which wraps around at the end of memory.
+                emitter.movzxByte(RDX, x64::at(pageWatchCountsRegister, RCX, 0));
+                emitter.movDouble(RCX, RSI);
+                emitter.doubleOperation(Operation::Add, RCX, 1);
+                emitter.doubleOperation(Operation::And, RCX, 0xFFFF);
+                emitter.shiftDouble(Shift::Shr, RCX, 8);
+                emitter.byteOperation(Operation::Or, RDX, x64::at(pageWatchCountsRegister, RCX, 0));
+            }
+
+            x64::Emitter::Label notWatched = emitter.jump(Condition::Zero);
+
+            emitter.movQuad(argumentRegisters[0], contextRegister);
+            emitter.movDouble(argumentRegisters[1], RSI);
+            emitter.movDouble(argumentRegisters[2], size);
+            emitter.movQuad(RAX, reinterpret_cast<std::uint64_t>(&JitCpu::onTranslatedCodeWrite));
+            emitter.call(RAX);
+
+            emitter.testDouble(RAX, RAX);
+            x64::Emitter::Label nothingInvalidated = emitter.jump(Condition::Zero);
+            emitJump(resumeAddress, instructions, machineCycles);
+
+            emitter.bind(notWatched);
+            emitter.bind(nothingInvalidated);
+        }
+
+        void JitCpu::emitPageLookup(Register address, Register page, Register offset, bool write)
+        {
+            emitter.movDouble(page, address);
+            emitter.shiftDouble(Shift::Shr, page, 8);
+            emitter.movQuad(page, x64::at(pageTableRegister, page, 3, write ? writeTableOffset : 0));
+            emitter.movDouble(offset, address);
+            emitter.doubleOperation(Operation::And, offset, 0xFF);
+        }
+
+        void JitCpu::emitReadWord()
+        {
+            emitPageLookup(RSI, RDI, R8, false);
+            emitter.movzxByte(RAX, x64::at(RDI, R8, 0));
+
+            emitter.movDouble(RDX, RSI);
+            emitter.doubleOperation(Operation::Add, RDX, 1);
+            emitter.doubleOperation(Operation::And, RDX, 0xFFFF);
+            emitPageLookup(RDX, R9, R10, false);
+            emitter.movzxByte(RCX, x64::at(R9, R10, 0));
+            emitter.shiftDouble(Shift::Shl, RCX, 8);
+            emitter.doubleOperation(Operation::Or, RAX, RCX);
+        }
+
+        void JitCpu::emitWriteWord()
+        {
+            emitPageLookup(RSI, RDI, R8, true);
+            emitter.movByte(x64::at(RDI, R8, 0), RAX);
+
+            emitter.movDouble(RDX, RSI);
+            emitter.doubleOperation(Operation::Add, RDX, 1);
+            emitter.doubleOperation(Operation::And, RDX, 0xFFFF);
+            emitPageLookup(RDX, R9, R10, true);
+            emitter.movDouble(RCX, RAX);
+            emitter.shiftDouble(Shift::Shr, RCX, 8);
+            emitter.movByte(x64::at(R9, R10, 0), RCX);
+        }
+
+        void JitCpu::emitLoadCarry()
+        {
+            // Shifting the flags right by one moves the carry flag of the intel 8080 into that of the host.
+            emitter.movzxByte(RDX, FIELD(F));
+            emitter.shiftDouble(Shift::Shr, RDX, 1);
+        }
+
+        void JitCpu::emitArithmetic(byte operation)
+        {
+            // Applies the operation (as encoded in bits 3 to 5 of the opcode) to A and the operand in CL.
+            // LAHF stores the flags of the host in the same format as CpuState::packFlags, see alu_tables.cpp
+            // for how the intel 8080 computes the auxiliary carry of subtractions and logical operations.
+            static const Operation operations[] =
+            {
+                Operation::Add, Operation::Adc, Operation::Sub, Operation::Sbb,
+                Operation::And, Operation::Xor, Operation::Or, Operation::Cmp
+            };
+
+            const Operation hostOperation = operations[operation];
+
+            emitter.movzxByte(RAX, FIELD(A));
+
+            if (hostOperation == Operation::Adc || hostOperation == Operation::Sbb)
+                emitLoadCarry();
+
+            if (hostOperation == Operation::And)
+            {
+                emitter.movDouble(RDX, RAX);
+                emitter.doubleOperation(Operation::Or, RDX, RCX);
+                emitter.doubleOperation(Operation::And, RDX, 0x08);
+                emitter.shiftDouble(Shift::Shl, RDX, 1);
+            }
+
+            emitter.byteOperation(hostOperation, RAX, RCX);
+            emitter.lahf();
+
+            switch (hostOperation)
+            {
+                case Operation::Sub: case Operation::Sbb: case Operation::Cmp:
+                    emitter.byteOperation(Operation::Xor, AH, alu::auxiliaryCarryFlag);
+                    break;
+
+                case Operation::And:
+                    emitter.byteOperation(Operation::And, AH, static_cast<byte>(~alu::auxiliaryCarryFlag));
+                    emitter.byteOperation(Operation::Or, AH, RDX);
+                    break;
+
+                case Operation::Xor: case Operation::Or:
+                    emitter.byteOperation(Operation::And, AH, static_cast<byte>(~alu::auxiliaryCarryFlag));
+                    break;
+
+                default:
+                    break;
+            }
+
+            emitter.movByte(FIELD(F), AH);
+
+            if (hostOperation != Operation::Cmp)
+                emitter.movByte(FIELD(A), RAX);
+        }
+
+        void JitCpu::emitCall(word target, word returnAddress, std::uint32_t instructions, std::uint32_t machineCycles)
+        {
+            emitter.movzxWord(RSI, FIELD(SP));
+            emitter.doubleOperation(Operation::Sub, RSI, 2);
+            emitter.doubleOperation(Operation::And, RSI, 0xFFFF);
+            emitter.movWord(FIELD(SP), RSI);
+            emitter.movDouble(RAX, returnAddress);
+            emitWriteWord();
+            emitWriteCheck(2, target, instructions, machineCycles);
+            emitJump(target, instructions, machineCycles);
+        }
+
+        void JitCpu::emitReturn(std::uint32_t instructions, std::uint32_t machineCycles)
+        {
+            emitter.movzxWord(RSI, FIELD(SP));
+            emitReadWord();
+            emitter.wordOperation(Operation::Add, FIELD(SP), 2);
+            emitJumpToRax(instructions, machineCycles);
+        }
+
+        int JitCpu::onTranslatedCodeWrite(Context* context, std::uint32_t address, std::uint32_t size) noexcept
+        {
+            JitCpu& cpu = *context->cpu;
+            std::size_t previousInvalidatedBlockCount = cpu.invalidatedBlockCount;
+
+            cpu.memory.notifyWritten(address, size);
+
+            return cpu.invalidatedBlockCount != previousInvalidatedBlockCount;
+        }
+    #endif
+
+    #undef FIELD
+} // namespace emulator
@@ -1,5 +1,6 @@
 #include "spaceinvaders_application.hpp"
 #include "diagnostic_application.hpp"
+#include "replay_application.hpp"
 
 #include "consolegui/console_exception.hpp"
 #include "emulator_exception.hpp"
@@ -8,6 +9,7 @@
 
 using emulator::Application;
 using emulator::DiagnosticApplication;
+using emulator::ReplayApplication;
 using emulator::SpaceInvadersApplication;
 
 void runApplication(Application& app);
@@ -27,11 +29,38 @@ int main(int argc, const char* argv[])
     #endif
 
     bool runDiagnostic = false;
-    if (argc >= 2)
+    bool profile = false;
+    bool scanlines = false;
+    std::string recordPath;
+    std::string replayPath;
+    std::string statePath;
+    emulator::Upscaler::Filter filter = emulator::Upscaler::Filter::Nearest;
+    SpaceInvadersApplication::CpuType cpuType = SpaceInvadersApplication::CpuType::Unchecked;
+    for (int i = 1; i < argc; ++i)
     {
-        std::string argument(argv[1]);
+        std::string argument(argv[i]);
         if (argument == "-d" || argument == "-diagnostic")
             runDiagnostic = true;
+        else if (argument == "-c" || argument == "-checked")
+            cpuType = SpaceInvadersApplication::CpuType::Checked;
+        else if (argument == "-j" || argument == "-jit")
+            cpuType = SpaceInvadersApplication::CpuType::Jit;
+        else if (argument == "-r" || argument == "-recompiled")
+            cpuType = SpaceInvadersApplication::CpuType::Recompiled;
+        else if (argument == "-p" || argument == "-profile")
+            profile = true;
+        else if (argument == "-s" || argument == "-scanlines")
+            scanlines = true;
+        else if (argument == "-x" || argument == "-scalex")
+            filter = emulator::Upscaler::Filter::ScaleNx;
+        else if (argument == "-l" || argument == "-linefilter")
+            filter = emulator::Upscaler::Filter::Scanlines;
+        else if (argument == "-record" && i + 1 < argc)
+            recordPath = argv[++i];
+        else if (argument == "-replay" && i + 1 < argc)
+            replayPath = argv[++i];
+        else if (argument == "-loadstate" && i + 1 < argc)
+            statePath = argv[++i];
     }
 
     if (runDiagnostic)
@@ -39,9 +68,30 @@ int main(int argc, const char* argv[])
         DiagnosticApplication application;
         runApplication(application);
     }
+    else if (!replayPath.empty())
+    {
+        // The replay runs without a window, so an error ends it rather than waiting for the user.
+        try
+        {
+            ReplayApplication application(replayPath, cpuType, std::cout);
+            application.run();
+        }
+        catch (const emulator::EmulatorException& exception)
+        {
+            std::cerr << "Emulator exception encountered: " << exception.what() << '\n';
+            return EXIT_FAILURE;
+        }
+    }
     else
     {
-        SpaceInvadersApplication application;
+        SpaceInvadersApplication application(cpuType, profile, scanlines, filter);
+
+        if (!recordPath.empty())
+            application.recordInput(recordPath);
+
+        if (!statePath.empty())
+            application.loadStateFromFile(statePath);
+
         runApplication(application);
     }
 
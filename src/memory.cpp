@@ -1,97 +1,144 @@
 #include "memory.hpp"
 
+#include "memory_arena.hpp"
 #include "emulator_exception.hpp"
 #include "defines.hpp"
 
 #include <sstream>
 #include <fstream>
 #include <cstring>
+#include <algorithm>
 
 namespace emulator
 {
-    Memory::Memory(std::size_t romSize_, std::size_t ramSize_): 
-        romSize(romSize_), ramSize(ramSize_), totalSize(romSize_ + ramSize_)
+    namespace
     {
-        if (totalSize > maxMemorySize)
+        void checkSizes(std::size_t romSize, std::size_t ramSize)
         {
-            std::stringstream stream;
-            stream << "Requested memory size (" << romSize << " + " << ramSize 
-                << ") exceeds maximum possible size (" << maxMemorySize << ") in Memory::Memory.";
-            throw EmulatorException(stream.str());
+            if (romSize + ramSize > Memory::maxMemorySize)
+            {
+                std::stringstream stream;
+                stream << "Requested memory size (" << romSize << " + " << ramSize
+                    << ") exceeds maximum possible size (" << Memory::maxMemorySize << ") in Memory::Memory.";
+                throw EmulatorException(stream.str());
+            }
+
+            if (romSize % Memory::pageSize != 0 || ramSize % Memory::pageSize != 0)
+            {
+                std::stringstream stream;
+                stream << "Requested memory size (" << romSize << " + " << ramSize
+                    << ") is not a multiple of the page size (" << Memory::pageSize << ") in Memory::Memory.";
+                throw EmulatorException(stream.str());
+            }
         }
+    } // namespace
+
+    Memory::Memory(std::size_t romSize_, std::size_t ramSize_): 
+        romSize(romSize_), ramSize(ramSize_), totalSize(romSize_ + ramSize_)
+    {
+        checkSizes(romSize, ramSize);
+
+        // The buffer always covers the whole address space, such that code which reads it directly
+        // can never end up outside of it.
+        data = std::make_unique<byte[]>(maxMemorySize + paddingSize);
+        rom = data.get();
+        ram = data.get() + romSize;
 
-        data = std::make_unique<byte[]>(totalSize);
+        mapPages();
     }
 
-    byte& Memory::operator[] (word address)
+    Memory::Memory(const byte* rom_, std::size_t romSize_, std::size_t ramSize_, MemoryArena& arena):
+        romSize(romSize_), ramSize(ramSize_), totalSize(romSize_ + ramSize_), rom(rom_), romShared(true)
     {
-        #if EMULATOR_CHECK_BOUNDS
-            if (address > totalSize)
-                throw EmulatorException(
-                    "Memory Address (" + std::to_string(address) + ") out of range in Memory::operator[].");
+        checkSizes(romSize, ramSize);
 
-            if (address < romSize)
-                throw EmulatorException(
-                    "Memory address (" + std::to_string(address) + ") in ROM can not be set in Memory::operator[].");
-        #endif
+        if (rom == nullptr && romSize != 0)
+            throw EmulatorException("The shared ROM image is null in Memory::Memory.");
 
-        return data[address];
+        ram = static_cast<byte*>(arena.allocate(ramSize));
+
+        mapPages();
     }
 
-    void Memory::set(word address, byte value)
+    void Memory::mapPages()
     {
-        #if EMULATOR_CHECK_BOUNDS
-            if (address > totalSize)
-                throw EmulatorException(
-                    "Memory address (" + std::to_string(address) + ") out of range in Memory::set.");
+        unmappedPage.fill(unmappedValue);
+
+        for (std::size_t page = 0; page < pageCount; ++page)
+        {
+            std::size_t address = page * pageSize;
 
             if (address < romSize)
-                throw EmulatorException(
-                    "Memory address (" + std::to_string(address) + ") in ROM can not be set in Memory::set.");
-        #endif
+            {
+                pageTypes[page] = PageType::Rom;
+                pageTable.read[page] = rom + address;
+                pageTable.write[page] = ignoredPage.data();
+            }
+            else if (address < totalSize)
+            {
+                pageTypes[page] = PageType::Ram;
+                pageTable.read[page] = ram + (address - romSize);
+                pageTable.write[page] = ram + (address - romSize);
+            }
+            else
+            {
+                pageTypes[page] = PageType::Unmapped;
+                pageTable.read[page] = unmappedPage.data();
+                pageTable.write[page] = ignoredPage.data();
+            }
+        }
 
-        data[address] = value;
+        updateAliases();
     }
 
-    byte Memory::get(word address) const
+    byte& Memory::operator[] (word address)
     {
         #if EMULATOR_CHECK_BOUNDS
-            if (address > totalSize)
-                throw EmulatorException(
-                    "Memory address (" + std::to_string(address) + ") out of range in Memory::get.");
+            checkWriteAddress(address, 0, "Memory::operator[]");
         #endif
 
-        return data[address];
+        std::size_t page = address / pageSize;
+
+        if (pageWatchCounts[page] != 0)
+            notifyWritten(address, 1);
+
+        // ROM is written through its bytes in the buffer, rather than ignoring the write. Unless it is shared.
+        if (pageTypes[page] == PageType::Unmapped || (romShared && pageTypes[page] == PageType::Rom))
+            return ignoredPage[address % pageSize];
+
+        return const_cast<byte*>(pageTable.read[page])[address % pageSize];
     }
 
-    word Memory::getWord(word address) const
+    void Memory::throwAddressOutOfRange(word address, const char* function) const
     {
-        #if EMULATOR_CHECK_BOUNDS
-            if (address > (totalSize - 1))
-                throw EmulatorException(
-                    "Memory address (" + std::to_string(address) + ") out of range in Memory::getWord.");
-        #endif
+        throw EmulatorException(
+            "Memory address (" + std::to_string(address) + ") out of range in " + function + ".");
+    }
 
-        // At this place we need to mind that the intel 8080 is a little endian processor.
-        // Hence the high byte is located at address + 1, the low byte at address.
-        return bytesAsWord(data[address + 1], data[address]);
+    void Memory::throwAddressInRom(word address, const char* function) const
+    {
+        throw EmulatorException(
+            "Memory address (" + std::to_string(address) + ") in ROM can not be set in " + function + ".");
     }
 
-    void Memory::setWord(word address, word value)
+    void Memory::clear()
     {
-         #if EMULATOR_CHECK_BOUNDS
-            if (address > (totalSize - 1))
-                throw EmulatorException(
-                    "Memory address (" + std::to_string(address) + ") out of range in Memory::setWord.");
-        #endif
+        std::memset(ram, 0, ramSize);
+
+        if (romShared)
+        {
+            notifyWatchers(romSize, ramSize);
+            return;
+        }
 
-        // Like in Memory::getWord we need to be mindful of the fact that the intel 8080 is little endian.
-        wordAsBytePair(value, data[address + 1], data[address]);
+        std::memset(data.get(), 0, romSize);
+        notifyWatchers(0, totalSize);
     }
 
-    void Memory::clear()
+    void Memory::loadRam(const byte* source)
     {
-        std::memset(data.get(), 0, totalSize);
+        std::memcpy(ram, source, ramSize);
+        notifyWritten(romSize, ramSize);
     }
 
     std::size_t Memory::loadMemoryFromFile(const std::string& path, std::size_t offset)
@@ -110,9 +157,20 @@ namespace emulator
                 " exceeds memory bounds (" + std::to_string(totalSize) + ") in Memory::loadMemoryFromFile.");
         }
 
+        if (romShared && offset < romSize)
+        {
+            throw EmulatorException(
+                "Loading file " + path + " at offset " + std::to_string(offset) +
+                " overlaps the shared ROM in Memory::loadMemoryFromFile.");
+        }
+
         file.seekg(0);
 
-        file.read(reinterpret_cast<char*>(data.get()) + offset, size);
+        // ROM and RAM are adjacent in an owned buffer.
+        byte* destination = romShared ? ram + (offset - romSize) : data.get() + offset;
+        file.read(reinterpret_cast<char*>(destination), size);
+        notifyWatchers(offset, static_cast<std::size_t>(size));
+
         return offset + size;
     }
 
@@ -121,4 +179,206 @@ namespace emulator
         for (const std::string& path : paths)
             offset = loadMemoryFromFile(path, offset);
     }
+
+    std::vector<byte> Memory::loadRomImage(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::in | std::ios::binary | std::ios::ate);
+
+        if (!file)
+            throw EmulatorException("Unable to open file " + path + " in Memory::loadRomImage.");
+
+        std::size_t size = static_cast<std::size_t>(file.tellg());
+
+        if (size > maxMemorySize)
+        {
+            throw EmulatorException(
+                "File " + path + " exceeds memory bounds (" + std::to_string(maxMemorySize) + ") in Memory::loadRomImage.");
+        }
+
+        std::vector<byte> image((size + pageSize - 1) / pageSize * pageSize);
+
+        file.seekg(0);
+        file.read(reinterpret_cast<char*>(image.data()), size);
+
+        return image;
+    }
+
+    void Memory::addWatcher(MemoryWatcher* watcher)
+    {
+        watchers.push_back(watcher);
+    }
+
+    void Memory::removeWatcher(MemoryWatcher* watcher)
+    {
+        watchers.erase(std::remove(watchers.begin(), watchers.end(), watcher), watchers.end());
+    }
+
+    void Memory::mapMirror(std::size_t address, std::size_t size, std::size_t sourceAddress, std::size_t sourceSize)
+    {
+        auto isAligned = [](std::size_t value) { return value % pageSize == 0; };
+
+        if (!isAligned(address) || !isAligned(size) || !isAligned(sourceAddress) || !isAligned(sourceSize) ||
+            sourceSize == 0 || address + size > maxMemorySize || sourceAddress + sourceSize > totalSize)
+        {
+            throw EmulatorException("Invalid mirror of " + std::to_string(sourceSize) + " bytes at " +
+                std::to_string(sourceAddress) + " in Memory::mapMirror.");
+        }
+
+        std::size_t firstPage = address / pageSize;
+        std::size_t sourcePage = sourceAddress / pageSize;
+        std::size_t sourcePageCount = sourceSize / pageSize;
+
+        for (std::size_t page = firstPage; page < firstPage + size / pageSize; ++page)
+        {
+            if (pageTypes[page] != PageType::Unmapped)
+            {
+                throw EmulatorException("Page " + std::to_string(page) +
+                    " is already mapped in Memory::mapMirror.");
+            }
+        }
+
+        for (std::size_t i = 0; i < size / pageSize; ++i)
+        {
+            std::size_t source = sourcePage + i % sourcePageCount;
+
+            pageTypes[firstPage + i] = pageTypes[source];
+            pageTable.read[firstPage + i] = pageTable.read[source];
+            pageTable.write[firstPage + i] = pageTable.write[source];
+        }
+
+        updateAliases();
+
+        // Reading the mirrored pages now returns different values.
+        notifyWatchers(address, size);
+    }
+
+    void Memory::watchPage(std::size_t page)
+    {
+        if (page >= pageCount || pageWatchCounts[page] == 0xFF)
+            throw EmulatorException("Unable to watch page " + std::to_string(page) + " in Memory::watchPage.");
+
+        ++pageWatchRequests[page];
+
+        std::size_t alias = page;
+        do
+        {
+            ++pageWatchCounts[alias];
+            alias = nextAliases[alias];
+        } while (alias != page);
+    }
+
+    void Memory::unwatchPage(std::size_t page)
+    {
+        if (page >= pageCount || pageWatchRequests[page] == 0)
+            throw EmulatorException("Page " + std::to_string(page) + " is not watched in Memory::unwatchPage.");
+
+        --pageWatchRequests[page];
+
+        std::size_t alias = page;
+        do
+        {
+            --pageWatchCounts[alias];
+            alias = nextAliases[alias];
+        } while (alias != page);
+    }
+
+    void Memory::notifyWritten(std::size_t address, std::size_t size)
+    {
+        if (size == 0)
+            return;
+
+        // The written bytes may wrap around at the end of memory.
+        std::size_t firstPage = address / pageSize;
+        std::size_t lastPage = (address + std::min(size, maxMemorySize) - 1) / pageSize;
+
+        for (std::size_t page = firstPage; page <= lastPage; ++page)
+        {
+            if (pageWatchCounts[page % pageCount] != 0)
+            {
+                notifyWatchers(address, size, true);
+                return;
+            }
+        }
+    }
+
+    void Memory::notifyWatchers(std::size_t address, std::size_t size, bool watchedAliasesOnly)
+    {
+        if (size == 0)
+            return;
+
+        if (!hasMirrors)
+        {
+            for (MemoryWatcher* watcher : watchers)
+                watcher->onMemoryWritten(address, size);
+
+            return;
+        }
+
+        // Every page is reported separately, at the address of the written bytes in each of its aliases.
+        std::size_t end = address + std::min(size, maxMemorySize);
+
+        while (address < end)
+        {
+            std::size_t page = (address / pageSize) % pageCount;
+            std::size_t offset = address % pageSize;
+            std::size_t chunkSize = std::min(end - address, pageSize - offset);
+
+            std::size_t alias = page;
+            do
+            {
+                if (!watchedAliasesOnly || pageWatchRequests[alias] != 0)
+                {
+                    for (MemoryWatcher* watcher : watchers)
+                        watcher->onMemoryWritten(alias * pageSize + offset, chunkSize);
+                }
+
+                alias = nextAliases[alias];
+            } while (alias != page);
+
+            address += chunkSize;
+        }
+    }
+
+    void Memory::updateAliases()
+    {
+        hasMirrors = false;
+
+        for (std::size_t page = 0; page < pageCount; ++page)
+        {
+            // Find the next page after this one (wrapping around) which reads from the same memory.
+            nextAliases[page] = static_cast<byte>(page);
+
+            if (pageTypes[page] == PageType::Unmapped)
+                continue;
+
+            for (std::size_t i = 1; i < pageCount; ++i)
+            {
+                std::size_t alias = (page + i) % pageCount;
+
+                if (pageTable.read[alias] == pageTable.read[page])
+                {
+                    nextAliases[page] = static_cast<byte>(alias);
+                    hasMirrors = true;
+                    break;
+                }
+            }
+        }
+
+        for (std::size_t page = 0; page < pageCount; ++page)
+        {
+            std::size_t count = 0;
+
+            std::size_t alias = page;
+            do
+            {
+                count += pageWatchRequests[alias];
+                alias = nextAliases[alias];
+            } while (alias != page);
+
+            if (count > 0xFF)
+                throw EmulatorException("Page " + std::to_string(page) + " is watched too often in Memory::updateAliases.");
+
+            pageWatchCounts[page] = static_cast<byte>(count);
+        }
+    }
 } // namespace emulator
@@ -0,0 +1,124 @@
+#include "memory_arena.hpp"
+
+#include "emulator_exception.hpp"
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+#endif
+
+namespace emulator
+{
+    namespace
+    {
+        std::size_t roundUp(std::size_t value, std::size_t alignment)
+        {
+            return (value + alignment - 1) / alignment * alignment;
+        }
+    } // namespace
+
+    MemoryArena::MemoryArena(void* buffer, std::size_t size_): data(static_cast<byte*>(buffer)), size(size_)
+    {
+        if (data == nullptr && size != 0)
+            throw EmulatorException("The buffer of the arena is null in MemoryArena::MemoryArena.");
+    }
+
+    MemoryArena::MemoryArena(std::size_t size_, bool hugePages_): size(size_), ownsData(true)
+    {
+        if (size == 0)
+            return;
+
+        void* memory = nullptr;
+
+        #if defined(_WIN32)
+            // Large pages require the "Lock pages in memory" privilege, without which the allocation fails.
+            std::size_t largePageSize = GetLargePageMinimum();
+            if (hugePages_ && largePageSize != 0)
+            {
+                std::size_t largeSize = roundUp(size, largePageSize);
+                memory = VirtualAlloc(nullptr, largeSize, MEM_COMMIT | MEM_RESERVE | MEM_LARGE_PAGES, PAGE_READWRITE);
+
+                if (memory != nullptr)
+                {
+                    size = largeSize;
+                    hugePages = true;
+                }
+            }
+
+            if (memory == nullptr)
+                memory = VirtualAlloc(nullptr, size, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+
+            if (memory == nullptr)
+                throw EmulatorException("Unable to allocate " + std::to_string(size) + " bytes in MemoryArena::MemoryArena.");
+        #else
+            // Explicit huge pages are only available if the system reserved them. Otherwise regular pages
+            // are requested to be backed by transparent huge pages.
+            constexpr std::size_t hugePageSize = 2 * 1024 * 1024;
+
+            if (hugePages_)
+                size = roundUp(size, hugePageSize);
+
+            #if defined(MAP_HUGETLB)
+                if (hugePages_)
+                {
+                    memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+                    hugePages = memory != MAP_FAILED;
+                }
+            #endif
+
+            if (!hugePages)
+            {
+                memory = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+                if (memory == MAP_FAILED)
+                    throw EmulatorException("Unable to allocate " + std::to_string(size) + " bytes in MemoryArena::MemoryArena.");
+
+                #if defined(MADV_HUGEPAGE)
+                    if (hugePages_)
+                        hugePages = madvise(memory, size, MADV_HUGEPAGE) == 0;
+                #endif
+            }
+        #endif
+
+        data = static_cast<byte*>(memory);
+    }
+
+    MemoryArena::~MemoryArena()
+    {
+        if (!ownsData || data == nullptr)
+            return;
+
+        #if defined(_WIN32)
+            VirtualFree(data, 0, MEM_RELEASE);
+        #else
+            munmap(data, size);
+        #endif
+    }
+
+    void* MemoryArena::allocate(std::size_t size_, std::size_t alignment)
+    {
+        if (alignment == 0 || (alignment & (alignment - 1)) != 0)
+            throw EmulatorException("Alignment " + std::to_string(alignment) + " is not a power of two in MemoryArena::allocate.");
+
+        // The alignment is of the address, as a caller provided buffer may itself be unaligned.
+        std::uintptr_t base = reinterpret_cast<std::uintptr_t>(data);
+        std::size_t offset = roundUp(base + used, alignment) - base;
+
+        if (offset > size || size - offset < size_)
+        {
+            throw EmulatorException("Allocating " + std::to_string(size_) + " bytes exceeds the arena (" +
+                std::to_string(size - used) + " bytes left) in MemoryArena::allocate.");
+        }
+
+        used = offset + size_;
+
+        byte* memory = data + offset;
+        std::memset(memory, 0, size_);
+        return memory;
+    }
+} // namespace emulator
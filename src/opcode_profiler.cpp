@@ -0,0 +1,95 @@
+#include "opcode_profiler.hpp"
+
+#include "opcode_info.hpp"
+
+#include <algorithm>
+#include <iomanip>
+
+namespace emulator
+{
+    namespace
+    {
+        // The nmemonic and the register arguments of an instruction, without its immediate operands.
+        std::string formatInstruction(byte opCode)
+        {
+            std::string argumentString = arguments[opCode];
+
+            for (const char* operand : {", bb", ", wwww", "bb", "wwww"})
+            {
+                std::size_t pos = argumentString.find(operand);
+                if (pos != std::string::npos)
+                    argumentString.erase(pos, std::char_traits<char>::length(operand));
+            }
+
+            return argumentString.empty() ? nmemonics[opCode] : nmemonics[opCode] + ' ' + argumentString;
+        }
+    }
+
+    OpcodeProfiler::OpcodeProfiler(): pairCounts(0x10000, 0)
+    {}
+
+    void OpcodeProfiler::reset()
+    {
+        std::fill(pairCounts.begin(), pairCounts.end(), 0);
+        tripleCounts.clear();
+
+        history = 0;
+        instructionCount = 0;
+    }
+
+    std::vector<OpcodeProfiler::Sequence> OpcodeProfiler::getHottestSequences(std::size_t length, std::size_t count) const
+    {
+        std::vector<Sequence> sequences;
+
+        auto addSequence = [&](std::uint32_t opCodes, std::uint64_t sequenceCount)
+        {
+            if (sequenceCount == 0)
+                return;
+
+            Sequence sequence{{}, length, sequenceCount};
+            for (std::size_t i = 0; i < length; ++i)
+                sequence.opCodes[i] = static_cast<byte>(opCodes >> (8 * (length - 1 - i)));
+
+            sequences.push_back(sequence);
+        };
+
+        if (length == 2)
+        {
+            for (std::uint32_t opCodes = 0; opCodes < pairCounts.size(); ++opCodes)
+                addSequence(opCodes, pairCounts[opCodes]);
+        }
+        else
+        {
+            for (const auto& [opCodes, sequenceCount] : tripleCounts)
+                addSequence(opCodes, sequenceCount);
+        }
+
+        count = std::min(count, sequences.size());
+        std::partial_sort(sequences.begin(), sequences.begin() + count, sequences.end(),
+            [](const Sequence& a, const Sequence& b) { return a.count > b.count; });
+        sequences.resize(count);
+
+        return sequences;
+    }
+
+    void OpcodeProfiler::writeReport(std::ostream& stream, std::size_t count) const
+    {
+        stream << "Executed instructions: " << instructionCount << '\n';
+
+        for (std::size_t length : {2, 3})
+        {
+            stream << '\n' << "Most executed " << (length == 2 ? "pairs" : "triples") << " of instructions:\n";
+
+            for (const Sequence& sequence : getHottestSequences(length, count))
+            {
+                double share = instructionCount == 0 ? 0.0 : 100.0 * sequence.count / instructionCount;
+                stream << std::setw(14) << sequence.count << std::setw(7) << std::fixed << std::setprecision(2) << share << "%  ";
+
+                for (std::size_t i = 0; i < sequence.length; ++i)
+                    stream << (i == 0 ? "" : " ; ") << formatInstruction(sequence.opCodes[i]);
+
+                stream << '\n';
+            }
+        }
+    }
+} // namespace emulator
@@ -0,0 +1,264 @@
+#include "predecode_cache.hpp"
+
+#include "opcode_info.hpp"
+
+#include <algorithm>
+
+namespace emulator
+{
+    namespace
+    {
+        // The registers and flags which an instruction reads and writes, as bits for findIdleLoop.
+        // The byte registers are numbered as in the opcodes (B, C, D, E, H, L, A), 6 is the stack pointer.
+        constexpr unsigned registerBit(byte index)
+        {
+            return 1u << (index & 0x07);
+        }
+
+        constexpr unsigned stackPointer = registerBit(6);
+        constexpr unsigned hl = registerBit(4) | registerBit(5);
+        constexpr unsigned accumulator = registerBit(7);
+        constexpr unsigned carry = 1u << 8;
+        constexpr unsigned otherFlags = 1u << 9;
+
+        // The register pair in bits 4 and 5 of the opcode: BC, DE, HL or SP.
+        unsigned registerPairBits(byte opCode)
+        {
+            byte pair = (opCode >> 4) & 0x03;
+            return pair == 3 ? stackPointer : registerBit(pair * 2) | registerBit(pair * 2 + 1);
+        }
+
+        // Sets reads and writes for the instructions which findIdleLoop allows in a loop: those which
+        // neither write memory, nor access io or the stack, nor branch. Returns false for any other instruction.
+        bool getIdleLoopAccesses(byte opCode, unsigned& reads, unsigned& writes)
+        {
+            reads = writes = 0;
+            byte destination = (opCode >> 3) & 0x07;
+            byte source = opCode & 0x07;
+
+            if (opCode >= 0x40 && opCode < 0x80)
+            {
+                // MOV, except MOV M, r and HLT.
+                if (destination == 6)
+                    return false;
+
+                reads = source == 6 ? hl : registerBit(source);
+                writes = registerBit(destination);
+                return true;
+            }
+
+            if ((opCode >= 0x80 && opCode < 0xC0) || (opCode & 0xC7) == 0xC6)
+            {
+                // The arithmetic and logic instructions ADD, ADC, SUB, SBB, ANA, XRA, ORA and CMP,
+                // on a register, M or an immediate byte.
+                byte operation = destination;
+                reads = accumulator | (opCode >= 0xC0 ? 0 : (source == 6 ? hl : registerBit(source)));
+                writes = carry | otherFlags;
+
+                if (operation == 1 || operation == 3)
+                    reads |= carry;
+
+                // ANA A and ORA A leave the accumulator unchanged, XRA A and SUB A clear it.
+                if (opCode == 0xA7 || opCode == 0xB7)
+                    return true;
+
+                if (opCode == 0xAF || opCode == 0x97)
+                    reads = 0;
+
+                if (operation != 7)
+                    writes |= accumulator;
+
+                return true;
+            }
+
+            if (opCode < 0x40)
+            {
+                switch (opCode & 0x0F)
+                {
+                    case 0x01:  // LXI
+                        writes = registerPairBits(opCode);
+                        return true;
+                    case 0x03:  // INX
+                    case 0x0B:  // DCX
+                        reads = writes = registerPairBits(opCode);
+                        return true;
+                    case 0x09:  // DAD
+                        reads = hl | registerPairBits(opCode);
+                        writes = hl | carry;
+                        return true;
+                    case 0x04:  // INR, except INR M
+                    case 0x05:  // DCR, except DCR M
+                    case 0x0C:
+                    case 0x0D:
+                        reads = registerBit(destination);
+                        writes = registerBit(destination) | otherFlags;
+                        return destination != 6;
+                    case 0x06:  // MVI, except MVI M
+                    case 0x0E:
+                        writes = registerBit(destination);
+                        return destination != 6;
+                }
+            }
+
+            switch (opCode)
+            {
+                case 0x00:  // NOP
+                    return true;
+                case 0x07:  // RLC
+                case 0x0F:  // RRC
+                    reads = accumulator;
+                    writes = accumulator | carry;
+                    return true;
+                case 0x17:  // RAL
+                case 0x1F:  // RAR
+                    reads = writes = accumulator | carry;
+                    return true;
+                case 0x0A:  // LDAX B
+                case 0x1A:  // LDAX D
+                    reads = registerPairBits(opCode);
+                    writes = accumulator;
+                    return true;
+                case 0x2A:  // LHLD
+                    writes = hl;
+                    return true;
+                case 0x3A:  // LDA
+                    writes = accumulator;
+                    return true;
+                case 0x2F:  // CMA
+                    reads = writes = accumulator;
+                    return true;
+                case 0x37:  // STC
+                    writes = carry;
+                    return true;
+                case 0x3F:  // CMC
+                    reads = writes = carry;
+                    return true;
+                case 0xEB:  // XCHG
+                    reads = writes = hl | registerBit(2) | registerBit(3);
+                    return true;
+                case 0xF9:  // SPHL
+                    reads = hl;
+                    writes = stackPointer;
+                    return true;
+                default:
+                    return false;
+            }
+        }
+    } // namespace
+
+    PredecodeCache::PredecodeCache(Memory& memory_, bool fuseSuperinstructions_): memory(memory_),
+        fuseSuperinstructions(fuseSuperinstructions_), entries(Memory::maxMemorySize)
+    {
+        memory.addWatcher(this);
+    }
+
+    PredecodeCache::~PredecodeCache()
+    {
+        flush();
+        memory.removeWatcher(this);
+    }
+
+    void PredecodeCache::flush()
+    {
+        for (std::size_t page = 0; page < Memory::pageCount; ++page)
+        {
+            if (watchedPages[page])
+            {
+                memory.unwatchPage(page);
+                watchedPages[page] = false;
+            }
+        }
+
+        std::fill(entries.begin(), entries.end(), Entry{});
+    }
+
+    void PredecodeCache::decode(word address, bool checkBounds)
+    {
+        Entry entry{};
+
+        // The operands are read at the wrapped around address, as the program counter of the cpu wraps around.
+        word operandAddress = address + 1;
+
+        entry.opCode = checkBounds ? memory.get<true>(address) : memory.get<false>(address);
+        entry.length = instructionLengths[entry.opCode];
+
+        if (entry.length == 2)
+            entry.operand = checkBounds ? memory.get<true>(operandAddress) : memory.get<false>(operandAddress);
+        else if (entry.length == 3)
+            entry.operand = checkBounds ? memory.getWord<true>(operandAddress) : memory.getWord<false>(operandAddress);
+
+        entry.instructionIndex = entry.opCode;
+
+        if (fuseSuperinstructions)
+        {
+            // The opcodes of the next two instructions are only peeked at (the buffer of memory
+            // covers every address), since the cpu may never execute them.
+            word secondAddress = address + entry.length;
+            byte second = memory.get<false>(secondAddress);
+            byte third = memory.get<false>(static_cast<word>(secondAddress + instructionLengths[second]));
+
+            Superinstruction superinstruction = findSuperinstruction(entry.opCode, second, third);
+            if (superinstruction != Superinstruction::None)
+                entry.instructionIndex = 0x100 + static_cast<word>(superinstruction) - 1;
+        }
+
+        entry.dispatchIndex = findIdleLoop(address) != 0 ? idleLoopDispatchIndex : entry.instructionIndex;
+
+        // Watch the pages of the first and the last byte of the instruction.
+        for (word byteAddress : {address, static_cast<word>(address + entry.length - 1)})
+        {
+            std::size_t page = byteAddress / Memory::pageSize;
+
+            if (memory.getPageType(page) == Memory::PageType::Ram && !watchedPages[page])
+            {
+                memory.watchPage(page);
+                watchedPages[page] = true;
+            }
+        }
+
+        entries[address] = entry;
+    }
+
+    std::size_t PredecodeCache::findIdleLoop(word address) const
+    {
+        // The registers which the loop reads before setting them (its inputs) and which it writes.
+        unsigned inputs = 0, outputs = 0;
+        word instructionAddress = address;
+
+        for (std::size_t length = 1; length <= maxIdleLoopLength; ++length)
+        {
+            byte opCode = memory.get<false>(instructionAddress);
+
+            // JMP or a conditional jump, of which the condition is read after every register is set.
+            if (opCode == 0xC3 || (opCode & 0xC7) == 0xC2)
+            {
+                bool jumpsBack = memory.getWord<false>(static_cast<word>(instructionAddress + 1)) == address;
+                return jumpsBack && (inputs & outputs) == 0 ? length : 0;
+            }
+
+            unsigned reads = 0, writes = 0;
+            if (!getIdleLoopAccesses(opCode, reads, writes))
+                return 0;
+
+            inputs |= reads & ~outputs;
+            outputs |= writes;
+            instructionAddress += instructionLengths[opCode];
+        }
+
+        return 0;
+    }
+
+    void PredecodeCache::onMemoryWritten(std::size_t address, std::size_t size)
+    {
+        ++invalidationCount;
+
+        // An instruction is at most three bytes long, so the entries of the two addresses before
+        // the written bytes (wrapping around at the start of memory) may have operands in them.
+        // Writes by the cpu never reach the pages of ROM, since those are not watched.
+        std::size_t first = address + Memory::maxMemorySize - 2;
+        std::size_t end = address + Memory::maxMemorySize + std::min(size, Memory::maxMemorySize);
+
+        for (std::size_t i = first; i < end; ++i)
+            entries[i % Memory::maxMemorySize].length = 0;
+    }
+} // namespace emulator
@@ -0,0 +1,72 @@
+#include "recompiled_cpu.hpp"
+
+#include "hash.hpp"
+#include "spaceinvaders_io.hpp"
+
+namespace emulator
+{
+    RecompiledCpu::RecompiledCpu(Memory& memory_, SpaceInvadersIO& io_, const Program& program_):
+        BasicCpu(memory_, io_), program(program_), blocks(Memory::maxMemorySize, nullptr)
+    {
+        for (std::size_t i = 0; i < program.blockCount; ++i)
+            blocks[program.blocks[i].address] = &program.blocks[i];
+
+        memory.addWatcher(this);
+    }
+
+    RecompiledCpu::~RecompiledCpu()
+    {
+        memory.removeWatcher(this);
+    }
+
+    std::size_t RecompiledCpu::run(std::size_t machineCycles)
+    {
+        if (!matchesRom())
+            return BasicCpu::run(machineCycles);
+
+        std::size_t previousExecutedMachineCycles = executedMachineCycles;
+        std::size_t targetMachineCycles = executedMachineCycles + machineCycles;
+
+        Context context{state, memory, io, executedInstructionCycles, executedMachineCycles};
+
+        while (!state.halted && executedMachineCycles < targetMachineCycles)
+        {
+            const Block* block = blocks[state.PC];
+
+            if (block != nullptr && executedMachineCycles + block->maxMachineCycles <= targetMachineCycles)
+                block->function(context);
+            else
+                BasicCpu::executeInstructionCycle();
+        }
+
+        skipHaltedMachineCycles(targetMachineCycles);
+
+        return executedMachineCycles - previousExecutedMachineCycles;
+    }
+
+    std::uint64_t RecompiledCpu::hashRom(const byte* data, std::size_t size)
+    {
+        return hashBytes(data, size);
+    }
+
+    void RecompiledCpu::onMemoryWritten(std::size_t address, std::size_t size)
+    {
+        // No pages are watched, so only clearing and loading memory end up here. Writes by the cpu
+        // can not change the ROM on the real hardware, hence they are not taken into account.
+        // The written bytes may wrap around at the end of memory into the ROM.
+        if (size != 0 && (address < program.romSize || address + size > Memory::maxMemorySize))
+            romCompared = false;
+    }
+
+    bool RecompiledCpu::matchesRom()
+    {
+        if (!romCompared)
+        {
+            romMatches = memory.getRomSize() >= program.romSize &&
+                hashRom(memory.getRom(), program.romSize) == program.romHash;
+            romCompared = true;
+        }
+
+        return romMatches;
+    }
+} // namespace emulator
@@ -0,0 +1,86 @@
+#include "replay_application.hpp"
+
+#include "emulator_exception.hpp"
+#include "hash.hpp"
+
+#include <chrono>
+#include <iomanip>
+#include <iostream>
+
+namespace emulator
+{
+    ReplayApplication::ReplayApplication(const std::string& moviePath, SpaceInvadersApplication::CpuType cpuType,
+        std::ostream& output_):
+        movie(InputMovie::load(moviePath)), output(output_),
+        memory(SpaceInvadersApplication::romSize, SpaceInvadersApplication::ramSize), io()
+    {
+        SpaceInvadersApplication::mapMirrors(memory);
+
+        cpu = SpaceInvadersApplication::createCpu(cpuType, memory, io);
+        io.setCpu(cpu.get());
+    }
+
+    void ReplayApplication::run()
+    {
+        memory.loadMemoryFromFile("roms/invaders.rom");
+
+        if (hashBytes(memory.getRom(), memory.getRomSize()) != movie.getRomHash())
+            throw EmulatorException("The input movie was recorded with a different ROM in ReplayApplication::run.");
+
+        // The input is latched before an interrupt due at the same time is issued.
+        scheduler.schedule(SpaceInvadersApplication::inputLatchMachineCycles, *this, InputLatch);
+        scheduler.schedule(SpaceInvadersApplication::midScreenMachineCycles, *this, MidScreen);
+        scheduler.schedule(SpaceInvadersApplication::machineCyclesPerFrame, *this, VerticalBlank);
+
+        auto startTime = std::chrono::steady_clock::now();
+
+        while (finishedFrames < movie.getFrameCount())
+        {
+            if (scheduler.run(*cpu, SpaceInvadersApplication::machineCyclesPerFrame) == 0)
+                throw EmulatorException("The cpu stopped executing in ReplayApplication::run.");
+        }
+
+        float seconds = std::chrono::duration<float>(std::chrono::steady_clock::now() - startTime).count();
+        float emulatedSeconds = static_cast<float>(finishedFrames) / 60;
+
+        std::cerr << "Replayed " << finishedFrames << " frames in " << seconds << " seconds, "
+            << emulatedSeconds / seconds << " times real time.\n";
+    }
+
+    void ReplayApplication::onEvent(int event, std::size_t time)
+    {
+        if (event == InputLatch)
+        {
+            // Frames past the end of the movie, which are run but not reported, have no buttons pressed.
+            if (latchedFrames < movie.getFrameCount())
+            {
+                const InputMovie::Frame& frame = movie.getFrame(latchedFrames);
+                io.latchInputPorts(frame.port1, frame.port2);
+            }
+            else
+            {
+                io.latchInput(0);
+            }
+
+            ++latchedFrames;
+        }
+        else if (event == MidScreen)
+        {
+            cpu->issueRSTInterrupt(CpuBase::RestartInstructions::RST1);
+        }
+        else
+        {
+            if (finishedFrames < movie.getFrameCount())
+            {
+                output << finishedFrames << ' ' << std::hex << std::setw(16) << std::setfill('0')
+                    << hashBytes(memory.getRam(), memory.getRamSize()) << std::dec << '\n';
+            }
+
+            ++finishedFrames;
+
+            cpu->issueRSTInterrupt(CpuBase::RestartInstructions::RST2);
+        }
+
+        scheduler.schedule(time + SpaceInvadersApplication::machineCyclesPerFrame, *this, event);
+    }
+} // namespace emulator
@@ -0,0 +1,270 @@
+#include "save_state.hpp"
+
+#include "emulator_exception.hpp"
+
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <fcntl.h>
+    #include <sys/mman.h>
+    #include <sys/stat.h>
+    #include <unistd.h>
+#endif
+
+namespace emulator
+{
+    static_assert(std::is_trivially_copyable<SaveState>::value, "A save state is copied as bytes.");
+
+    namespace
+    {
+        constexpr char saveStateMagic[8] = {'I', '8', '0', '8', '0', 'S', 'A', 'V'};
+
+        /*
+            Mapping of a file of a fixed size into memory, either to read it or to create and write it.
+            The mapping is released, and a written file flushed to it, when the object is destroyed.
+        */
+        class MappedFile
+        {
+            public:
+                // Throws an EmulatorException with the name of function if the file can not be mapped,
+                // or if it is read and is not size bytes long.
+                MappedFile(const std::string& path, std::size_t size_, bool write, const char* function): size(size_)
+                {
+                    #if defined(_WIN32)
+                        file = CreateFileA(path.c_str(), write ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ,
+                            FILE_SHARE_READ, nullptr, write ? CREATE_ALWAYS : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+
+                        if (file == INVALID_HANDLE_VALUE)
+                            throw EmulatorException("Unable to open file " + path + " in " + function + ".");
+
+                        LARGE_INTEGER fileSize{};
+                        if (!write && (!GetFileSizeEx(file, &fileSize) || static_cast<std::size_t>(fileSize.QuadPart) != size))
+                            fail(path, function);
+
+                        mapping = CreateFileMappingA(file, nullptr, write ? PAGE_READWRITE : PAGE_READONLY,
+                            0, static_cast<DWORD>(size), nullptr);
+
+                        if (mapping != nullptr)
+                            data = MapViewOfFile(mapping, write ? FILE_MAP_WRITE : FILE_MAP_READ, 0, 0, size);
+                    #else
+                        descriptor = write ? open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644) : open(path.c_str(), O_RDONLY);
+
+                        if (descriptor < 0)
+                            throw EmulatorException("Unable to open file " + path + " in " + function + ".");
+
+                        struct stat status{};
+                        if (write ? ftruncate(descriptor, size) != 0 :
+                            fstat(descriptor, &status) != 0 || static_cast<std::size_t>(status.st_size) != size)
+                        {
+                            fail(path, function);
+                        }
+
+                        data = mmap(nullptr, size, write ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, descriptor, 0);
+
+                        if (data == MAP_FAILED)
+                            data = nullptr;
+                    #endif
+
+                    if (data == nullptr)
+                        fail(path, function);
+                }
+
+                ~MappedFile()
+                {
+                    release();
+                }
+
+                MappedFile(const MappedFile&) = delete;
+                MappedFile& operator=(const MappedFile&) = delete;
+
+                void* getData() const { return data; }
+
+            private:
+                [[noreturn]] void fail(const std::string& path, const char* function)
+                {
+                    release();
+                    throw EmulatorException("The file " + path + " is not a save state of this version in " + function + ".");
+                }
+
+                void release()
+                {
+                    #if defined(_WIN32)
+                        if (data != nullptr)
+                            UnmapViewOfFile(data);
+                        if (mapping != nullptr)
+                            CloseHandle(mapping);
+                        if (file != INVALID_HANDLE_VALUE)
+                            CloseHandle(file);
+
+                        mapping = nullptr;
+                        file = INVALID_HANDLE_VALUE;
+                    #else
+                        if (data != nullptr)
+                            munmap(data, size);
+                        if (descriptor >= 0)
+                            close(descriptor);
+
+                        descriptor = -1;
+                    #endif
+
+                    data = nullptr;
+                }
+
+                std::size_t size;
+                void* data = nullptr;
+
+                #if defined(_WIN32)
+                    HANDLE file = INVALID_HANDLE_VALUE;
+                    HANDLE mapping = nullptr;
+                #else
+                    int descriptor = -1;
+                #endif
+        };
+    } // namespace
+
+    SaveState::SaveState(): size(sizeof(SaveState))
+    {
+        std::memcpy(magic.data(), saveStateMagic, sizeof(saveStateMagic));
+    }
+
+    void SaveState::save(const Machine& machine)
+    {
+        if (machine.memory.getRamSize() != ramSize)
+        {
+            throw EmulatorException("RAM of " + std::to_string(machine.memory.getRamSize()) + " bytes instead of " +
+                std::to_string(ramSize) + " in SaveState::save.");
+        }
+
+        romHash = machine.romHash;
+
+        const CpuState& state = machine.cpu.getState();
+
+        for (byte i = 0; i < cpuState.registers.size(); ++i)
+            cpuState.registers[i] = state.getRegister(i);
+
+        cpuState.PC = state.PC;
+        cpuState.SP = state.SP;
+        cpuState.halted = state.halted;
+        cpuState.interruptsEnabled = state.interruptsEnabled;
+        cpuState.flagsOperation = static_cast<byte>(state.flagsOperation);
+        cpuState.flagsAccumulator = state.flagsAccumulator;
+        cpuState.flagsOperand = state.flagsOperand;
+        cpuState.flagsCarry = state.flagsCarry;
+        cpuState.flagsResult = state.flagsResult;
+
+        executedInstructionCycles = machine.cpu.getExecutedInstructionCyles();
+        executedMachineCycles = machine.cpu.getExecutedMachineCyles();
+
+        ioState = machine.io.getState();
+
+        std::memcpy(ram.data(), machine.memory.getRam(), ramSize);
+    }
+
+    void SaveState::load(const Machine& machine) const
+    {
+        checkValid("SaveState::load");
+
+        if (romHash != machine.romHash)
+            throw EmulatorException("The state was saved with a different ROM in SaveState::load.");
+
+        if (machine.memory.getRamSize() != ramSize)
+        {
+            throw EmulatorException("RAM of " + std::to_string(machine.memory.getRamSize()) + " bytes instead of " +
+                std::to_string(ramSize) + " in SaveState::load.");
+        }
+
+        machine.cpu.setState(getCpuState(), static_cast<std::size_t>(executedInstructionCycles),
+            static_cast<std::size_t>(executedMachineCycles));
+        machine.io.setState(ioState);
+        machine.memory.loadRam(ram.data());
+    }
+
+    void SaveState::saveToFile(const std::string& path) const
+    {
+        MappedFile file(path, sizeof(SaveState), true, "SaveState::saveToFile");
+        std::memcpy(file.getData(), this, sizeof(SaveState));
+    }
+
+    void SaveState::loadFromFile(const std::string& path)
+    {
+        SaveState loaded;
+
+        {
+            MappedFile file(path, sizeof(SaveState), false, "SaveState::loadFromFile");
+            std::memcpy(&loaded, file.getData(), sizeof(SaveState));
+        }
+
+        loaded.checkValid("SaveState::loadFromFile");
+        *this = loaded;
+    }
+
+    void SaveState::checkValid(const char* function) const
+    {
+        if (std::memcmp(magic.data(), saveStateMagic, sizeof(saveStateMagic)) != 0 || byteOrder != byteOrderMark ||
+            size != sizeof(SaveState))
+        {
+            throw EmulatorException(std::string("Not a save state of this layout in ") + function + ".");
+        }
+
+        if (fileVersion != version)
+        {
+            throw EmulatorException("Save state of version " + std::to_string(fileVersion) + " instead of " +
+                std::to_string(version) + " in " + function + ".");
+        }
+
+        // The bytes of the cpu state index the tables of the flags, hence they are restricted to the values
+        // which the instructions record (see CpuState::recordFlags).
+        constexpr byte flagsMask = alu::signFlag | alu::zeroFlag | alu::auxiliaryCarryFlag | alu::parityFlag | alu::carryFlag;
+
+        bool validCarry = false;
+
+        switch (static_cast<CpuState::FlagsOperation>(cpuState.flagsOperation))
+        {
+            case CpuState::FlagsOperation::None:
+                validCarry = true;
+                break;
+            case CpuState::FlagsOperation::Add:
+            case CpuState::FlagsOperation::Subtract:
+                validCarry = cpuState.flagsCarry <= 1;
+                break;
+            case CpuState::FlagsOperation::Increment:
+            case CpuState::FlagsOperation::Decrement:
+                validCarry = (cpuState.flagsCarry & ~alu::carryFlag) == 0;
+                break;
+            case CpuState::FlagsOperation::Logic:
+                validCarry = (cpuState.flagsCarry & ~alu::auxiliaryCarryFlag) == 0;
+                break;
+        }
+
+        // Saved from getRegister, index 6 is F.
+        if (!validCarry || (cpuState.registers[6] & ~flagsMask) != 0 || cpuState.halted > 1 ||
+            cpuState.interruptsEnabled > 1)
+        {
+            throw EmulatorException(std::string("Save state with an invalid cpu state in ") + function + ".");
+        }
+    }
+
+    CpuState SaveState::getCpuState() const
+    {
+        CpuState state;
+
+        for (byte i = 0; i < cpuState.registers.size(); ++i)
+            state.getRegister(i) = cpuState.registers[i];
+
+        state.PC = cpuState.PC;
+        state.SP = cpuState.SP;
+        state.halted = cpuState.halted != 0;
+        state.interruptsEnabled = cpuState.interruptsEnabled != 0;
+        state.flagsOperation = static_cast<CpuState::FlagsOperation>(cpuState.flagsOperation);
+        state.flagsAccumulator = cpuState.flagsAccumulator;
+        state.flagsOperand = cpuState.flagsOperand;
+        state.flagsCarry = cpuState.flagsCarry;
+        state.flagsResult = cpuState.flagsResult;
+
+        return state;
+    }
+} // namespace emulator
@@ -0,0 +1,58 @@
+#include "scheduler.hpp"
+
+#include "cpu.hpp"
+
+#include <algorithm>
+
+namespace emulator
+{
+    void Scheduler::schedule(std::size_t time, ScheduledDevice& device, int event)
+    {
+        events.push_back(Event{time, scheduledEventCount++, &device, event});
+        std::push_heap(events.begin(), events.end(), isLater);
+    }
+
+    void Scheduler::clear()
+    {
+        events.clear();
+    }
+
+    std::size_t Scheduler::run(CpuBase& cpu, std::size_t machineCycles)
+    {
+        const std::size_t previousExecutedMachineCycles = cpu.getExecutedMachineCyles();
+        const std::size_t targetMachineCycles = previousExecutedMachineCycles + machineCycles;
+
+        while (true)
+        {
+            // A device may schedule events which are already due, and interrupts add machine cycles.
+            while (hasEvents() && getNextEventTime() <= cpu.getExecutedMachineCyles())
+                dispatchNextEvent();
+
+            std::size_t executedMachineCycles = cpu.getExecutedMachineCyles();
+            if (executedMachineCycles >= targetMachineCycles)
+                break;
+
+            std::size_t untilMachineCycles = hasEvents() ? std::min(getNextEventTime(), targetMachineCycles) : targetMachineCycles;
+
+            // A halted cpu with interrupts enabled skips to the end of the budget, otherwise it never resumes.
+            if (cpu.run(untilMachineCycles - executedMachineCycles) == 0)
+                break;
+        }
+
+        return cpu.getExecutedMachineCyles() - previousExecutedMachineCycles;
+    }
+
+    bool Scheduler::isLater(const Event& left, const Event& right)
+    {
+        return left.time != right.time ? left.time > right.time : left.sequence > right.sequence;
+    }
+
+    void Scheduler::dispatchNextEvent()
+    {
+        std::pop_heap(events.begin(), events.end(), isLater);
+        Event event = events.back();
+        events.pop_back();
+
+        event.device->onEvent(event.event, event.time);
+    }
+} // namespace emulator
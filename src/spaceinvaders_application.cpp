@@ -1,38 +1,187 @@
 #include "spaceinvaders_application.hpp"
+#include "emulator_exception.hpp"
+#include "hash.hpp"
+#include "jit_cpu.hpp"
+#include "recompiled_cpu.hpp"
 
 #include "to_hex_string.hpp"
 
+#include <chrono>
+#include <fstream>
+#include <thread>
+
 namespace emulator
 {
-    SpaceInvadersApplication::SpaceInvadersApplication(): memory(0x2000, 0x2000), io(), cpu(memory, io),
+    SpaceInvadersApplication::SpaceInvadersApplication(CpuType cpuType, bool profile, bool scanlines_,
+        Upscaler::Filter filter):
+        memory(romSize, ramSize), io(), audio(io),
         window(sf::VideoMode(SpaceInvadersVideo::optimalWindowWidth, SpaceInvadersVideo::optimalWindowHeight), 
                 "intel 8080 - Space Invaders"),
-        video(window, memory)
-    {}
+        video(window, memory, filter), scanlines(scanlines_)
+    {
+        mapMirrors(memory);
+
+        cpu = createCpu(cpuType, memory, io);
+        io.setCpu(cpu.get());
+
+        if (profile)
+        {
+            profiler = std::make_unique<OpcodeProfiler>();
+            cpu->setProfiler(profiler.get());
+        }
+    }
+
+    std::unique_ptr<CpuBase> SpaceInvadersApplication::createCpu(CpuType cpuType, Memory& memory, SpaceInvadersIO& io)
+    {
+        std::unique_ptr<CpuBase> cpu;
+
+        switch (cpuType)
+        {
+            case CpuType::Unchecked:
+                cpu = std::make_unique<SpaceInvadersCpu<UncheckedPolicy>>(memory, io);
+                break;
+            case CpuType::Checked:
+                cpu = std::make_unique<SpaceInvadersCpu<CheckedPolicy>>(memory, io);
+                break;
+            case CpuType::Jit:
+                cpu = std::make_unique<JitCpu>(memory, io);
+                break;
+            case CpuType::Recompiled:
+                cpu = std::make_unique<RecompiledCpu>(memory, io, spaceInvadersProgram);
+                break;
+        }
+
+        // The game runs from ROM, of which the decoded instructions never have to be discarded.
+        // This also applies to the instructions which the other cpus leave to the interpreter.
+        cpu->setDispatchMethod(CpuBase::DispatchMethod::Fused);
+
+        return cpu;
+    }
+
+    void SpaceInvadersApplication::mapMirrors(Memory& memory)
+    {
+        // The cabinet decodes only 14 address lines: the 8KB of RAM (work RAM and video RAM) repeat
+        // up to the end of the address space.
+        memory.mapMirror(romSize + ramSize, Memory::maxMemorySize - romSize - ramSize, romSize, ramSize);
+    }
 
     void SpaceInvadersApplication::run()
     {
         memory.loadMemoryFromFile("roms/invaders.rom");
+        scheduleFrameEvents(0);
+
+        romHash = hashBytes(memory.getRom(), memory.getRomSize());
 
-        window.setFramerateLimit(240);
-        
-        sf::Clock frametimeClock;
-        while (window.isOpen())
+        if (!initialStatePath.empty())
+        {
+            if (!moviePath.empty())
+                throw EmulatorException("A movie is recorded from reset, not from a saved state, in SpaceInvadersApplication::run.");
+
+            saveState.loadFromFile(initialStatePath);
+            hasSaveState = true;
+            loadMachineState();
+        }
+
+        if (!moviePath.empty())
+            movie = std::make_unique<InputMovie>(romHash);
+
+        running = true;
+        std::thread emulation(&SpaceInvadersApplication::emulate, this);
+
+        while (window.isOpen() && running)
         {
             handleEvents();
+            audio.update();
+
+            // A frame is only drawn once. Until the emulation publishes the next one, the thread waits
+            // rather than presenting the same frame again. The video covers the whole window, so it is
+            // not cleared first.
+            if (video.draw())
+                window.display();
+            else
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+
+        running = false;
+        emulation.join();
+
+        // The input which led to a failure is saved as well, to reproduce it.
+        if (movie)
+            movie->save(moviePath);
+
+        if (emulationException)
+            std::rethrow_exception(emulationException);
 
-            float delta = frametimeClock.getElapsedTime().asSeconds();
-            frametimeClock.restart();
+        if (profiler)
+        {
+            std::ofstream profileFile("opcode_profile.txt");
+            profiler->writeReport(profileFile);
+        }
+    }
+
+    void SpaceInvadersApplication::emulate()
+    {
+        try
+        {
+            auto previousTime = std::chrono::steady_clock::now();
+
+            while (running)
+            {
+                KeyEvent keyEvent;
+                while (keyEvents.pop(keyEvent))
+                {
+                    io.setKeyPressed(keyEvent.key, keyEvent.pressed);
 
-            update(delta);
+                    if (keyEvent.pressed && keyEvent.key == sf::Keyboard::F5)
+                        saveMachineState();
+                    else if (keyEvent.pressed && keyEvent.key == sf::Keyboard::F9)
+                        loadMachineState();
+                }
 
-            draw();
+                auto time = std::chrono::steady_clock::now();
+                update(std::chrono::duration<float>(time - previousTime).count());
+                previousTime = time;
+
+                std::this_thread::sleep_for(std::chrono::milliseconds(1));
+            }
         }
+        catch (...)
+        {
+            emulationException = std::current_exception();
+            running = false;
+        }
+    }
+
+    SaveState::Machine SpaceInvadersApplication::getMachine()
+    {
+        return SaveState::Machine{*cpu, memory, io, romHash};
+    }
+
+    void SpaceInvadersApplication::saveMachineState()
+    {
+        saveState.save(getMachine());
+        saveState.saveToFile(saveStateFileName);
+        hasSaveState = true;
+    }
+
+    void SpaceInvadersApplication::loadMachineState()
+    {
+        if (!hasSaveState || movie)
+            return;
+
+        saveState.load(getMachine());
+
+        // The frame events are not saved, they recur at the same times in every frame.
+        scheduler.clear();
+        scheduleFrameEvents(cpu->getExecutedMachineCyles());
     }
 
     void SpaceInvadersApplication::reset()
     {
-        cpu.reset();
+        cpu->reset();
+
+        scheduler.clear();
+        scheduleFrameEvents(0);
     }
 
     void SpaceInvadersApplication::quit()
@@ -47,6 +196,9 @@ namespace emulator
 
         if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::Escape)
             quit();
+
+        if (event.type == sf::Event::KeyPressed || event.type == sf::Event::KeyReleased)
+            pendingKeyEvents.push_back(KeyEvent{event.key.code, event.type == sf::Event::KeyPressed});
     }
 
     void SpaceInvadersApplication::handleEvents()
@@ -54,50 +206,99 @@ namespace emulator
         sf::Event event;
         while (window.pollEvent(event))
             onEvent(event);
+
+        // While the emulation lags behind, the events stay pending in order.
+        while (!pendingKeyEvents.empty() && keyEvents.push(pendingKeyEvents.front()))
+            pendingKeyEvents.pop_front();
     }
 
     void SpaceInvadersApplication::update(float delta)
     {
-        // By default the intel 8080 processor runs at 2 MHz.
-        machineCyclesToBeExecuted += delta * 2'000'000;
+        machineCyclesToBeExecuted += delta * clockFrequency;
 
-        while (machineCyclesToBeExecuted > 0)
+        if (machineCyclesToBeExecuted > 0)
+            machineCyclesToBeExecuted -= scheduler.run(*cpu, machineCyclesToBeExecuted);
+    }
+
+    void SpaceInvadersApplication::onEvent(int event, std::size_t time)
+    {
+        if (event >= FirstScanline)
         {
-            machineCyclesToBeExecuted -= cpu.executeInstructionCycle();
+            unsigned short scanline = event - FirstScanline;
+            video.updateScanline(scanline);
+
+            // The time is recomputed from the start of the frame, so the fractional machine cycles per
+            // scanline do not accumulate. The scanlines of the vertical blank are not rendered, hence skipped.
+            std::size_t frameTime = time - scanlineEndMachineCycles(scanline);
+
+            if (scanline + 1 < SpaceInvadersVideo::crtHeight)
+                scheduler.schedule(frameTime + scanlineEndMachineCycles(scanline + 1), *this, event + 1);
+            else
+                scheduler.schedule(frameTime + machineCyclesPerFrame + scanlineEndMachineCycles(0), *this, FirstScanline);
+
+            return;
         }
 
-        // The CRT in the space invaders cabinet had a refresh rate of 60Hz.
-        // Hence the frequency of either a RST1 or RST2 happing is 120Hz.
-        if (screenTimer.getElapsedTime().asSeconds() > 1/120.0f)
+        if (event == InputLatch)
         {
-            if (upperHalf)
-            {
+            // The key events received so far are applied by the emulation loop before running the cpu.
+            io.latchInput();
+
+            if (movie)
+                movie->addFrame(io.get(1), io.get(2));
+        }
+        else if (event == MidScreen)
+        {
+            if (!scanlines)
                 video.updateTopHalf();
 
-                // The Space Invaders cabinet issues a RST1 interrupt each time the top half of the
-                // screen is drawn by the CRT.
-                cpu.issueRSTInterrupt(Cpu::RestartInstructions::RST1);
-            }
-            else
-            {
+            // The Space Invaders cabinet issues a RST1 interrupt each time the top half of the
+            // screen is drawn by the CRT.
+            cpu->issueRSTInterrupt(CpuBase::RestartInstructions::RST1);
+        }
+        else
+        {
+            if (!scanlines)
                 video.updateBottomHalf();
 
-                // The Space Invaders cabinet issues a RST2 interrupt each time the bottom half of the 
-                // screen is drawn by the CRT.
-                cpu.issueRSTInterrupt(Cpu::RestartInstructions::RST2);
-            }
+            video.publishFrame();
 
-            screenTimer.restart();
-            upperHalf = !upperHalf;
+            // The Space Invaders cabinet issues a RST2 interrupt each time the bottom half of the 
+            // screen is drawn by the CRT, at the start of the vertical blank.
+            cpu->issueRSTInterrupt(CpuBase::RestartInstructions::RST2);
         }
+
+        scheduler.schedule(time + machineCyclesPerFrame, *this, event);
     }
 
-    void SpaceInvadersApplication::draw()
+    void SpaceInvadersApplication::scheduleFrameEvents(std::size_t time)
     {
-        window.clear(sf::Color::Black);
+        // The events which are due at the given time have been passed to onEvent already, hence every event
+        // is scheduled at its first time in a frame after it, either in the frame of the time or in the next.
+        std::size_t frameTime = time - time % machineCyclesPerFrame;
+        std::size_t timeInFrame = time - frameTime;
+
+        auto nextTime = [frameTime, timeInFrame](std::size_t eventTime)
+        {
+            return frameTime + (eventTime > timeInFrame ? eventTime : machineCyclesPerFrame + eventTime);
+        };
 
-        video.draw();
+        // The input is latched before an interrupt due at the same time is issued.
+        scheduler.schedule(nextTime(inputLatchMachineCycles), *this, InputLatch);
+        scheduler.schedule(nextTime(midScreenMachineCycles), *this, MidScreen);
+        scheduler.schedule(nextTime(machineCyclesPerFrame), *this, VerticalBlank);
 
-        window.display();
+        if (scanlines)
+        {
+            unsigned short scanline = 0;
+            while (scanline < SpaceInvadersVideo::crtHeight && scanlineEndMachineCycles(scanline) <= timeInFrame)
+                ++scanline;
+
+            if (scanline < SpaceInvadersVideo::crtHeight)
+                scheduler.schedule(frameTime + scanlineEndMachineCycles(scanline), *this, FirstScanline + scanline);
+            else
+                scheduler.schedule(nextTime(scanlineEndMachineCycles(0)), *this, FirstScanline);
+        }
     }
+
 } // namespace emulator
@@ -0,0 +1,114 @@
+#include "spaceinvaders_audio.hpp"
+
+#include <string>
+
+namespace emulator
+{
+    namespace
+    {
+        /*
+            Enum of the sounds available in the Space Invaders cabinet.
+        */
+        enum Sounds
+        {
+            Ufo = 0,
+            Shot,
+            Flash,
+            InvaderDie,
+            FleetMovement1,
+            FleetMovement2,
+            FleetMovement3,
+            FleetMovement4,
+            UfoHit
+        };
+
+        // The output ports attached to the intel 8080 that are responsible for playing sounds
+        // encode the different sounds using bitmasks.
+        // This is a table of the bit masks that correspond to the sounds defined in the above enumeration.
+        static const byte soundMasks[SpaceInvadersAudio::numberOfSounds] =
+        {
+            0x01,
+            0x02,
+            0x04,
+            0x08,
+            0x01,
+            0x02,
+            0x04,
+            0x08,
+            0x10
+        };
+
+        // Filenames of corresponding to the sounds mentioned in the above enumeration.
+        static const std::string soundFileNames[SpaceInvadersAudio::numberOfSounds] =
+        {
+            "sounds/ufo.wav",
+            "sounds/shot.wav",
+            "sounds/flash.wav",
+            "sounds/invader_die.wav",
+            "sounds/fleet_movement_1.wav",
+            "sounds/fleet_movement_2.wav",
+            "sounds/fleet_movement_3.wav",
+            "sounds/fleet_movement_4.wav",
+            "sounds/ufo_hit.wav"
+        };
+    }
+
+    SpaceInvadersAudio::SpaceInvadersAudio(SpaceInvadersIO& io_): io(io_)
+    {
+        // Load the sounds to be played by the Space Invaders game.
+        // If a sounds is not found we continue without error and simple don't play the sound.
+        for (std::size_t i = 0; i < numberOfSounds; ++i)
+        {
+            sounds[i].setVolume(soundVolume);
+            sounds[i].setLoop(false);
+
+            if (soundBuffers[i].loadFromFile(soundFileNames[i]))
+                sounds[i].setBuffer(soundBuffers[i]);
+        }
+    }
+
+    void SpaceInvadersAudio::update()
+    {
+        SpaceInvadersIO::SoundWrite write;
+
+        while (io.popSoundWrite(write))
+            handleWrite(write.port, write.value);
+
+        // Writes which were dropped from a full log are caught up with from the current values of the ports.
+        handleWrite(3, io.getSoundPort(3));
+        handleWrite(5, io.getSoundPort(5));
+
+        // The ufo sound is the only sound that is meant to be played repeatedly, for as long as its bit is set.
+        if ((port3Value & soundMasks[Sounds::Ufo]) != 0 && sounds[Sounds::Ufo].getStatus() != sf::Sound::Playing)
+            sounds[Sounds::Ufo].play();
+    }
+
+    void SpaceInvadersAudio::handleWrite(byte port, byte value)
+    {
+        if (port == 3)
+        {
+            // Port 3 handles 4 of the 9 sounds the Space Invaders cabinet can play.
+            handleNonrepeatingSounds(value, port3Value, 1, 3);
+            port3Value = value;
+        }
+        else
+        {
+            // Port 5 handles the remaining 5 sounds.
+            handleNonrepeatingSounds(value, port5Value, 4, 5);
+            port5Value = value;
+        }
+    }
+
+    void SpaceInvadersAudio::handleNonrepeatingSounds(byte value, byte previousValue, std::size_t first, std::size_t number)
+    {
+        for (std::size_t i = first; i < first + number; ++i)
+        {
+            if ((value & soundMasks[i]) != 0 &&
+                (previousValue & soundMasks[i]) == 0 &&
+                sounds[i].getStatus() != sf::Sound::Playing)
+            {
+                sounds[i].play();
+            }
+        }
+    }
+} // namespace emulator
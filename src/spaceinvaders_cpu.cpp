@@ -0,0 +1,10 @@
+#include "spaceinvaders_cpu.hpp"
+#include "cpu_impl.hpp"
+
+#include "spaceinvaders_io.hpp"
+
+namespace emulator
+{
+    template class BasicCpu<Memory, SpaceInvadersIO, CheckedPolicy>;
+    template class BasicCpu<Memory, SpaceInvadersIO, UncheckedPolicy>;
+} // namespace emulator
@@ -1,90 +1,31 @@
 #include "spaceinvaders_io.hpp"
 
+#include "cpu.hpp"
+
 #include <string>
 
 namespace emulator
 {
-    namespace
-    {
-        /*
-            Enum of the sounds available in the Space Invaders cabinet.
-        */
-        enum Sounds
-        {
-            Ufo = 0,
-            Shot,
-            Flash,
-            InvaderDie,
-            FleetMovement1,
-            FleetMovement2,
-            FleetMovement3,
-            FleetMovement4,
-            UfoHit     
-        };
-
-        // The output ports attached to the intel 8080 that are responsible for playing sounds
-        // encode the different sounds using bitmasks. 
-        // This is a table of the bit masks that correspond to the sounds defined in the above enumeration.
-        static const byte soundMasks[SpaceInvadersIO::numberOfSounds] = 
-        {
-            0x01,
-            0x02,
-            0x04,
-            0x08,
-            0x01,
-            0x02,
-            0x04,
-            0x08,
-            0x10 
-        };
-
-        // Filenames of corresponding to the sounds mentioned in the above enumeration.
-        static const std::string soundFileNames[SpaceInvadersIO::numberOfSounds] = 
-        {
-            "sounds/ufo.wav",
-            "sounds/shot.wav",
-            "sounds/flash.wav",
-            "sounds/invader_die.wav",
-            "sounds/fleet_movement_1.wav",
-            "sounds/fleet_movement_2.wav",
-            "sounds/fleet_movement_3.wav",
-            "sounds/fleet_movement_4.wav",
-            "sounds/ufo_hit.wav"
-        };
-    }
-
     SpaceInvadersIO::SpaceInvadersIO()
     {
-        // Set the key mappings to use for the different inputs encoded by the ports 1 and 2.
+        // Set the key mappings to use for the different inputs encoded by the ports 0, 1 and 2.
+        keyMapping[Fire] = sf::Keyboard::BackSlash;
+        keyMapping[Left] = sf::Keyboard::LBracket;
+        keyMapping[Right] = sf::Keyboard::RBracket;
 
-        // According to https://www.computerarcheology.com/Arcade/SpaceInvaders/
-        // these first three inputs are not actually used by the game's code.
-        keyMapping["Fire"] = sf::Keyboard::BackSlash;
-        keyMapping["Left"] = sf::Keyboard::LBracket;
-        keyMapping["Right"] = sf::Keyboard::RBracket;
+        keyMapping[CoinInserted] = sf::Keyboard::C;
+        keyMapping[TwoPlayersStart] = sf::Keyboard::Num2;
+        keyMapping[OnePlayerStart] = sf::Keyboard::Num1;
 
-        keyMapping["Coin Inserted"] = sf::Keyboard::C;
-        keyMapping["2 Players Start"] = sf::Keyboard::Num2;
-        keyMapping["1 Player Start"] = sf::Keyboard::Num1;
+        keyMapping[OnePlayerFire] = sf::Keyboard::Space;
+        keyMapping[OnePlayerLeft] = sf::Keyboard::Left;
+        keyMapping[OnePlayerRight] = sf::Keyboard::Right;
 
-        keyMapping["1 Player Fire"] = sf::Keyboard::Space;
-        keyMapping["1 Player Left"] = sf::Keyboard::Left;
-        keyMapping["1 Player Right"] = sf::Keyboard::Right;
+        keyMapping[TwoPlayerFire] = sf::Keyboard::LControl;
+        keyMapping[TwoPlayerLeft] = sf::Keyboard::A;
+        keyMapping[TwoPlayerRight] = sf::Keyboard::D;
 
-        keyMapping["2 Player Fire"] = sf::Keyboard::LControl;
-        keyMapping["2 Player Left"] = sf::Keyboard::A;
-        keyMapping["2 Player Right"] = sf::Keyboard::D;
-
-        // Load the sounds to be played by the Space Invaders game. 
-        // If a sounds is not found we continue without error and simple don't play the sound.
-        for (std::size_t i = 0; i < SpaceInvadersIO::numberOfSounds; ++i)
-        {
-            sounds[i].setVolume(soundVolume);
-            sounds[i].setLoop(false);
-
-            if (soundBuffers[i].loadFromFile(soundFileNames[i]))
-                sounds[i].setBuffer(soundBuffers[i]);
-        }
+        latchInput(0);
     }
 
     SpaceInvadersIO::~SpaceInvadersIO()
@@ -95,13 +36,9 @@ namespace emulator
         switch (port)
         {
             case 0:
-                return getPort0();
-            
             case 1:
-                return getPort1();
-
             case 2:
-                return getPort2();
+                return inputPorts[port];
 
             case 3:
                 return getPort3();
@@ -140,8 +77,29 @@ namespace emulator
         }
     }
 
-    byte SpaceInvadersIO::getPort0() const
+    void SpaceInvadersIO::setKeyPressed(sf::Keyboard::Key key, bool pressed)
     {
+        if (key >= 0 && key < sf::Keyboard::KeyCount)
+            pressedKeys[key] = pressed;
+    }
+
+    SpaceInvadersIO::InputState SpaceInvadersIO::getPressedInputs() const
+    {
+        InputState inputs = 0;
+
+        for (std::size_t input = 0; input < inputCount; ++input)
+        {
+            if (pressedKeys[keyMapping[input]])
+                inputs |= 1 << input;
+        }
+
+        return inputs;
+    }
+
+    void SpaceInvadersIO::latchInput(InputState inputs)
+    {
+        auto pressed = [inputs](Input input) { return (inputs >> input) & 1; };
+
         // Port 0 handles user input from the buttons on the cabinet.
         // However this port seems to be never used by the code.
 
@@ -158,15 +116,8 @@ namespace emulator
         bit 7 ?
         */
 
-       bool fire = sf::Keyboard::isKeyPressed(keyMapping.at("Fire"));
-       bool left = sf::Keyboard::isKeyPressed(keyMapping.at("Left"));
-       bool right = sf::Keyboard::isKeyPressed(keyMapping.at("Right"));
+        inputPorts[0] = 0b0000'1110 | (pressed(Fire) << 4) | (pressed(Left) << 5) | (pressed(Right) << 6);
 
-        return 0b0000'1110 | (fire << 4) | (left << 5) | (right << 6);
-    }
-
-    byte SpaceInvadersIO::getPort1() const
-    {
         // Port 1 handles user input from the buttons on the cabinet.
 
         /*
@@ -179,22 +130,12 @@ namespace emulator
         bit 5 = 1P left (1 if pressed)
         bit 6 = 1P right (1 if pressed)
         bit 7 = Not connected
-        */   
-
-        bool coinInserted = sf::Keyboard::isKeyPressed(keyMapping.at("Coin Inserted"));
-        bool twoPlayerStart = sf::Keyboard::isKeyPressed(keyMapping.at("2 Players Start"));
-        bool onePlayerStart = sf::Keyboard::isKeyPressed(keyMapping.at("1 Player Start"));
-
-        bool onePlayerFire = sf::Keyboard::isKeyPressed(keyMapping.at("1 Player Fire"));
-        bool onePlayerLeft = sf::Keyboard::isKeyPressed(keyMapping.at("1 Player Left"));
-        bool onePlayerRight = sf::Keyboard::isKeyPressed(keyMapping.at("1 Player Right"));
+        */
 
-        return 0b0000'1000 | coinInserted | (twoPlayerStart << 1) | (onePlayerStart << 2) |
-            (onePlayerFire << 4) | (onePlayerLeft << 5) | (onePlayerRight << 6);
-    }
+        inputPorts[1] = 0b0000'1000 | pressed(CoinInserted) | (pressed(TwoPlayersStart) << 1) |
+            (pressed(OnePlayerStart) << 2) | (pressed(OnePlayerFire) << 4) | (pressed(OnePlayerLeft) << 5) |
+            (pressed(OnePlayerRight) << 6);
 
-    byte SpaceInvadersIO::getPort2() const
-    {
         // Port 2 handles user input from the buttons on the cabinet.
 
         /*
@@ -209,12 +150,32 @@ namespace emulator
         bit 7 = DIP7 Coin info displayed in demo screen 0=ON
         */
 
-        bool twoPlayerFire = sf::Keyboard::isKeyPressed(keyMapping.at("2 Player Fire"));
-        bool twoPlayerLeft = sf::Keyboard::isKeyPressed(keyMapping.at("2 Player Left"));
-        bool twoPlayerRight = sf::Keyboard::isKeyPressed(keyMapping.at("2 Player Right"));
+        inputPorts[2] = 0b0000'0000 | dip3 | (dip5 << 1) | (dip6 << 3) | (pressed(TwoPlayerFire) << 4) |
+            (pressed(TwoPlayerLeft) << 5) | (pressed(TwoPlayerRight) << 6) | (dip7 << 7);
+    }
+
+    void SpaceInvadersIO::latchInputPorts(byte port1, byte port2)
+    {
+        latchInput(0);
+
+        inputPorts[1] = port1;
+        inputPorts[2] = port2;
+    }
+
+    SpaceInvadersIO::State SpaceInvadersIO::getState() const
+    {
+        return State{inputPorts, offset, shiftRegister, port3.load(std::memory_order_relaxed),
+            port5.load(std::memory_order_relaxed)};
+    }
+
+    void SpaceInvadersIO::setState(const State& state)
+    {
+        inputPorts = state.inputPorts;
+        offset = state.offset & 0b0000'0111;
+        shiftRegister = state.shiftRegister;
 
-        return 0b0000'0000 | dip3 | (dip5 << 1) | (dip6 << 3) | (twoPlayerFire << 4) |
-            (twoPlayerLeft << 5) | (twoPlayerRight << 6) | (dip7 << 7);
+        setSoundPort(3, state.port3, port3, loggedPort3);
+        setSoundPort(5, state.port5, port5, loggedPort5);
     }
 
     byte SpaceInvadersIO::getPort3() const
@@ -233,20 +194,8 @@ namespace emulator
 
     void SpaceInvadersIO::setPort3(byte value)
     {
-        // Port 3 handles 4 of the 9 sounds the Space Invaders cabinet can play.
-
-        // The ufo sound is the only sound that is meant to be played repeatedly.
-        if ((value & soundMasks[Sounds::Ufo]) != 0 && 
-            sounds[Sounds::Ufo].getStatus() != sf::Sound::Playing)
-        {
-            sounds[Sounds::Ufo].play();
-        }
-
-        handleNonrepeatingSounds(value, previousPort3Input, 1, 3);
-
-        previousPort3Input = value;
-
-        return;
+        // Port 3 handles 4 of the 9 sounds the Space Invaders cabinet can play (see SpaceInvadersAudio).
+        setSoundPort(3, value, port3, loggedPort3);
     }
 
     void SpaceInvadersIO::setPort4(byte value)
@@ -260,9 +209,7 @@ namespace emulator
     void SpaceInvadersIO::setPort5(byte value)
     {
         // Port 5 handles the remaining 5 sounds the Space Invaders cabinet can play.
-        handleNonrepeatingSounds(value, previousPort5Input, 4, 5);
-        previousPort5Input = value;
-        return;
+        setSoundPort(5, value, port5, loggedPort5);
     }
 
     void SpaceInvadersIO::setPort6(byte value)
@@ -274,19 +221,18 @@ namespace emulator
         return;
     }    
 
-    void SpaceInvadersIO::handleNonrepeatingSounds(byte value, byte previousValue, std::size_t first, std::size_t number)
+    void SpaceInvadersIO::setSoundPort(byte port, byte value, std::atomic<byte>& portValue, byte& loggedValue)
     {
-        // The sounds that are not meant to be repeating (that is, all but the ufo sound)
-        // are only played if the bit corresponding to that sound changed from 0 to 1
-        // since the last time the corresponding output port has been written to.
-        for (std::size_t i = first; i < first + number; ++i)
-        {
-            if ((value & soundMasks[i]) != 0 && 
-                (previousValue & soundMasks[i]) == 0 && 
-                sounds[i].getStatus() != sf::Sound::Playing)
-            {
-                sounds[i].play();
-            }
-        }
+        portValue.store(value, std::memory_order_release);
+
+        // A sound starts when its bit is set, hence writes which leave the port unchanged start none.
+        if (value == loggedValue)
+            return;
+
+        std::size_t time = cpu != nullptr ? cpu->getExecutedMachineCyles() : 0;
+
+        // A write which is dropped is not taken as logged, such that the next write to the port is logged.
+        if (soundWrites.push(SoundWrite{time, port, value}))
+            loggedValue = value;
     }
 } // namespace emulator
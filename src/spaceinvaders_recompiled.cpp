@@ -0,0 +1,16072 @@
+// Generated by static_recompiler.py, do not edit.
+// 578 basic blocks translated from a ROM of 8192 bytes.
+
+#include "recompiled_cpu.hpp"
+#include "spaceinvaders_io.hpp"
+#include "alu_tables.hpp"
+
+namespace emulator
+{
+    namespace
+    {
+        // 22 machine cycles at most.
+        void block0x0000(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0000: NOP
+
+            // 0x0001: NOP
+
+            // 0x0002: NOP
+
+            // 0x0003: JMP 18D4
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 22;
+            s.PC = 0x18D4;
+            return;
+        }
+
+        // 54 machine cycles at most.
+        void block0x0008(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0008: PUSH PSW
+            {
+                m.set<false>(s.SP - 1, s.A);
+                m.set<false>(s.SP - 2, s.packFlags());
+                s.SP -= 2;
+            }
+
+            // 0x0009: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x000A: PUSH DE
+            {
+                m.setWord<false>(s.SP - 2, s.getDE());
+                s.SP -= 2;
+            }
+
+            // 0x000B: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x000C: JMP 008C
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 54;
+            s.PC = 0x008C;
+            return;
+        }
+
+        // 101 machine cycles at most.
+        void block0x0010(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0010: PUSH PSW
+            {
+                m.set<false>(s.SP - 1, s.A);
+                m.set<false>(s.SP - 2, s.packFlags());
+                s.SP -= 2;
+            }
+
+            // 0x0011: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x0012: PUSH DE
+            {
+                m.setWord<false>(s.SP - 2, s.getDE());
+                s.SP -= 2;
+            }
+
+            // 0x0013: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x0014: MVI A, 80
+            {
+                s.A = 0x80;
+            }
+
+            // 0x0016: STA 2072
+            {
+                m.set<false>(0x2072, s.A);
+            }
+
+            // 0x0019: LXI HL, 20C0
+            {
+                s.setHL(0x20C0);
+            }
+
+            // 0x001C: DCR M
+            {
+                word address = s.getHL();
+                byte value = m.get<false>(address);
+                s.setDecrementFlags(value);
+                m.set<false>(address, --value);
+            }
+
+            // 0x001D: CALL 17CD
+            m.setWord<false>(s.SP - 2, 0x0020);
+            s.SP -= 2;
+            context.executedInstructionCycles += 9;
+            context.executedMachineCycles += 101;
+            s.PC = 0x17CD;
+            return;
+        }
+
+        // 24 machine cycles at most.
+        void block0x0020(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x0020: IN 01
+            {
+                s.A = io.get(0x01);
+            }
+
+            // 0x0022: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0023: JC 0067
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 24;
+                s.PC = 0x0067;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 24;
+            s.PC = 0x0026;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0026(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0026: LDA 20EA
+            {
+                s.A = m.get<false>(0x20EA);
+            }
+
+            // 0x0029: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x002A: JZ 0042
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0042;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x002D;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x002D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x002D: LDA 20EB
+            {
+                s.A = m.get<false>(0x20EB);
+            }
+
+            // 0x0030: CPI 99
+            {
+                byte value = 0x99;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0032: JZ 003E
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 30;
+                s.PC = 0x003E;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0035;
+            return;
+        }
+
+        // 41 machine cycles at most.
+        void block0x0035(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0035: ADI 01
+            {
+                byte value = 0x01;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x0037: DAA
+            {
+                const alu::DecimalAdjustment& adjustment = alu::decimalAdjustments[alu::decimalAdjustIndex(s.A, s.getCY(), s.getCA())];
+                s.A = adjustment.result;
+                s.unpackFlags(adjustment.flags);
+            }
+
+            // 0x0038: STA 20EB
+            {
+                m.set<false>(0x20EB, s.A);
+            }
+
+            // 0x003B: CALL 1947
+            m.setWord<false>(s.SP - 2, 0x003E);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 41;
+            s.PC = 0x1947;
+            return;
+        }
+
+        // 4 machine cycles at most.
+        void block0x003E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x003E: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 4;
+            s.PC = 0x003F;
+            return;
+        }
+
+        // 13 machine cycles at most.
+        void block0x003F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x003F: STA 20EA
+            {
+                m.set<false>(0x20EA, s.A);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 13;
+            s.PC = 0x0042;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0042(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0042: LDA 20E9
+            {
+                s.A = m.get<false>(0x20E9);
+            }
+
+            // 0x0045: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0046: JZ 0082
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0082;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0049;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0049(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0049: LDA 20EF
+            {
+                s.A = m.get<false>(0x20EF);
+            }
+
+            // 0x004C: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x004D: JNZ 006F
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x006F;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0050;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0050(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0050: LDA 20EB
+            {
+                s.A = m.get<false>(0x20EB);
+            }
+
+            // 0x0053: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0054: JNZ 005D
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x005D;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0057;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0057(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0057: CALL 0ABF
+            m.setWord<false>(s.SP - 2, 0x005A);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0ABF;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x005A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x005A: JMP 0082
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0082;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x005D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x005D: LDA 2093
+            {
+                s.A = m.get<false>(0x2093);
+            }
+
+            // 0x0060: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0061: JNZ 0082
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0082;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0064;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0064(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0064: JMP 0765
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0765;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0067(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0067: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x0069: STA 20EA
+            {
+                m.set<false>(0x20EA, s.A);
+            }
+
+            // 0x006C: JMP 003F
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x003F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x006F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x006F: CALL 1740
+            m.setWord<false>(s.SP - 2, 0x0072);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1740;
+            return;
+        }
+
+        // 43 machine cycles at most.
+        void block0x0072(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0072: LDA 2032
+            {
+                s.A = m.get<false>(0x2032);
+            }
+
+            // 0x0075: STA 2080
+            {
+                m.set<false>(0x2080, s.A);
+            }
+
+            // 0x0078: CALL 0100
+            m.setWord<false>(s.SP - 2, 0x007B);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 43;
+            s.PC = 0x0100;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x007B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x007B: CALL 0248
+            m.setWord<false>(s.SP - 2, 0x007E);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0248;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x007E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x007E: CALL 0913
+            m.setWord<false>(s.SP - 2, 0x0081);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0913;
+            return;
+        }
+
+        // 4 machine cycles at most.
+        void block0x0081(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0081: NOP
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 4;
+            s.PC = 0x0082;
+            return;
+        }
+
+        // 54 machine cycles at most.
+        void block0x0082(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0082: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0083: POP DE
+            {
+                s.setDE(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0084: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0085: POP PSW
+            {
+                s.unpackFlags(m.get<false>(s.SP));
+                s.A = m.get<false>(s.SP + 1);
+                s.SP += 2;
+            }
+
+            // 0x0086: EI
+            {
+                s.interruptsEnabled = true;
+            }
+
+            // 0x0087: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 54;
+            s.PC = target;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x008C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x008C: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x008D: STA 2072
+            {
+                m.set<false>(0x2072, s.A);
+            }
+
+            // 0x0090: LDA 20E9
+            {
+                s.A = m.get<false>(0x20E9);
+            }
+
+            // 0x0093: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0094: JZ 0082
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 44;
+                s.PC = 0x0082;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 44;
+            s.PC = 0x0097;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0097(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0097: LDA 20EF
+            {
+                s.A = m.get<false>(0x20EF);
+            }
+
+            // 0x009A: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x009B: JNZ 00A5
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x00A5;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x009E;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x009E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x009E: LDA 20C1
+            {
+                s.A = m.get<false>(0x20C1);
+            }
+
+            // 0x00A1: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x00A2: JNC 0082
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0082;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x00A5;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x00A5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x00A5: LXI HL, 2020
+            {
+                s.setHL(0x2020);
+            }
+
+            // 0x00A8: CALL 024B
+            m.setWord<false>(s.SP - 2, 0x00AB);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x024B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x00AB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x00AB: CALL 0141
+            m.setWord<false>(s.SP - 2, 0x00AE);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0141;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x00AE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x00AE: JMP 0082
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0082;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x00B1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x00B1: CALL 0886
+            m.setWord<false>(s.SP - 2, 0x00B4);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0886;
+            return;
+        }
+
+        // 106 machine cycles at most.
+        void block0x00B4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x00B4: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x00B5: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x00B6: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x00B7: MOV H, M
+            {
+                s.H = m.get<false>(s.getHL());
+            }
+
+            // 0x00B8: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x00B9: SHLD 2009
+            {
+                m.setWord<false>(0x2009, s.getHL());
+            }
+
+            // 0x00BC: SHLD 200B
+            {
+                m.setWord<false>(0x200B, s.getHL());
+            }
+
+            // 0x00BF: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x00C0: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x00C1: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x00C2: CPI 03
+            {
+                byte value = 0x03;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x00C4: JNZ 00C8
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 12;
+                context.executedMachineCycles += 106;
+                s.PC = 0x00C8;
+                return;
+            }
+
+            context.executedInstructionCycles += 12;
+            context.executedMachineCycles += 106;
+            s.PC = 0x00C7;
+            return;
+        }
+
+        // 5 machine cycles at most.
+        void block0x00C7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x00C7: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x00C8;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x00C8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x00C8: STA 2008
+            {
+                m.set<false>(0x2008, s.A);
+            }
+
+            // 0x00CB: CPI FE
+            {
+                byte value = 0xFE;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x00CD: MVI A, 00
+            {
+                s.A = 0x00;
+            }
+
+            // 0x00CF: JNZ 00D3
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 37;
+                s.PC = 0x00D3;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 37;
+            s.PC = 0x00D2;
+            return;
+        }
+
+        // 5 machine cycles at most.
+        void block0x00D2(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x00D2: INR A
+            {
+                s.setIncrementFlags(s.A);
+                ++s.A;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x00D3;
+            return;
+        }
+
+        // 23 machine cycles at most.
+        void block0x00D3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x00D3: STA 200D
+            {
+                m.set<false>(0x200D, s.A);
+            }
+
+            // 0x00D6: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 23;
+            s.PC = target;
+            return;
+        }
+
+        // 43 machine cycles at most.
+        void block0x00D7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x00D7: MVI A, 02
+            {
+                s.A = 0x02;
+            }
+
+            // 0x00D9: STA 21FB
+            {
+                m.set<false>(0x21FB, s.A);
+            }
+
+            // 0x00DC: STA 22FB
+            {
+                m.set<false>(0x22FB, s.A);
+            }
+
+            // 0x00DF: JMP 08E4
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 43;
+            s.PC = 0x08E4;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x0100(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0100: LXI HL, 2002
+            {
+                s.setHL(0x2002);
+            }
+
+            // 0x0103: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x0104: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0105: JNZ 1538
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 31;
+                s.PC = 0x1538;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 31;
+            s.PC = 0x0108;
+            return;
+        }
+
+        // 78 machine cycles at most.
+        void block0x0108(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0108: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x0109: LDA 2006
+            {
+                s.A = m.get<false>(0x2006);
+            }
+
+            // 0x010C: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x010D: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x0110: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x0111: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x0112: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0113: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0114: JZ 0136
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 9;
+                context.executedMachineCycles += 78;
+                s.PC = 0x0136;
+                return;
+            }
+
+            context.executedInstructionCycles += 9;
+            context.executedMachineCycles += 78;
+            s.PC = 0x0117;
+            return;
+        }
+
+        // 110 machine cycles at most.
+        void block0x0117(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0117: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0118: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0119: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x011A: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x011B: MOV B, M
+            {
+                s.B = m.get<false>(s.getHL());
+            }
+
+            // 0x011C: ANI FE
+            {
+                byte value = 0xFE;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x011E: RLC
+            {
+                s.setCY((s.A & 0x80) != 0);
+                s.A = (s.A << 1) | (s.A >> 7);
+            }
+
+            // 0x011F: RLC
+            {
+                s.setCY((s.A & 0x80) != 0);
+                s.A = (s.A << 1) | (s.A >> 7);
+            }
+
+            // 0x0120: RLC
+            {
+                s.setCY((s.A & 0x80) != 0);
+                s.A = (s.A << 1) | (s.A >> 7);
+            }
+
+            // 0x0121: MOV E, A
+            {
+                s.E = s.A;
+            }
+
+            // 0x0122: MVI D, 00
+            {
+                s.D = 0x00;
+            }
+
+            // 0x0124: LXI HL, 1C00
+            {
+                s.setHL(0x1C00);
+            }
+
+            // 0x0127: DAD DE
+            {
+                word value = s.getDE();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x0128: XCHG
+            {
+                word value = s.getHL();
+                s.setHL(s.getDE());
+                s.setDE(value);
+            }
+
+            // 0x0129: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x012A: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x012B: CNZ 013B
+            if (!s.getZ())
+            {
+                m.setWord<false>(s.SP - 2, 0x012E);
+                s.SP -= 2;
+                context.executedInstructionCycles += 17;
+                context.executedMachineCycles += 110;
+                s.PC = 0x013B;
+                return;
+            }
+
+            context.executedInstructionCycles += 17;
+            context.executedMachineCycles += 104;
+            s.PC = 0x012E;
+            return;
+        }
+
+        // 40 machine cycles at most.
+        void block0x012E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x012E: LHLD 200B
+            {
+                s.setHL(m.getWord<false>(0x200B));
+            }
+
+            // 0x0131: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            // 0x0133: CALL 15D3
+            m.setWord<false>(s.SP - 2, 0x0136);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 40;
+            s.PC = 0x15D3;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0136(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0136: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0137: STA 2000
+            {
+                m.set<false>(0x2000, s.A);
+            }
+
+            // 0x013A: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = target;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x013B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x013B: LXI HL, 0030
+            {
+                s.setHL(0x0030);
+            }
+
+            // 0x013E: DAD DE
+            {
+                word value = s.getDE();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x013F: XCHG
+            {
+                word value = s.getHL();
+                s.setHL(s.getDE());
+                s.setDE(value);
+            }
+
+            // 0x0140: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 34;
+            s.PC = target;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x0141(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0141: LDA 2068
+            {
+                s.A = m.get<false>(0x2068);
+            }
+
+            // 0x0144: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0145: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x0146;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x0146(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0146: LDA 2000
+            {
+                s.A = m.get<false>(0x2000);
+            }
+
+            // 0x0149: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x014A: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x014B;
+            return;
+        }
+
+        // 38 machine cycles at most.
+        void block0x014B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x014B: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x014E: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x014F: LDA 2006
+            {
+                s.A = m.get<false>(0x2006);
+            }
+
+            // 0x0152: MVI D, 02
+            {
+                s.D = 0x02;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 38;
+            s.PC = 0x0154;
+            return;
+        }
+
+        // 29 machine cycles at most.
+        void block0x0154(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0154: INR A
+            {
+                s.setIncrementFlags(s.A);
+                ++s.A;
+            }
+
+            // 0x0155: CPI 37
+            {
+                byte value = 0x37;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0157: CZ 01A1
+            if (s.getZ())
+            {
+                m.setWord<false>(s.SP - 2, 0x015A);
+                s.SP -= 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 29;
+                s.PC = 0x01A1;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 23;
+            s.PC = 0x015A;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x015A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x015A: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x015B: MOV B, M
+            {
+                s.B = m.get<false>(s.getHL());
+            }
+
+            // 0x015C: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x015D: JNZ 0154
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0154;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0160;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0160(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0160: STA 2006
+            {
+                m.set<false>(0x2006, s.A);
+            }
+
+            // 0x0163: CALL 017A
+            m.setWord<false>(s.SP - 2, 0x0166);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 30;
+            s.PC = 0x017A;
+            return;
+        }
+
+        // 43 machine cycles at most.
+        void block0x0166(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0166: MOV H, C
+            {
+                s.H = s.C;
+            }
+
+            // 0x0167: SHLD 200B
+            {
+                m.setWord<false>(0x200B, s.getHL());
+            }
+
+            // 0x016A: MOV A, L
+            {
+                s.A = s.L;
+            }
+
+            // 0x016B: CPI 28
+            {
+                byte value = 0x28;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x016D: JC 1971
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 43;
+                s.PC = 0x1971;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 43;
+            s.PC = 0x0170;
+            return;
+        }
+
+        // 48 machine cycles at most.
+        void block0x0170(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0170: MOV A, D
+            {
+                s.A = s.D;
+            }
+
+            // 0x0171: STA 2004
+            {
+                m.set<false>(0x2004, s.A);
+            }
+
+            // 0x0174: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x0176: STA 2000
+            {
+                m.set<false>(0x2000, s.A);
+            }
+
+            // 0x0179: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 48;
+            s.PC = target;
+            return;
+        }
+
+        // 41 machine cycles at most.
+        void block0x017A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x017A: MVI D, 00
+            {
+                s.D = 0x00;
+            }
+
+            // 0x017C: MOV A, L
+            {
+                s.A = s.L;
+            }
+
+            // 0x017D: LXI HL, 2009
+            {
+                s.setHL(0x2009);
+            }
+
+            // 0x0180: MOV B, M
+            {
+                s.B = m.get<false>(s.getHL());
+            }
+
+            // 0x0181: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0182: MOV C, M
+            {
+                s.C = m.get<false>(s.getHL());
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 41;
+            s.PC = 0x0183;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0183(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0183: CPI 0B
+            {
+                byte value = 0x0B;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0185: JM 0194
+            if (s.getS())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 17;
+                s.PC = 0x0194;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0188;
+            return;
+        }
+
+        // 49 machine cycles at most.
+        void block0x0188(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0188: SBI 0B
+            {
+                byte value = 0x0B;
+                byte carry = s.getCY();
+                s.setSubtractFlags(s.A, value, carry);
+                s.A -= value + carry;
+            }
+
+            // 0x018A: MOV E, A
+            {
+                s.E = s.A;
+            }
+
+            // 0x018B: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x018C: ADI 10
+            {
+                byte value = 0x10;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x018E: MOV B, A
+            {
+                s.B = s.A;
+            }
+
+            // 0x018F: MOV A, E
+            {
+                s.A = s.E;
+            }
+
+            // 0x0190: INR D
+            {
+                s.setIncrementFlags(s.D);
+                ++s.D;
+            }
+
+            // 0x0191: JMP 0183
+            context.executedInstructionCycles += 8;
+            context.executedMachineCycles += 49;
+            s.PC = 0x0183;
+            return;
+        }
+
+        // 5 machine cycles at most.
+        void block0x0194(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0194: MOV L, B
+            {
+                s.L = s.B;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x0195;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x0195(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0195: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0196: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 15;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 9;
+            s.PC = 0x0197;
+            return;
+        }
+
+        // 42 machine cycles at most.
+        void block0x0197(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0197: MOV E, A
+            {
+                s.E = s.A;
+            }
+
+            // 0x0198: MOV A, C
+            {
+                s.A = s.C;
+            }
+
+            // 0x0199: ADI 10
+            {
+                byte value = 0x10;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x019B: MOV C, A
+            {
+                s.C = s.A;
+            }
+
+            // 0x019C: MOV A, E
+            {
+                s.A = s.E;
+            }
+
+            // 0x019D: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x019E: JMP 0195
+            context.executedInstructionCycles += 7;
+            context.executedMachineCycles += 42;
+            s.PC = 0x0195;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x01A1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01A1: DCR D
+            {
+                s.setDecrementFlags(s.D);
+                --s.D;
+            }
+
+            // 0x01A2: JZ 01CD
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 15;
+                s.PC = 0x01CD;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 15;
+            s.PC = 0x01A5;
+            return;
+        }
+
+        // 59 machine cycles at most.
+        void block0x01A5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x01A5: LXI HL, 2006
+            {
+                s.setHL(0x2006);
+            }
+
+            // 0x01A8: MVI M, 00
+            {
+                m.set<false>(s.getHL(), 0x00);
+            }
+
+            // 0x01AA: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x01AB: MOV C, M
+            {
+                s.C = m.get<false>(s.getHL());
+            }
+
+            // 0x01AC: MVI M, 00
+            {
+                m.set<false>(s.getHL(), 0x00);
+            }
+
+            // 0x01AE: CALL 01D9
+            m.setWord<false>(s.SP - 2, 0x01B1);
+            s.SP -= 2;
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 59;
+            s.PC = 0x01D9;
+            return;
+        }
+
+        // 67 machine cycles at most.
+        void block0x01B1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x01B1: LXI HL, 2005
+            {
+                s.setHL(0x2005);
+            }
+
+            // 0x01B4: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x01B5: INR A
+            {
+                s.setIncrementFlags(s.A);
+                ++s.A;
+            }
+
+            // 0x01B6: ANI 01
+            {
+                byte value = 0x01;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x01B8: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x01B9: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x01BA: LXI HL, 2067
+            {
+                s.setHL(0x2067);
+            }
+
+            // 0x01BD: MOV H, M
+            {
+                s.H = m.get<false>(s.getHL());
+            }
+
+            // 0x01BE: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 9;
+            context.executedMachineCycles += 67;
+            s.PC = target;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x01C0(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01C0: LXI HL, 2100
+            {
+                s.setHL(0x2100);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x01C3;
+            return;
+        }
+
+        // 7 machine cycles at most.
+        void block0x01C3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01C3: MVI B, 37
+            {
+                s.B = 0x37;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 7;
+            s.PC = 0x01C5;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x01C5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x01C5: MVI M, 01
+            {
+                m.set<false>(s.getHL(), 0x01);
+            }
+
+            // 0x01C7: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x01C8: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x01C9: JNZ 01C5
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 30;
+                s.PC = 0x01C5;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 30;
+            s.PC = 0x01CC;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x01CC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x01CC: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x01CD(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x01CD: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x01CE: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x01CF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01CF: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x01D1: MVI B, E0
+            {
+                s.B = 0xE0;
+            }
+
+            // 0x01D3: LXI HL, 2402
+            {
+                s.setHL(0x2402);
+            }
+
+            // 0x01D6: JMP 14CC
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 34;
+            s.PC = 0x14CC;
+            return;
+        }
+
+        // 70 machine cycles at most.
+        void block0x01D9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x01D9: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x01DA: MOV B, M
+            {
+                s.B = m.get<false>(s.getHL());
+            }
+
+            // 0x01DB: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x01DC: MOV A, C
+            {
+                s.A = s.C;
+            }
+
+            // 0x01DD: ADD M
+            {
+                byte value = m.get<false>(s.getHL());
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x01DE: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x01DF: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x01E0: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x01E1: ADD M
+            {
+                byte value = m.get<false>(s.getHL());
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x01E2: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x01E3: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 11;
+            context.executedMachineCycles += 70;
+            s.PC = target;
+            return;
+        }
+
+        // 7 machine cycles at most.
+        void block0x01E4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01E4: MVI B, C0
+            {
+                s.B = 0xC0;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 7;
+            s.PC = 0x01E6;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x01E6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01E6: LXI DE, 1B00
+            {
+                s.setDE(0x1B00);
+            }
+
+            // 0x01E9: LXI HL, 2000
+            {
+                s.setHL(0x2000);
+            }
+
+            // 0x01EC: JMP 1A32
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x1A32;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x01EF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01EF: LXI HL, 2142
+            {
+                s.setHL(0x2142);
+            }
+
+            // 0x01F2: JMP 01F8
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x01F8;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x01F5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01F5: LXI HL, 2242
+            {
+                s.setHL(0x2242);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x01F8;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x01F8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x01F8: MVI C, 04
+            {
+                s.C = 0x04;
+            }
+
+            // 0x01FA: LXI DE, 1D20
+            {
+                s.setDE(0x1D20);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01FD;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x01FD(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x01FD: PUSH DE
+            {
+                m.setWord<false>(s.SP - 2, s.getDE());
+                s.SP -= 2;
+            }
+
+            // 0x01FE: MVI B, 2C
+            {
+                s.B = 0x2C;
+            }
+
+            // 0x0200: CALL 1A32
+            m.setWord<false>(s.SP - 2, 0x0203);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 35;
+            s.PC = 0x1A32;
+            return;
+        }
+
+        // 25 machine cycles at most.
+        void block0x0203(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0203: POP DE
+            {
+                s.setDE(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0204: DCR C
+            {
+                s.setDecrementFlags(s.C);
+                --s.C;
+            }
+
+            // 0x0205: JNZ 01FD
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 25;
+                s.PC = 0x01FD;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 25;
+            s.PC = 0x0208;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0208(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0208: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0209(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0209: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x020B: JMP 021B
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x021B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x020E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x020E: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x0210: JMP 0214
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0214;
+            return;
+        }
+
+        // 4 machine cycles at most.
+        void block0x0213(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0213: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 4;
+            s.PC = 0x0214;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0214(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0214: LXI DE, 2242
+            {
+                s.setDE(0x2242);
+            }
+
+            // 0x0217: JMP 021E
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x021E;
+            return;
+        }
+
+        // 4 machine cycles at most.
+        void block0x021A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x021A: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 4;
+            s.PC = 0x021B;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x021B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x021B: LXI DE, 2142
+            {
+                s.setDE(0x2142);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x021E;
+            return;
+        }
+
+        // 40 machine cycles at most.
+        void block0x021E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x021E: STA 2081
+            {
+                m.set<false>(0x2081, s.A);
+            }
+
+            // 0x0221: LXI BC, 1602
+            {
+                s.setBC(0x1602);
+            }
+
+            // 0x0224: LXI HL, 2806
+            {
+                s.setHL(0x2806);
+            }
+
+            // 0x0227: MVI A, 04
+            {
+                s.A = 0x04;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 40;
+            s.PC = 0x0229;
+            return;
+        }
+
+        // 49 machine cycles at most.
+        void block0x0229(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0229: PUSH PSW
+            {
+                m.set<false>(s.SP - 1, s.A);
+                m.set<false>(s.SP - 2, s.packFlags());
+                s.SP -= 2;
+            }
+
+            // 0x022A: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x022B: LDA 2081
+            {
+                s.A = m.get<false>(0x2081);
+            }
+
+            // 0x022E: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x022F: JNZ 0242
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 49;
+                s.PC = 0x0242;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 49;
+            s.PC = 0x0232;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0232(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0232: CALL 1A69
+            m.setWord<false>(s.SP - 2, 0x0235);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1A69;
+            return;
+        }
+
+        // 36 machine cycles at most.
+        void block0x0235(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0235: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0236: POP PSW
+            {
+                s.unpackFlags(m.get<false>(s.SP));
+                s.A = m.get<false>(s.SP + 1);
+                s.SP += 2;
+            }
+
+            // 0x0237: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x0238: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 36;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0239;
+            return;
+        }
+
+        // 51 machine cycles at most.
+        void block0x0239(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0239: PUSH DE
+            {
+                m.setWord<false>(s.SP - 2, s.getDE());
+                s.SP -= 2;
+            }
+
+            // 0x023A: LXI DE, 02E0
+            {
+                s.setDE(0x02E0);
+            }
+
+            // 0x023D: DAD DE
+            {
+                word value = s.getDE();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x023E: POP DE
+            {
+                s.setDE(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x023F: JMP 0229
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 51;
+            s.PC = 0x0229;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0242(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0242: CALL 147C
+            m.setWord<false>(s.SP - 2, 0x0245);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x147C;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0245(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0245: JMP 0235
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0235;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0248(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0248: LXI HL, 2010
+            {
+                s.setHL(0x2010);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x024B;
+            return;
+        }
+
+        // 25 machine cycles at most.
+        void block0x024B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x024B: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x024C: CPI FF
+            {
+                byte value = 0xFF;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x024E: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 25;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 19;
+            s.PC = 0x024F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x024F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x024F: CPI FE
+            {
+                byte value = 0xFE;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0251: JZ 0281
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 17;
+                s.PC = 0x0281;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0254;
+            return;
+        }
+
+        // 36 machine cycles at most.
+        void block0x0254(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0254: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0255: MOV B, M
+            {
+                s.B = m.get<false>(s.getHL());
+            }
+
+            // 0x0256: MOV C, A
+            {
+                s.C = s.A;
+            }
+
+            // 0x0257: ORA B
+            {
+                byte value = s.B;
+                s.A |= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0258: MOV A, C
+            {
+                s.A = s.C;
+            }
+
+            // 0x0259: JNZ 0277
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 36;
+                s.PC = 0x0277;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 36;
+            s.PC = 0x025C;
+            return;
+        }
+
+        // 26 machine cycles at most.
+        void block0x025C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x025C: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x025D: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x025E: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x025F: JNZ 0288
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 26;
+                s.PC = 0x0288;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 26;
+            s.PC = 0x0262;
+            return;
+        }
+
+        // 94 machine cycles at most.
+        void block0x0262(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0262: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0263: MOV E, M
+            {
+                s.E = m.get<false>(s.getHL());
+            }
+
+            // 0x0264: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0265: MOV D, M
+            {
+                s.D = m.get<false>(s.getHL());
+            }
+
+            // 0x0266: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x0267: XCHG
+            {
+                word value = s.getHL();
+                s.setHL(s.getDE());
+                s.setDE(value);
+            }
+
+            // 0x0268: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x0269: LXI HL, 026F
+            {
+                s.setHL(0x026F);
+            }
+
+            // 0x026C: XTHL
+            {
+                word value = m.getWord<false>(s.SP);
+                m.setWord<false>(s.SP, s.getHL());
+                s.setHL(value);
+            }
+
+            // 0x026D: PUSH DE
+            {
+                m.setWord<false>(s.SP - 2, s.getDE());
+                s.SP -= 2;
+            }
+
+            // 0x026E: PCHL
+            context.executedInstructionCycles += 11;
+            context.executedMachineCycles += 94;
+            s.PC = s.getHL();
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0277(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0277: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x0278: INR B
+            {
+                s.setIncrementFlags(s.B);
+                ++s.B;
+            }
+
+            // 0x0279: JNZ 027D
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 20;
+                s.PC = 0x027D;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 20;
+            s.PC = 0x027C;
+            return;
+        }
+
+        // 5 machine cycles at most.
+        void block0x027C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x027C: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x027D;
+            return;
+        }
+
+        // 24 machine cycles at most.
+        void block0x027D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x027D: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x027E: MOV M, B
+            {
+                m.set<false>(s.getHL(), s.B);
+            }
+
+            // 0x027F: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x0280: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 24;
+            s.PC = 0x0281;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0281(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0281: LXI DE, 0010
+            {
+                s.setDE(0x0010);
+            }
+
+            // 0x0284: DAD DE
+            {
+                word value = s.getDE();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x0285: JMP 024B
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x024B;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0288(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0288: DCR M
+            {
+                word address = s.getHL();
+                byte value = m.get<false>(address);
+                s.setDecrementFlags(value);
+                m.set<false>(address, --value);
+            }
+
+            // 0x0289: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x028A: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x028B: JMP 0281
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0281;
+            return;
+        }
+
+        // 38 machine cycles at most.
+        void block0x02ED(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x02ED: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x02F0: PUSH PSW
+            {
+                m.set<false>(s.SP - 1, s.A);
+                m.set<false>(s.SP - 2, s.packFlags());
+                s.SP -= 2;
+            }
+
+            // 0x02F1: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x02F2: JC 0332
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 38;
+                s.PC = 0x0332;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 38;
+            s.PC = 0x02F5;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x02F5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x02F5: CALL 020E
+            m.setWord<false>(s.SP - 2, 0x02F8);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x020E;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x02F8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x02F8: CALL 0878
+            m.setWord<false>(s.SP - 2, 0x02FB);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0878;
+            return;
+        }
+
+        // 57 machine cycles at most.
+        void block0x02FB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x02FB: MOV M, E
+            {
+                m.set<false>(s.getHL(), s.E);
+            }
+
+            // 0x02FC: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x02FD: MOV M, D
+            {
+                m.set<false>(s.getHL(), s.D);
+            }
+
+            // 0x02FE: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x02FF: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x0300: MOV M, B
+            {
+                m.set<false>(s.getHL(), s.B);
+            }
+
+            // 0x0301: NOP
+
+            // 0x0302: CALL 01E4
+            m.setWord<false>(s.SP - 2, 0x0305);
+            s.SP -= 2;
+            context.executedInstructionCycles += 8;
+            context.executedMachineCycles += 57;
+            s.PC = 0x01E4;
+            return;
+        }
+
+        // 38 machine cycles at most.
+        void block0x0305(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0305: POP PSW
+            {
+                s.unpackFlags(m.get<false>(s.SP));
+                s.A = m.get<false>(s.SP + 1);
+                s.SP += 2;
+            }
+
+            // 0x0306: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0307: MVI A, 21
+            {
+                s.A = 0x21;
+            }
+
+            // 0x0309: MVI B, 00
+            {
+                s.B = 0x00;
+            }
+
+            // 0x030B: JNC 0312
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 38;
+                s.PC = 0x0312;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 38;
+            s.PC = 0x030E;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x030E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x030E: MVI B, 20
+            {
+                s.B = 0x20;
+            }
+
+            // 0x0310: MVI A, 22
+            {
+                s.A = 0x22;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x0312;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0312(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0312: STA 2067
+            {
+                m.set<false>(0x2067, s.A);
+            }
+
+            // 0x0315: CALL 0AB6
+            m.setWord<false>(s.SP - 2, 0x0318);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0AB6;
+            return;
+        }
+
+        // 67 machine cycles at most.
+        void block0x0318(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x0318: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0319: STA 2011
+            {
+                m.set<false>(0x2011, s.A);
+            }
+
+            // 0x031C: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x031D: OUT 05
+            {
+                context.executedMachineCycles += 22;
+                io.set(0x05, s.A);
+            }
+
+            // 0x031F: INR A
+            {
+                s.setIncrementFlags(s.A);
+                ++s.A;
+            }
+
+            // 0x0320: STA 2098
+            {
+                m.set<false>(0x2098, s.A);
+            }
+
+            // 0x0323: CALL 09D6
+            m.setWord<false>(s.SP - 2, 0x0326);
+            s.SP -= 2;
+            context.executedInstructionCycles += 7;
+            context.executedMachineCycles += 45;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0326(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0326: CALL 1A7F
+            m.setWord<false>(s.SP - 2, 0x0329);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1A7F;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0329(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0329: JMP 07F9
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x07F9;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0332(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0332: CALL 0209
+            m.setWord<false>(s.SP - 2, 0x0335);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0209;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0335(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0335: JMP 02F8
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x02F8;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0707(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0707: MVI B, FE
+            {
+                s.B = 0xFE;
+            }
+
+            // 0x0709: JMP 19DC
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x19DC;
+            return;
+        }
+
+        // 51 machine cycles at most.
+        void block0x0765(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0765: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x0767: STA 2093
+            {
+                m.set<false>(0x2093, s.A);
+            }
+
+            // 0x076A: LXI SP, 2400
+            {
+                s.SP = 0x2400;
+            }
+
+            // 0x076D: EI
+            {
+                s.interruptsEnabled = true;
+            }
+
+            // 0x076E: CALL 1979
+            m.setWord<false>(s.SP - 2, 0x0771);
+            s.SP -= 2;
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 51;
+            s.PC = 0x1979;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0771(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0771: CALL 09D6
+            m.setWord<false>(s.SP - 2, 0x0774);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x0774(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0774: LXI HL, 3013
+            {
+                s.setHL(0x3013);
+            }
+
+            // 0x0777: LXI DE, 1FF3
+            {
+                s.setDE(0x1FF3);
+            }
+
+            // 0x077A: MVI C, 04
+            {
+                s.C = 0x04;
+            }
+
+            // 0x077C: CALL 08F3
+            m.setWord<false>(s.SP - 2, 0x077F);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 44;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 45 machine cycles at most.
+        void block0x077F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x077F: LDA 20EB
+            {
+                s.A = m.get<false>(0x20EB);
+            }
+
+            // 0x0782: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x0783: LXI HL, 2810
+            {
+                s.setHL(0x2810);
+            }
+
+            // 0x0786: MVI C, 14
+            {
+                s.C = 0x14;
+            }
+
+            // 0x0788: JNZ 0857
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 45;
+                s.PC = 0x0857;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 45;
+            s.PC = 0x078B;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x078B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x078B: LXI DE, 1ACF
+            {
+                s.setDE(0x1ACF);
+            }
+
+            // 0x078E: CALL 08F3
+            m.setWord<false>(s.SP - 2, 0x0791);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0791(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x0791: IN 01
+            {
+                s.A = io.get(0x01);
+            }
+
+            // 0x0793: ANI 04
+            {
+                byte value = 0x04;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0795: JZ 077F
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x077F;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0798;
+            return;
+        }
+
+        // 11 machine cycles at most.
+        void block0x0798(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0798: MVI B, 99
+            {
+                s.B = 0x99;
+            }
+
+            // 0x079A: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 11;
+            s.PC = 0x079B;
+            return;
+        }
+
+        // 64 machine cycles at most.
+        void block0x079B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x079B: STA 20CE
+            {
+                m.set<false>(0x20CE, s.A);
+            }
+
+            // 0x079E: LDA 20EB
+            {
+                s.A = m.get<false>(0x20EB);
+            }
+
+            // 0x07A1: ADD B
+            {
+                byte value = s.B;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x07A2: DAA
+            {
+                const alu::DecimalAdjustment& adjustment = alu::decimalAdjustments[alu::decimalAdjustIndex(s.A, s.getCY(), s.getCA())];
+                s.A = adjustment.result;
+                s.unpackFlags(adjustment.flags);
+            }
+
+            // 0x07A3: STA 20EB
+            {
+                m.set<false>(0x20EB, s.A);
+            }
+
+            // 0x07A6: CALL 1947
+            m.setWord<false>(s.SP - 2, 0x07A9);
+            s.SP -= 2;
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 64;
+            s.PC = 0x1947;
+            return;
+        }
+
+        // 59 machine cycles at most.
+        void block0x07A9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07A9: LXI HL, 0000
+            {
+                s.setHL(0x0000);
+            }
+
+            // 0x07AC: SHLD 20F8
+            {
+                m.setWord<false>(0x20F8, s.getHL());
+            }
+
+            // 0x07AF: SHLD 20FC
+            {
+                m.setWord<false>(0x20FC, s.getHL());
+            }
+
+            // 0x07B2: CALL 1925
+            m.setWord<false>(s.SP - 2, 0x07B5);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 59;
+            s.PC = 0x1925;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07B5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07B5: CALL 192B
+            m.setWord<false>(s.SP - 2, 0x07B8);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x192B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07B8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07B8: CALL 19D7
+            m.setWord<false>(s.SP - 2, 0x07BB);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x19D7;
+            return;
+        }
+
+        // 77 machine cycles at most.
+        void block0x07BB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07BB: LXI HL, 0101
+            {
+                s.setHL(0x0101);
+            }
+
+            // 0x07BE: MOV A, H
+            {
+                s.A = s.H;
+            }
+
+            // 0x07BF: STA 20EF
+            {
+                m.set<false>(0x20EF, s.A);
+            }
+
+            // 0x07C2: SHLD 20E7
+            {
+                m.setWord<false>(0x20E7, s.getHL());
+            }
+
+            // 0x07C5: SHLD 20E5
+            {
+                m.setWord<false>(0x20E5, s.getHL());
+            }
+
+            // 0x07C8: CALL 1956
+            m.setWord<false>(s.SP - 2, 0x07CB);
+            s.SP -= 2;
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 77;
+            s.PC = 0x1956;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07CB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07CB: CALL 01EF
+            m.setWord<false>(s.SP - 2, 0x07CE);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01EF;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07CE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07CE: CALL 01F5
+            m.setWord<false>(s.SP - 2, 0x07D1);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01F5;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07D1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07D1: CALL 08D1
+            m.setWord<false>(s.SP - 2, 0x07D4);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x08D1;
+            return;
+        }
+
+        // 43 machine cycles at most.
+        void block0x07D4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07D4: STA 21FF
+            {
+                m.set<false>(0x21FF, s.A);
+            }
+
+            // 0x07D7: STA 22FF
+            {
+                m.set<false>(0x22FF, s.A);
+            }
+
+            // 0x07DA: CALL 00D7
+            m.setWord<false>(s.SP - 2, 0x07DD);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 43;
+            s.PC = 0x00D7;
+            return;
+        }
+
+        // 47 machine cycles at most.
+        void block0x07DD(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07DD: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x07DE: STA 21FE
+            {
+                m.set<false>(0x21FE, s.A);
+            }
+
+            // 0x07E1: STA 22FE
+            {
+                m.set<false>(0x22FE, s.A);
+            }
+
+            // 0x07E4: CALL 01C0
+            m.setWord<false>(s.SP - 2, 0x07E7);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 47;
+            s.PC = 0x01C0;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07E7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07E7: CALL 1904
+            m.setWord<false>(s.SP - 2, 0x07EA);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1904;
+            return;
+        }
+
+        // 59 machine cycles at most.
+        void block0x07EA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07EA: LXI HL, 3878
+            {
+                s.setHL(0x3878);
+            }
+
+            // 0x07ED: SHLD 21FC
+            {
+                m.setWord<false>(0x21FC, s.getHL());
+            }
+
+            // 0x07F0: SHLD 22FC
+            {
+                m.setWord<false>(0x22FC, s.getHL());
+            }
+
+            // 0x07F3: CALL 01E4
+            m.setWord<false>(s.SP - 2, 0x07F6);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 59;
+            s.PC = 0x01E4;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07F6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07F6: CALL 1A7F
+            m.setWord<false>(s.SP - 2, 0x07F9);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1A7F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07F9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07F9: CALL 088D
+            m.setWord<false>(s.SP - 2, 0x07FC);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x088D;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x07FC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07FC: CALL 09D6
+            m.setWord<false>(s.SP - 2, 0x07FF);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 21 machine cycles at most.
+        void block0x07FF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x07FF: NOP
+
+            // 0x0800: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0801: STA 20C1
+            {
+                m.set<false>(0x20C1, s.A);
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 21;
+            s.PC = 0x0804;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0804(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0804: CALL 01CF
+            m.setWord<false>(s.SP - 2, 0x0807);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01CF;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0807(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0807: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x080A: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x080B: JC 0872
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0872;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x080E;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x080E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x080E: CALL 0213
+            m.setWord<false>(s.SP - 2, 0x0811);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0213;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0811(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0811: CALL 01CF
+            m.setWord<false>(s.SP - 2, 0x0814);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01CF;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0814(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0814: CALL 00B1
+            m.setWord<false>(s.SP - 2, 0x0817);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x00B1;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0817(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0817: CALL 19D1
+            m.setWord<false>(s.SP - 2, 0x081A);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x19D1;
+            return;
+        }
+
+        // 24 machine cycles at most.
+        void block0x081A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x081A: MVI B, 20
+            {
+                s.B = 0x20;
+            }
+
+            // 0x081C: CALL 18FA
+            m.setWord<false>(s.SP - 2, 0x081F);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 24;
+            s.PC = 0x18FA;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x081F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x081F: CALL 1618
+            m.setWord<false>(s.SP - 2, 0x0822);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1618;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0822(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0822: CALL 190A
+            m.setWord<false>(s.SP - 2, 0x0825);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x190A;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0825(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0825: CALL 15F3
+            m.setWord<false>(s.SP - 2, 0x0828);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x15F3;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0828(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0828: CALL 0988
+            m.setWord<false>(s.SP - 2, 0x082B);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0988;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x082B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x082B: LDA 2082
+            {
+                s.A = m.get<false>(0x2082);
+            }
+
+            // 0x082E: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x082F: JZ 09EF
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x09EF;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0832;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0832(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0832: CALL 170E
+            m.setWord<false>(s.SP - 2, 0x0835);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x170E;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0835(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0835: CALL 0935
+            m.setWord<false>(s.SP - 2, 0x0838);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0935;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0838(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0838: CALL 08D8
+            m.setWord<false>(s.SP - 2, 0x083B);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x08D8;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x083B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x083B: CALL 172C
+            m.setWord<false>(s.SP - 2, 0x083E);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x172C;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x083E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x083E: CALL 0A59
+            m.setWord<false>(s.SP - 2, 0x0841);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A59;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0841(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0841: JZ 0849
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x0849;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0844;
+            return;
+        }
+
+        // 24 machine cycles at most.
+        void block0x0844(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0844: MVI B, 04
+            {
+                s.B = 0x04;
+            }
+
+            // 0x0846: CALL 18FA
+            m.setWord<false>(s.SP - 2, 0x0849);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 24;
+            s.PC = 0x18FA;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0849(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0849: CALL 1775
+            m.setWord<false>(s.SP - 2, 0x084C);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1775;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x084C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x084C: OUT 06
+            {
+                io.set(0x06, s.A);
+            }
+
+            // 0x084E: CALL 1804
+            m.setWord<false>(s.SP - 2, 0x0851);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x1804;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0851(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0851: JMP 081F
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x081F;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0857(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0857: LXI DE, 1ABA
+            {
+                s.setDE(0x1ABA);
+            }
+
+            // 0x085A: CALL 08F3
+            m.setWord<false>(s.SP - 2, 0x085D);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x085D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x085D: MVI B, 98
+            {
+                s.B = 0x98;
+            }
+
+            // 0x085F: IN 01
+            {
+                context.executedMachineCycles += 7;
+                s.A = io.get(0x01);
+            }
+
+            // 0x0861: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0862: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0863: JC 086D
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 28;
+                s.PC = 0x086D;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 28;
+            s.PC = 0x0866;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x0866(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0866: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0867: JC 0798
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 14;
+                s.PC = 0x0798;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x086A;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x086A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x086A: JMP 077F
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x077F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x086D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x086D: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x086F: JMP 079B
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x079B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0872(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0872: CALL 021A
+            m.setWord<false>(s.SP - 2, 0x0875);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x021A;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0875(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0875: JMP 0814
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0814;
+            return;
+        }
+
+        // 48 machine cycles at most.
+        void block0x0878(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0878: LDA 2008
+            {
+                s.A = m.get<false>(0x2008);
+            }
+
+            // 0x087B: MOV B, A
+            {
+                s.B = s.A;
+            }
+
+            // 0x087C: LHLD 2009
+            {
+                s.setHL(m.getWord<false>(0x2009));
+            }
+
+            // 0x087F: XCHG
+            {
+                word value = s.getHL();
+                s.setHL(s.getDE());
+                s.setDE(value);
+            }
+
+            // 0x0880: JMP 0886
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 48;
+            s.PC = 0x0886;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x0886(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0886: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x0889: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x088A: MVI L, FC
+            {
+                s.L = 0xFC;
+            }
+
+            // 0x088C: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 35;
+            s.PC = target;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x088D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x088D: LXI HL, 2B11
+            {
+                s.setHL(0x2B11);
+            }
+
+            // 0x0890: LXI DE, 1B70
+            {
+                s.setDE(0x1B70);
+            }
+
+            // 0x0893: MVI C, 0E
+            {
+                s.C = 0x0E;
+            }
+
+            // 0x0895: CALL 08F3
+            m.setWord<false>(s.SP - 2, 0x0898);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 44;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 51 machine cycles at most.
+        void block0x0898(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0898: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x089B: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x089C: MVI A, 1C
+            {
+                s.A = 0x1C;
+            }
+
+            // 0x089E: LXI HL, 3711
+            {
+                s.setHL(0x3711);
+            }
+
+            // 0x08A1: CNC 08FF
+            if (!s.getCY())
+            {
+                m.setWord<false>(s.SP - 2, 0x08A4);
+                s.SP -= 2;
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 51;
+                s.PC = 0x08FF;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 45;
+            s.PC = 0x08A4;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x08A4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08A4: MVI A, B0
+            {
+                s.A = 0xB0;
+            }
+
+            // 0x08A6: STA 20C0
+            {
+                m.set<false>(0x20C0, s.A);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x08A9;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x08A9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08A9: LDA 20C0
+            {
+                s.A = m.get<false>(0x20C0);
+            }
+
+            // 0x08AC: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x08AD: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x08AE;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x08AE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x08AE: ANI 04
+            {
+                byte value = 0x04;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x08B0: JNZ 08BC
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 17;
+                s.PC = 0x08BC;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x08B3;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x08B3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08B3: CALL 09CA
+            m.setWord<false>(s.SP - 2, 0x08B6);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09CA;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x08B6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08B6: CALL 1931
+            m.setWord<false>(s.SP - 2, 0x08B9);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1931;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x08B9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x08B9: JMP 08A9
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x08A9;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x08BC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08BC: MVI B, 20
+            {
+                s.B = 0x20;
+            }
+
+            // 0x08BE: LXI HL, 271C
+            {
+                s.setHL(0x271C);
+            }
+
+            // 0x08C1: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x08C4: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x08C5: JC 08CB
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 44;
+                s.PC = 0x08CB;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 44;
+            s.PC = 0x08C8;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x08C8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x08C8: LXI HL, 391C
+            {
+                s.setHL(0x391C);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x08CB;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x08CB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08CB: CALL 14CB
+            m.setWord<false>(s.SP - 2, 0x08CE);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x14CB;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x08CE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x08CE: JMP 08A9
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x08A9;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x08D1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x08D1: IN 02
+            {
+                s.A = io.get(0x02);
+            }
+
+            // 0x08D3: ANI 03
+            {
+                byte value = 0x03;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x08D5: ADI 03
+            {
+                byte value = 0x03;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x08D7: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 34;
+            s.PC = target;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x08D8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08D8: LDA 2082
+            {
+                s.A = m.get<false>(0x2082);
+            }
+
+            // 0x08DB: CPI 09
+            {
+                byte value = 0x09;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x08DD: RNC
+            if (!s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 31;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 25;
+            s.PC = 0x08DE;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x08DE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08DE: MVI A, FB
+            {
+                s.A = 0xFB;
+            }
+
+            // 0x08E0: STA 207E
+            {
+                m.set<false>(0x207E, s.A);
+            }
+
+            // 0x08E3: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = target;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x08E4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08E4: LDA 20CE
+            {
+                s.A = m.get<false>(0x20CE);
+            }
+
+            // 0x08E7: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x08E8: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x08E9;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x08E9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x08E9: LXI HL, 391C
+            {
+                s.setHL(0x391C);
+            }
+
+            // 0x08EC: MVI B, 20
+            {
+                s.B = 0x20;
+            }
+
+            // 0x08EE: JMP 14CB
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x14CB;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x08F3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08F3: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x08F4: PUSH DE
+            {
+                m.setWord<false>(s.SP - 2, s.getDE());
+                s.SP -= 2;
+            }
+
+            // 0x08F5: CALL 08FF
+            m.setWord<false>(s.SP - 2, 0x08F8);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 35;
+            s.PC = 0x08FF;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x08F8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08F8: POP DE
+            {
+                s.setDE(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x08F9: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x08FA: DCR C
+            {
+                s.setDecrementFlags(s.C);
+                --s.C;
+            }
+
+            // 0x08FB: JNZ 08F3
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 30;
+                s.PC = 0x08F3;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 30;
+            s.PC = 0x08FE;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x08FE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x08FE: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 114 machine cycles at most.
+        void block0x08FF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x08FF: LXI DE, 1E00
+            {
+                s.setDE(0x1E00);
+            }
+
+            // 0x0902: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x0903: MVI H, 00
+            {
+                s.H = 0x00;
+            }
+
+            // 0x0905: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x0906: DAD HL
+            {
+                word value = s.getHL();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x0907: DAD HL
+            {
+                word value = s.getHL();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x0908: DAD HL
+            {
+                word value = s.getHL();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x0909: DAD DE
+            {
+                word value = s.getDE();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x090A: XCHG
+            {
+                word value = s.getHL();
+                s.setHL(s.getDE());
+                s.setDE(value);
+            }
+
+            // 0x090B: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x090C: MVI B, 08
+            {
+                s.B = 0x08;
+            }
+
+            // 0x090E: OUT 06
+            {
+                context.executedMachineCycles += 94;
+                io.set(0x06, s.A);
+            }
+
+            // 0x0910: JMP 1439
+            context.executedInstructionCycles += 13;
+            context.executedMachineCycles += 20;
+            s.PC = 0x1439;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x0913(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0913: LDA 2009
+            {
+                s.A = m.get<false>(0x2009);
+            }
+
+            // 0x0916: CPI 78
+            {
+                byte value = 0x78;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0918: RNC
+            if (!s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 31;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 25;
+            s.PC = 0x0919;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x0919(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0919: LHLD 2091
+            {
+                s.setHL(m.getWord<false>(0x2091));
+            }
+
+            // 0x091C: MOV A, L
+            {
+                s.A = s.L;
+            }
+
+            // 0x091D: ORA H
+            {
+                byte value = s.H;
+                s.A |= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x091E: JNZ 0929
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 35;
+                s.PC = 0x0929;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 35;
+            s.PC = 0x0921;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0921(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0921: LXI HL, 0600
+            {
+                s.setHL(0x0600);
+            }
+
+            // 0x0924: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x0926: STA 2083
+            {
+                m.set<false>(0x2083, s.A);
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0929;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x0929(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0929: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x092A: SHLD 2091
+            {
+                m.setWord<false>(0x2091, s.getHL());
+            }
+
+            // 0x092D: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 31;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x092E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x092E: CALL 1611
+            m.setWord<false>(s.SP - 2, 0x0931);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1611;
+            return;
+        }
+
+        // 24 machine cycles at most.
+        void block0x0931(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0931: MVI L, FF
+            {
+                s.L = 0xFF;
+            }
+
+            // 0x0933: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x0934: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 24;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0935(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0935: CALL 1910
+            m.setWord<false>(s.SP - 2, 0x0938);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1910;
+            return;
+        }
+
+        // 32 machine cycles at most.
+        void block0x0938(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0938: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x0939: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x093A: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x093B: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x093C: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 32;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 26;
+            s.PC = 0x093D;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x093D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x093D: MVI B, 15
+            {
+                s.B = 0x15;
+            }
+
+            // 0x093F: IN 02
+            {
+                context.executedMachineCycles += 7;
+                s.A = io.get(0x02);
+            }
+
+            // 0x0941: ANI 08
+            {
+                byte value = 0x08;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0943: JZ 0948
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0948;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0946;
+            return;
+        }
+
+        // 7 machine cycles at most.
+        void block0x0946(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0946: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 7;
+            s.PC = 0x0948;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0948(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0948: CALL 09CA
+            m.setWord<false>(s.SP - 2, 0x094B);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09CA;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x094B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x094B: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x094C: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x094D: CMP B
+            {
+                byte value = s.B;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x094E: RC
+            if (s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 27;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 21;
+            s.PC = 0x094F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x094F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x094F: CALL 092E
+            m.setWord<false>(s.SP - 2, 0x0952);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x092E;
+            return;
+        }
+
+        // 38 machine cycles at most.
+        void block0x0952(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0952: INR M
+            {
+                word address = s.getHL();
+                byte value = m.get<false>(address);
+                s.setIncrementFlags(value);
+                m.set<false>(address, ++value);
+            }
+
+            // 0x0953: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x0954: PUSH PSW
+            {
+                m.set<false>(s.SP - 1, s.A);
+                m.set<false>(s.SP - 2, s.packFlags());
+                s.SP -= 2;
+            }
+
+            // 0x0955: LXI HL, 2501
+            {
+                s.setHL(0x2501);
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 38;
+            s.PC = 0x0958;
+            return;
+        }
+
+        // 25 machine cycles at most.
+        void block0x0958(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0958: INR H
+            {
+                s.setIncrementFlags(s.H);
+                ++s.H;
+            }
+
+            // 0x0959: INR H
+            {
+                s.setIncrementFlags(s.H);
+                ++s.H;
+            }
+
+            // 0x095A: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x095B: JNZ 0958
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 25;
+                s.PC = 0x0958;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 25;
+            s.PC = 0x095E;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x095E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x095E: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            // 0x0960: LXI DE, 1C60
+            {
+                s.setDE(0x1C60);
+            }
+
+            // 0x0963: CALL 1439
+            m.setWord<false>(s.SP - 2, 0x0966);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 34;
+            s.PC = 0x1439;
+            return;
+        }
+
+        // 32 machine cycles at most.
+        void block0x0966(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0966: POP PSW
+            {
+                s.unpackFlags(m.get<false>(s.SP));
+                s.A = m.get<false>(s.SP + 1);
+                s.SP += 2;
+            }
+
+            // 0x0967: INR A
+            {
+                s.setIncrementFlags(s.A);
+                ++s.A;
+            }
+
+            // 0x0968: CALL 1A8B
+            m.setWord<false>(s.SP - 2, 0x096B);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 32;
+            s.PC = 0x1A8B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x096B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x096B: CALL 1910
+            m.setWord<false>(s.SP - 2, 0x096E);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1910;
+            return;
+        }
+
+        // 57 machine cycles at most.
+        void block0x096E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x096E: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x096F: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x0970: MVI M, 00
+            {
+                m.set<false>(s.getHL(), 0x00);
+            }
+
+            // 0x0972: MVI A, FF
+            {
+                s.A = 0xFF;
+            }
+
+            // 0x0974: STA 2099
+            {
+                m.set<false>(0x2099, s.A);
+            }
+
+            // 0x0977: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            // 0x0979: JMP 18FA
+            context.executedInstructionCycles += 7;
+            context.executedMachineCycles += 57;
+            s.PC = 0x18FA;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x097C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x097C: LXI HL, 1DA0
+            {
+                s.setHL(0x1DA0);
+            }
+
+            // 0x097F: CPI 02
+            {
+                byte value = 0x02;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0981: RC
+            if (s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x0982;
+            return;
+        }
+
+        // 23 machine cycles at most.
+        void block0x0982(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0982: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0983: CPI 04
+            {
+                byte value = 0x04;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0985: RC
+            if (s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 23;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0986;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x0986(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0986: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0987: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 15;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0988(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0988: CALL 09CA
+            m.setWord<false>(s.SP - 2, 0x098B);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09CA;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x098B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x098B: LDA 20F1
+            {
+                s.A = m.get<false>(0x20F1);
+            }
+
+            // 0x098E: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x098F: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x0990;
+            return;
+        }
+
+        // 156 machine cycles at most.
+        void block0x0990(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0990: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0991: STA 20F1
+            {
+                m.set<false>(0x20F1, s.A);
+            }
+
+            // 0x0994: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x0995: LHLD 20F2
+            {
+                s.setHL(m.getWord<false>(0x20F2));
+            }
+
+            // 0x0998: XCHG
+            {
+                word value = s.getHL();
+                s.setHL(s.getDE());
+                s.setDE(value);
+            }
+
+            // 0x0999: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x099A: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x099B: ADD E
+            {
+                byte value = s.E;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x099C: DAA
+            {
+                const alu::DecimalAdjustment& adjustment = alu::decimalAdjustments[alu::decimalAdjustIndex(s.A, s.getCY(), s.getCA())];
+                s.A = adjustment.result;
+                s.unpackFlags(adjustment.flags);
+            }
+
+            // 0x099D: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x099E: MOV E, A
+            {
+                s.E = s.A;
+            }
+
+            // 0x099F: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x09A0: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x09A1: ADC D
+            {
+                byte value = s.D;
+                byte carry = s.getCY();
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x09A2: DAA
+            {
+                const alu::DecimalAdjustment& adjustment = alu::decimalAdjustments[alu::decimalAdjustIndex(s.A, s.getCY(), s.getCA())];
+                s.A = adjustment.result;
+                s.unpackFlags(adjustment.flags);
+            }
+
+            // 0x09A3: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x09A4: MOV D, A
+            {
+                s.D = s.A;
+            }
+
+            // 0x09A5: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x09A6: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x09A7: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x09A8: MOV H, M
+            {
+                s.H = m.get<false>(s.getHL());
+            }
+
+            // 0x09A9: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x09AA: JMP 09AD
+            context.executedInstructionCycles += 23;
+            context.executedMachineCycles += 156;
+            s.PC = 0x09AD;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x09AD(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09AD: MOV A, D
+            {
+                s.A = s.D;
+            }
+
+            // 0x09AE: CALL 09B2
+            m.setWord<false>(s.SP - 2, 0x09B1);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 22;
+            s.PC = 0x09B2;
+            return;
+        }
+
+        // 5 machine cycles at most.
+        void block0x09B1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x09B1: MOV A, E
+            {
+                s.A = s.E;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x09B2;
+            return;
+        }
+
+        // 62 machine cycles at most.
+        void block0x09B2(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09B2: PUSH DE
+            {
+                m.setWord<false>(s.SP - 2, s.getDE());
+                s.SP -= 2;
+            }
+
+            // 0x09B3: PUSH PSW
+            {
+                m.set<false>(s.SP - 1, s.A);
+                m.set<false>(s.SP - 2, s.packFlags());
+                s.SP -= 2;
+            }
+
+            // 0x09B4: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x09B5: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x09B6: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x09B7: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x09B8: ANI 0F
+            {
+                byte value = 0x0F;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x09BA: CALL 09C5
+            m.setWord<false>(s.SP - 2, 0x09BD);
+            s.SP -= 2;
+            context.executedInstructionCycles += 8;
+            context.executedMachineCycles += 62;
+            s.PC = 0x09C5;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x09BD(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09BD: POP PSW
+            {
+                s.unpackFlags(m.get<false>(s.SP));
+                s.A = m.get<false>(s.SP + 1);
+                s.SP += 2;
+            }
+
+            // 0x09BE: ANI 0F
+            {
+                byte value = 0x0F;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x09C0: CALL 09C5
+            m.setWord<false>(s.SP - 2, 0x09C3);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 34;
+            s.PC = 0x09C5;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x09C3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09C3: POP DE
+            {
+                s.setDE(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x09C4: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x09C5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x09C5: ADI 1A
+            {
+                byte value = 0x1A;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x09C7: JMP 08FF
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x08FF;
+            return;
+        }
+
+        // 38 machine cycles at most.
+        void block0x09CA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09CA: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x09CD: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x09CE: LXI HL, 20F8
+            {
+                s.setHL(0x20F8);
+            }
+
+            // 0x09D1: RC
+            if (s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 38;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 32;
+            s.PC = 0x09D2;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x09D2(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09D2: LXI HL, 20FC
+            {
+                s.setHL(0x20FC);
+            }
+
+            // 0x09D5: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x09D6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x09D6: LXI HL, 2402
+            {
+                s.setHL(0x2402);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x09D9;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x09D9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09D9: MVI M, 00
+            {
+                m.set<false>(s.getHL(), 0x00);
+            }
+
+            // 0x09DB: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x09DC: MOV A, L
+            {
+                s.A = s.L;
+            }
+
+            // 0x09DD: ANI 1F
+            {
+                byte value = 0x1F;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x09DF: CPI 1C
+            {
+                byte value = 0x1C;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x09E1: JC 09E8
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 44;
+                s.PC = 0x09E8;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 44;
+            s.PC = 0x09E4;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x09E4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x09E4: LXI DE, 0006
+            {
+                s.setDE(0x0006);
+            }
+
+            // 0x09E7: DAD DE
+            {
+                word value = s.getDE();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x09E8;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x09E8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x09E8: MOV A, H
+            {
+                s.A = s.H;
+            }
+
+            // 0x09E9: CPI 40
+            {
+                byte value = 0x40;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x09EB: JC 09D9
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 22;
+                s.PC = 0x09D9;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x09EE;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x09EE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09EE: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x09EF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09EF: CALL 0A3C
+            m.setWord<false>(s.SP - 2, 0x09F2);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A3C;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x09F2(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09F2: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x09F3: STA 20E9
+            {
+                m.set<false>(0x20E9, s.A);
+            }
+
+            // 0x09F6: CALL 09D6
+            m.setWord<false>(s.SP - 2, 0x09F9);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 34;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 41 machine cycles at most.
+        void block0x09F9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x09F9: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x09FC: PUSH PSW
+            {
+                m.set<false>(s.SP - 1, s.A);
+                m.set<false>(s.SP - 2, s.packFlags());
+                s.SP -= 2;
+            }
+
+            // 0x09FD: CALL 01E4
+            m.setWord<false>(s.SP - 2, 0x0A00);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 41;
+            s.PC = 0x01E4;
+            return;
+        }
+
+        // 95 machine cycles at most.
+        void block0x0A00(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A00: POP PSW
+            {
+                s.unpackFlags(m.get<false>(s.SP));
+                s.A = m.get<false>(s.SP + 1);
+                s.SP += 2;
+            }
+
+            // 0x0A01: STA 2067
+            {
+                m.set<false>(0x2067, s.A);
+            }
+
+            // 0x0A04: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x0A07: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x0A08: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x0A09: MVI L, FE
+            {
+                s.L = 0xFE;
+            }
+
+            // 0x0A0B: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x0A0C: ANI 07
+            {
+                byte value = 0x07;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0A0E: INR A
+            {
+                s.setIncrementFlags(s.A);
+                ++s.A;
+            }
+
+            // 0x0A0F: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x0A10: LXI HL, 1DA2
+            {
+                s.setHL(0x1DA2);
+            }
+
+            context.executedInstructionCycles += 11;
+            context.executedMachineCycles += 95;
+            s.PC = 0x0A13;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0A13(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0A13: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0A14: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x0A15: JNZ 0A13
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 20;
+                s.PC = 0x0A13;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 20;
+            s.PC = 0x0A18;
+            return;
+        }
+
+        // 65 machine cycles at most.
+        void block0x0A18(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A18: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x0A19: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0A1A: MVI L, FC
+            {
+                s.L = 0xFC;
+            }
+
+            // 0x0A1C: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x0A1D: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x0A1E: MVI M, 38
+            {
+                m.set<false>(s.getHL(), 0x38);
+            }
+
+            // 0x0A20: MOV A, H
+            {
+                s.A = s.H;
+            }
+
+            // 0x0A21: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0A22: JC 0A33
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 9;
+                context.executedMachineCycles += 65;
+                s.PC = 0x0A33;
+                return;
+            }
+
+            context.executedInstructionCycles += 9;
+            context.executedMachineCycles += 65;
+            s.PC = 0x0A25;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x0A25(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A25: MVI A, 21
+            {
+                s.A = 0x21;
+            }
+
+            // 0x0A27: STA 2098
+            {
+                m.set<false>(0x2098, s.A);
+            }
+
+            // 0x0A2A: CALL 01F5
+            m.setWord<false>(s.SP - 2, 0x0A2D);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 37;
+            s.PC = 0x01F5;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0A2D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A2D: CALL 1904
+            m.setWord<false>(s.SP - 2, 0x0A30);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1904;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0A30(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0A30: JMP 0804
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0804;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0A33(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A33: CALL 01EF
+            m.setWord<false>(s.SP - 2, 0x0A36);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01EF;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0A36(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A36: CALL 01C0
+            m.setWord<false>(s.SP - 2, 0x0A39);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01C0;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0A39(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0A39: JMP 0804
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0804;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0A3C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A3C: CALL 0A59
+            m.setWord<false>(s.SP - 2, 0x0A3F);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A59;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0A3F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0A3F: JNZ 0A52
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x0A52;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0A42;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0A42(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A42: MVI A, 30
+            {
+                s.A = 0x30;
+            }
+
+            // 0x0A44: STA 20C0
+            {
+                m.set<false>(0x20C0, s.A);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x0A47;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x0A47(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A47: LDA 20C0
+            {
+                s.A = m.get<false>(0x20C0);
+            }
+
+            // 0x0A4A: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0A4B: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x0A4C;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0A4C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A4C: CALL 0A59
+            m.setWord<false>(s.SP - 2, 0x0A4F);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A59;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0A4F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0A4F: JZ 0A47
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x0A47;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0A52;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0A52(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A52: CALL 0A59
+            m.setWord<false>(s.SP - 2, 0x0A55);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A59;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0A55(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0A55: JNZ 0A52
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x0A52;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0A58;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0A58(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A58: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0A59(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A59: LDA 2015
+            {
+                s.A = m.get<false>(0x2015);
+            }
+
+            // 0x0A5C: CPI FF
+            {
+                byte value = 0xFF;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0A5E: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = target;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0A5F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A5F: LDA 20EF
+            {
+                s.A = m.get<false>(0x20EF);
+            }
+
+            // 0x0A62: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0A63: JZ 0A7C
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0A7C;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0A66;
+            return;
+        }
+
+        // 29 machine cycles at most.
+        void block0x0A66(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A66: MOV C, B
+            {
+                s.C = s.B;
+            }
+
+            // 0x0A67: MVI B, 08
+            {
+                s.B = 0x08;
+            }
+
+            // 0x0A69: CALL 18FA
+            m.setWord<false>(s.SP - 2, 0x0A6C);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 29;
+            s.PC = 0x18FA;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0A6C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A6C: MOV B, C
+            {
+                s.B = s.C;
+            }
+
+            // 0x0A6D: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x0A6E: CALL 097C
+            m.setWord<false>(s.SP - 2, 0x0A71);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x097C;
+            return;
+        }
+
+        // 54 machine cycles at most.
+        void block0x0A71(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A71: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x0A72: LXI HL, 20F3
+            {
+                s.setHL(0x20F3);
+            }
+
+            // 0x0A75: MVI M, 00
+            {
+                m.set<false>(s.getHL(), 0x00);
+            }
+
+            // 0x0A77: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x0A78: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x0A79: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x0A7A: MVI M, 01
+            {
+                m.set<false>(s.getHL(), 0x01);
+            }
+
+            context.executedInstructionCycles += 7;
+            context.executedMachineCycles += 54;
+            s.PC = 0x0A7C;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0A7C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A7C: LXI HL, 2062
+            {
+                s.setHL(0x2062);
+            }
+
+            // 0x0A7F: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0A80(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A80: MVI A, 02
+            {
+                s.A = 0x02;
+            }
+
+            // 0x0A82: STA 20C1
+            {
+                m.set<false>(0x20C1, s.A);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x0A85;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x0A85(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x0A85: OUT 06
+            {
+                io.set(0x06, s.A);
+            }
+
+            // 0x0A87: LDA 20CB
+            {
+                s.A = m.get<false>(0x20CB);
+            }
+
+            // 0x0A8A: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0A8B: JZ 0A85
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 37;
+                s.PC = 0x0A85;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 37;
+            s.PC = 0x0A8E;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0A8E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A8E: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0A8F: STA 20C1
+            {
+                m.set<false>(0x20C1, s.A);
+            }
+
+            // 0x0A92: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = target;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x0A93(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A93: PUSH DE
+            {
+                m.setWord<false>(s.SP - 2, s.getDE());
+                s.SP -= 2;
+            }
+
+            // 0x0A94: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x0A95: CALL 08FF
+            m.setWord<false>(s.SP - 2, 0x0A98);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 35;
+            s.PC = 0x08FF;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0A98(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A98: POP DE
+            {
+                s.setDE(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0A99: MVI A, 07
+            {
+                s.A = 0x07;
+            }
+
+            // 0x0A9B: STA 20C0
+            {
+                m.set<false>(0x20C0, s.A);
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0A9E;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x0A9E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0A9E: LDA 20C0
+            {
+                s.A = m.get<false>(0x20C0);
+            }
+
+            // 0x0AA1: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x0AA2: JNZ 0A9E
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = 0x0A9E;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 28;
+            s.PC = 0x0AA5;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0AA5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0AA5: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x0AA6: DCR C
+            {
+                s.setDecrementFlags(s.C);
+                --s.C;
+            }
+
+            // 0x0AA7: JNZ 0A93
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 20;
+                s.PC = 0x0A93;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 20;
+            s.PC = 0x0AAA;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0AAA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0AAA: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0AAB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0AAB: LXI HL, 2050
+            {
+                s.setHL(0x2050);
+            }
+
+            // 0x0AAE: JMP 024B
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x024B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0AB1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0AB1: MVI A, 40
+            {
+                s.A = 0x40;
+            }
+
+            // 0x0AB3: JMP 0AD7
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AD7;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0AB6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0AB6: MVI A, 80
+            {
+                s.A = 0x80;
+            }
+
+            // 0x0AB8: JMP 0AD7
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AD7;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x0ABB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0ABB: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x0ABC: JMP 0072
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x0072;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0ABF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0ABF: LDA 20C1
+            {
+                s.A = m.get<false>(0x20C1);
+            }
+
+            // 0x0AC2: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0AC3: JC 0ABB
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0ABB;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0AC6;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x0AC6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0AC6: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0AC7: JC 1868
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 14;
+                s.PC = 0x1868;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x0ACA;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x0ACA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0ACA: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x0ACB: JC 0AAB
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 14;
+                s.PC = 0x0AAB;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x0ACE;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0ACE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0ACE: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0ACF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0ACF: LXI HL, 2B14
+            {
+                s.setHL(0x2B14);
+            }
+
+            // 0x0AD2: MVI C, 0F
+            {
+                s.C = 0x0F;
+            }
+
+            // 0x0AD4: JMP 0A93
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0A93;
+            return;
+        }
+
+        // 13 machine cycles at most.
+        void block0x0AD7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0AD7: STA 20C0
+            {
+                m.set<false>(0x20C0, s.A);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 13;
+            s.PC = 0x0ADA;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0ADA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0ADA: LDA 20C0
+            {
+                s.A = m.get<false>(0x20C0);
+            }
+
+            // 0x0ADD: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0ADE: JNZ 0ADA
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0ADA;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0AE1;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0AE1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0AE1: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0AE2(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0AE2: LXI HL, 20C2
+            {
+                s.setHL(0x20C2);
+            }
+
+            // 0x0AE5: MVI B, 0C
+            {
+                s.B = 0x0C;
+            }
+
+            // 0x0AE7: JMP 1A32
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x1A32;
+            return;
+        }
+
+        // 41 machine cycles at most.
+        void block0x0AEA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x0AEA: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0AEB: OUT 03
+            {
+                context.executedMachineCycles += 4;
+                io.set(0x03, s.A);
+            }
+
+            // 0x0AED: OUT 05
+            {
+                context.executedMachineCycles += 10;
+                io.set(0x05, s.A);
+            }
+
+            // 0x0AEF: CALL 1982
+            m.setWord<false>(s.SP - 2, 0x0AF2);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 27;
+            s.PC = 0x1982;
+            return;
+        }
+
+        // 21 machine cycles at most.
+        void block0x0AF2(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0AF2: EI
+            {
+                s.interruptsEnabled = true;
+            }
+
+            // 0x0AF3: CALL 0AB1
+            m.setWord<false>(s.SP - 2, 0x0AF6);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 21;
+            s.PC = 0x0AB1;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x0AF6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0AF6: LDA 20EC
+            {
+                s.A = m.get<false>(0x20EC);
+            }
+
+            // 0x0AF9: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0AFA: LXI HL, 3017
+            {
+                s.setHL(0x3017);
+            }
+
+            // 0x0AFD: MVI C, 04
+            {
+                s.C = 0x04;
+            }
+
+            // 0x0AFF: JNZ 0BE8
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 44;
+                s.PC = 0x0BE8;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 44;
+            s.PC = 0x0B02;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0B02(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B02: LXI DE, 1CFA
+            {
+                s.setDE(0x1CFA);
+            }
+
+            // 0x0B05: CALL 0A93
+            m.setWord<false>(s.SP - 2, 0x0B08);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0A93;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0B08(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0B08: LXI DE, 1DAF
+            {
+                s.setDE(0x1DAF);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0B0B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B0B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B0B: CALL 0ACF
+            m.setWord<false>(s.SP - 2, 0x0B0E);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0ACF;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B0E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B0E: CALL 0AB1
+            m.setWord<false>(s.SP - 2, 0x0B11);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB1;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B11(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B11: CALL 1815
+            m.setWord<false>(s.SP - 2, 0x0B14);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1815;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B14(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B14: CALL 0AB6
+            m.setWord<false>(s.SP - 2, 0x0B17);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB6;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0B17(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B17: LDA 20EC
+            {
+                s.A = m.get<false>(0x20EC);
+            }
+
+            // 0x0B1A: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0B1B: JNZ 0B4A
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0B4A;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0B1E;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0B1E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B1E: LXI DE, 1A95
+            {
+                s.setDE(0x1A95);
+            }
+
+            // 0x0B21: CALL 0AE2
+            m.setWord<false>(s.SP - 2, 0x0B24);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0AE2;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B24(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B24: CALL 0A80
+            m.setWord<false>(s.SP - 2, 0x0B27);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A80;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0B27(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B27: LXI DE, 1BB0
+            {
+                s.setDE(0x1BB0);
+            }
+
+            // 0x0B2A: CALL 0AE2
+            m.setWord<false>(s.SP - 2, 0x0B2D);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0AE2;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B2D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B2D: CALL 0A80
+            m.setWord<false>(s.SP - 2, 0x0B30);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A80;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B30(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B30: CALL 0AB1
+            m.setWord<false>(s.SP - 2, 0x0B33);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB1;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0B33(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B33: LXI DE, 1FC9
+            {
+                s.setDE(0x1FC9);
+            }
+
+            // 0x0B36: CALL 0AE2
+            m.setWord<false>(s.SP - 2, 0x0B39);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0AE2;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B39(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B39: CALL 0A80
+            m.setWord<false>(s.SP - 2, 0x0B3C);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A80;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B3C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B3C: CALL 0AB1
+            m.setWord<false>(s.SP - 2, 0x0B3F);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB1;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x0B3F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B3F: LXI HL, 33B7
+            {
+                s.setHL(0x33B7);
+            }
+
+            // 0x0B42: MVI B, 0A
+            {
+                s.B = 0x0A;
+            }
+
+            // 0x0B44: CALL 14CB
+            m.setWord<false>(s.SP - 2, 0x0B47);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 34;
+            s.PC = 0x14CB;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B47(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B47: CALL 0AB6
+            m.setWord<false>(s.SP - 2, 0x0B4A);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB6;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B4A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B4A: CALL 09D6
+            m.setWord<false>(s.SP - 2, 0x0B4D);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0B4D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B4D: LDA 21FF
+            {
+                s.A = m.get<false>(0x21FF);
+            }
+
+            // 0x0B50: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0B51: JNZ 0B5D
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x0B5D;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0B54;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B54(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B54: CALL 08D1
+            m.setWord<false>(s.SP - 2, 0x0B57);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x08D1;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0B57(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B57: STA 21FF
+            {
+                m.set<false>(0x21FF, s.A);
+            }
+
+            // 0x0B5A: CALL 1A7F
+            m.setWord<false>(s.SP - 2, 0x0B5D);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 30;
+            s.PC = 0x1A7F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B5D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B5D: CALL 01E4
+            m.setWord<false>(s.SP - 2, 0x0B60);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01E4;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B60(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B60: CALL 01C0
+            m.setWord<false>(s.SP - 2, 0x0B63);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01C0;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B63(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B63: CALL 01EF
+            m.setWord<false>(s.SP - 2, 0x0B66);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x01EF;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B66(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B66: CALL 021A
+            m.setWord<false>(s.SP - 2, 0x0B69);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x021A;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x0B69(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B69: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x0B6B: STA 20C1
+            {
+                m.set<false>(0x20C1, s.A);
+            }
+
+            // 0x0B6E: CALL 01CF
+            m.setWord<false>(s.SP - 2, 0x0B71);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 37;
+            s.PC = 0x01CF;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B71(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B71: CALL 1618
+            m.setWord<false>(s.SP - 2, 0x0B74);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1618;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B74(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B74: CALL 0BF1
+            m.setWord<false>(s.SP - 2, 0x0B77);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0BF1;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0B77(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x0B77: OUT 06
+            {
+                io.set(0x06, s.A);
+            }
+
+            // 0x0B79: CALL 0A59
+            m.setWord<false>(s.SP - 2, 0x0B7C);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0A59;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0B7C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0B7C: JZ 0B71
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x0B71;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0B7F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B7F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B7F: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0B80: STA 2025
+            {
+                m.set<false>(0x2025, s.A);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0B83;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B83(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B83: CALL 0A59
+            m.setWord<false>(s.SP - 2, 0x0B86);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A59;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0B86(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0B86: JNZ 0B83
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x0B83;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0B89;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x0B89(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B89: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x0B8A: STA 20C1
+            {
+                m.set<false>(0x20C1, s.A);
+            }
+
+            // 0x0B8D: CALL 0AB1
+            m.setWord<false>(s.SP - 2, 0x0B90);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 34;
+            s.PC = 0x0AB1;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0B90(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B90: CALL 1988
+            m.setWord<false>(s.SP - 2, 0x0B93);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1988;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x0B93(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B93: MVI C, 0C
+            {
+                s.C = 0x0C;
+            }
+
+            // 0x0B95: LXI HL, 2C11
+            {
+                s.setHL(0x2C11);
+            }
+
+            // 0x0B98: LXI DE, 1F90
+            {
+                s.setDE(0x1F90);
+            }
+
+            // 0x0B9B: CALL 08F3
+            m.setWord<false>(s.SP - 2, 0x0B9E);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 44;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0B9E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0B9E: LDA 20EC
+            {
+                s.A = m.get<false>(0x20EC);
+            }
+
+            // 0x0BA1: CPI 00
+            {
+                byte value = 0x00;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0BA3: JNZ 0BAE
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 30;
+                s.PC = 0x0BAE;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0BA6;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x0BA6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BA6: LXI HL, 3311
+            {
+                s.setHL(0x3311);
+            }
+
+            // 0x0BA9: MVI A, 02
+            {
+                s.A = 0x02;
+            }
+
+            // 0x0BAB: CALL 08FF
+            m.setWord<false>(s.SP - 2, 0x0BAE);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 34;
+            s.PC = 0x08FF;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0BAE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BAE: LXI BC, 1F9C
+            {
+                s.setBC(0x1F9C);
+            }
+
+            // 0x0BB1: CALL 1856
+            m.setWord<false>(s.SP - 2, 0x0BB4);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x1856;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0BB4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BB4: CALL 184C
+            m.setWord<false>(s.SP - 2, 0x0BB7);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x184C;
+            return;
+        }
+
+        // 24 machine cycles at most.
+        void block0x0BB7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x0BB7: IN 02
+            {
+                s.A = io.get(0x02);
+            }
+
+            // 0x0BB9: RLC
+            {
+                s.setCY((s.A & 0x80) != 0);
+                s.A = (s.A << 1) | (s.A >> 7);
+            }
+
+            // 0x0BBA: JC 0BC3
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 24;
+                s.PC = 0x0BC3;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 24;
+            s.PC = 0x0BBD;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0BBD(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BBD: LXI BC, 1FA0
+            {
+                s.setBC(0x1FA0);
+            }
+
+            // 0x0BC0: CALL 183A
+            m.setWord<false>(s.SP - 2, 0x0BC3);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x183A;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0BC3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BC3: CALL 0AB6
+            m.setWord<false>(s.SP - 2, 0x0BC6);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB6;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x0BC6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BC6: LDA 20EC
+            {
+                s.A = m.get<false>(0x20EC);
+            }
+
+            // 0x0BC9: CPI 00
+            {
+                byte value = 0x00;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x0BCB: JNZ 0BDA
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 30;
+                s.PC = 0x0BDA;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0BCE;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0BCE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BCE: LXI DE, 1FD5
+            {
+                s.setDE(0x1FD5);
+            }
+
+            // 0x0BD1: CALL 0AE2
+            m.setWord<false>(s.SP - 2, 0x0BD4);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0AE2;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0BD4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BD4: CALL 0A80
+            m.setWord<false>(s.SP - 2, 0x0BD7);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A80;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0BD7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BD7: CALL 189E
+            m.setWord<false>(s.SP - 2, 0x0BDA);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x189E;
+            return;
+        }
+
+        // 53 machine cycles at most.
+        void block0x0BDA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BDA: LXI HL, 20EC
+            {
+                s.setHL(0x20EC);
+            }
+
+            // 0x0BDD: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x0BDE: INR A
+            {
+                s.setIncrementFlags(s.A);
+                ++s.A;
+            }
+
+            // 0x0BDF: ANI 01
+            {
+                byte value = 0x01;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x0BE1: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x0BE2: CALL 09D6
+            m.setWord<false>(s.SP - 2, 0x0BE5);
+            s.SP -= 2;
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 53;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0BE5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0BE5: JMP 18DF
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x18DF;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x0BE8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BE8: LXI DE, 1DAB
+            {
+                s.setDE(0x1DAB);
+            }
+
+            // 0x0BEB: CALL 0A93
+            m.setWord<false>(s.SP - 2, 0x0BEE);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0A93;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0BEE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0BEE: JMP 0B0B
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0B0B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x0BF1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x0BF1: CALL 190A
+            m.setWord<false>(s.SP - 2, 0x0BF4);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x190A;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x0BF4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x0BF4: JMP 199A
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x199A;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1424(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1424: CALL 1474
+            m.setWord<false>(s.SP - 2, 0x1427);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1474;
+            return;
+        }
+
+        // 105 machine cycles at most.
+        void block0x1427(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1427: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x1428: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x1429: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x142A: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x142B: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x142C: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x142D: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x142E: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x142F: LXI BC, 0020
+            {
+                s.setBC(0x0020);
+            }
+
+            // 0x1432: DAD BC
+            {
+                word value = s.getBC();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x1433: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x1434: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x1435: JNZ 1427
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 13;
+                context.executedMachineCycles += 105;
+                s.PC = 0x1427;
+                return;
+            }
+
+            context.executedInstructionCycles += 13;
+            context.executedMachineCycles += 105;
+            s.PC = 0x1438;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1438(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1438: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 75 machine cycles at most.
+        void block0x1439(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1439: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x143A: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x143B: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x143C: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x143D: LXI BC, 0020
+            {
+                s.setBC(0x0020);
+            }
+
+            // 0x1440: DAD BC
+            {
+                word value = s.getBC();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x1441: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x1442: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x1443: JNZ 1439
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 9;
+                context.executedMachineCycles += 75;
+                s.PC = 0x1439;
+                return;
+            }
+
+            context.executedInstructionCycles += 9;
+            context.executedMachineCycles += 75;
+            s.PC = 0x1446;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1446(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1446: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 32 machine cycles at most.
+        void block0x1474(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x1474: MOV A, L
+            {
+                s.A = s.L;
+            }
+
+            // 0x1475: ANI 07
+            {
+                byte value = 0x07;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1477: OUT 02
+            {
+                context.executedMachineCycles += 12;
+                io.set(0x02, s.A);
+            }
+
+            // 0x1479: JMP 1A47
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 20;
+            s.PC = 0x1A47;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x147C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x147C: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x147D: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 22;
+            s.PC = 0x147E;
+            return;
+        }
+
+        // 39 machine cycles at most.
+        void block0x147E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x147E: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x147F: STAX D
+            {
+                m.set<false>(s.getDE(), s.A);
+            }
+
+            // 0x1480: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x1481: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1482: DCR C
+            {
+                s.setDecrementFlags(s.C);
+                --s.C;
+            }
+
+            // 0x1483: JNZ 147E
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 39;
+                s.PC = 0x147E;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 39;
+            s.PC = 0x1486;
+            return;
+        }
+
+        // 55 machine cycles at most.
+        void block0x1486(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1486: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x1487: LXI BC, 0020
+            {
+                s.setBC(0x0020);
+            }
+
+            // 0x148A: DAD BC
+            {
+                word value = s.getBC();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x148B: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x148C: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x148D: JNZ 147C
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 55;
+                s.PC = 0x147C;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 55;
+            s.PC = 0x1490;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1490(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1490: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 4 machine cycles at most.
+        void block0x14CB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x14CB: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 4;
+            s.PC = 0x14CC;
+            return;
+        }
+
+        // 63 machine cycles at most.
+        void block0x14CC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x14CC: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x14CD: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x14CE: LXI BC, 0020
+            {
+                s.setBC(0x0020);
+            }
+
+            // 0x14D1: DAD BC
+            {
+                word value = s.getBC();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x14D2: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x14D3: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x14D4: JNZ 14CC
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 7;
+                context.executedMachineCycles += 63;
+                s.PC = 0x14CC;
+                return;
+            }
+
+            context.executedInstructionCycles += 7;
+            context.executedMachineCycles += 63;
+            s.PC = 0x14D7;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x14D7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x14D7: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x14D8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x14D8: LDA 2025
+            {
+                s.A = m.get<false>(0x2025);
+            }
+
+            // 0x14DB: CPI 05
+            {
+                byte value = 0x05;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x14DD: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 31;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 25;
+            s.PC = 0x14DE;
+            return;
+        }
+
+        // 18 machine cycles at most.
+        void block0x14DE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x14DE: CPI 02
+            {
+                byte value = 0x02;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x14E0: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 18;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 12;
+            s.PC = 0x14E1;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x14E1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x14E1: LDA 2029
+            {
+                s.A = m.get<false>(0x2029);
+            }
+
+            // 0x14E4: CPI D8
+            {
+                byte value = 0xD8;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x14E6: MOV B, A
+            {
+                s.B = s.A;
+            }
+
+            // 0x14E7: JNC 1530
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 35;
+                s.PC = 0x1530;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 35;
+            s.PC = 0x14EA;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x14EA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x14EA: LDA 2002
+            {
+                s.A = m.get<false>(0x2002);
+            }
+
+            // 0x14ED: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x14EE: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x14EF;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x14EF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x14EF: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x14F0: CPI CE
+            {
+                byte value = 0xCE;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x14F2: JNC 1579
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 22;
+                s.PC = 0x1579;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x14F5;
+            return;
+        }
+
+        // 42 machine cycles at most.
+        void block0x14F5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x14F5: ADI 06
+            {
+                byte value = 0x06;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x14F7: MOV B, A
+            {
+                s.B = s.A;
+            }
+
+            // 0x14F8: LDA 2009
+            {
+                s.A = m.get<false>(0x2009);
+            }
+
+            // 0x14FB: CPI 90
+            {
+                byte value = 0x90;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x14FD: JNC 1504
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 42;
+                s.PC = 0x1504;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 42;
+            s.PC = 0x1500;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x1500(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1500: CMP B
+            {
+                byte value = s.B;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x1501: JNC 1530
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 14;
+                s.PC = 0x1530;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x1504;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x1504(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1504: MOV L, B
+            {
+                s.L = s.B;
+            }
+
+            // 0x1505: CALL 1562
+            m.setWord<false>(s.SP - 2, 0x1508);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 22;
+            s.PC = 0x1562;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x1508(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1508: LDA 202A
+            {
+                s.A = m.get<false>(0x202A);
+            }
+
+            // 0x150B: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x150C: CALL 156F
+            m.setWord<false>(s.SP - 2, 0x150F);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 35;
+            s.PC = 0x156F;
+            return;
+        }
+
+        // 53 machine cycles at most.
+        void block0x150F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x150F: SHLD 2064
+            {
+                m.setWord<false>(0x2064, s.getHL());
+            }
+
+            // 0x1512: MVI A, 05
+            {
+                s.A = 0x05;
+            }
+
+            // 0x1514: STA 2025
+            {
+                m.set<false>(0x2025, s.A);
+            }
+
+            // 0x1517: CALL 1581
+            m.setWord<false>(s.SP - 2, 0x151A);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 53;
+            s.PC = 0x1581;
+            return;
+        }
+
+        // 21 machine cycles at most.
+        void block0x151A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x151A: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x151B: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x151C: JZ 1530
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 21;
+                s.PC = 0x1530;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 21;
+            s.PC = 0x151F;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x151F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x151F: MVI M, 00
+            {
+                m.set<false>(s.getHL(), 0x00);
+            }
+
+            // 0x1521: CALL 0A5F
+            m.setWord<false>(s.SP - 2, 0x1524);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x0A5F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1524(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1524: CALL 1A3B
+            m.setWord<false>(s.SP - 2, 0x1527);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1A3B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1527(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1527: CALL 15D3
+            m.setWord<false>(s.SP - 2, 0x152A);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x15D3;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x152A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x152A: MVI A, 10
+            {
+                s.A = 0x10;
+            }
+
+            // 0x152C: STA 2003
+            {
+                m.set<false>(0x2003, s.A);
+            }
+
+            // 0x152F: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = target;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x1530(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1530: MVI A, 03
+            {
+                s.A = 0x03;
+            }
+
+            // 0x1532: STA 2025
+            {
+                m.set<false>(0x2025, s.A);
+            }
+
+            // 0x1535: JMP 154A
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x154A;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x1538(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1538: LXI HL, 2003
+            {
+                s.setHL(0x2003);
+            }
+
+            // 0x153B: DCR M
+            {
+                word address = s.getHL();
+                byte value = m.get<false>(address);
+                s.setDecrementFlags(value);
+                m.set<false>(address, --value);
+            }
+
+            // 0x153C: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 31;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 25;
+            s.PC = 0x153D;
+            return;
+        }
+
+        // 40 machine cycles at most.
+        void block0x153D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x153D: LHLD 2064
+            {
+                s.setHL(m.getWord<false>(0x2064));
+            }
+
+            // 0x1540: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            // 0x1542: CALL 1424
+            m.setWord<false>(s.SP - 2, 0x1545);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 40;
+            s.PC = 0x1424;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x1545(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1545: MVI A, 04
+            {
+                s.A = 0x04;
+            }
+
+            // 0x1547: STA 2025
+            {
+                m.set<false>(0x2025, s.A);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x154A;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x154A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x154A: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x154B: STA 2002
+            {
+                m.set<false>(0x2002, s.A);
+            }
+
+            // 0x154E: MVI B, F7
+            {
+                s.B = 0xF7;
+            }
+
+            // 0x1550: JMP 19DC
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 34;
+            s.PC = 0x19DC;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x1554(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1554: MVI C, 00
+            {
+                s.C = 0x00;
+            }
+
+            // 0x1556: CMP H
+            {
+                byte value = s.H;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x1557: CNC 1590
+            if (!s.getCY())
+            {
+                m.setWord<false>(s.SP - 2, 0x155A);
+                s.SP -= 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = 0x1590;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x155A;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x155A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x155A: CMP H
+            {
+                byte value = s.H;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x155B: RNC
+            if (!s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 15;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 9;
+            s.PC = 0x155C;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x155C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x155C: ADI 10
+            {
+                byte value = 0x10;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x155E: INR C
+            {
+                s.setIncrementFlags(s.C);
+                ++s.C;
+            }
+
+            // 0x155F: JMP 155A
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x155A;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x1562(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1562: LDA 2009
+            {
+                s.A = m.get<false>(0x2009);
+            }
+
+            // 0x1565: MOV H, L
+            {
+                s.H = s.L;
+            }
+
+            // 0x1566: CALL 1554
+            m.setWord<false>(s.SP - 2, 0x1569);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 35;
+            s.PC = 0x1554;
+            return;
+        }
+
+        // 32 machine cycles at most.
+        void block0x1569(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1569: MOV B, C
+            {
+                s.B = s.C;
+            }
+
+            // 0x156A: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x156B: SBI 10
+            {
+                byte value = 0x10;
+                byte carry = s.getCY();
+                s.setSubtractFlags(s.A, value, carry);
+                s.A -= value + carry;
+            }
+
+            // 0x156D: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x156E: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 32;
+            s.PC = target;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x156F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x156F: LDA 200A
+            {
+                s.A = m.get<false>(0x200A);
+            }
+
+            // 0x1572: CALL 1554
+            m.setWord<false>(s.SP - 2, 0x1575);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 30;
+            s.PC = 0x1554;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x1575(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1575: SBI 10
+            {
+                byte value = 0x10;
+                byte carry = s.getCY();
+                s.setSubtractFlags(s.A, value, carry);
+                s.A -= value + carry;
+            }
+
+            // 0x1577: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x1578: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = target;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x1579(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1579: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x157B: STA 2085
+            {
+                m.set<false>(0x2085, s.A);
+            }
+
+            // 0x157E: JMP 1545
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x1545;
+            return;
+        }
+
+        // 71 machine cycles at most.
+        void block0x1581(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1581: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x1582: RLC
+            {
+                s.setCY((s.A & 0x80) != 0);
+                s.A = (s.A << 1) | (s.A >> 7);
+            }
+
+            // 0x1583: RLC
+            {
+                s.setCY((s.A & 0x80) != 0);
+                s.A = (s.A << 1) | (s.A >> 7);
+            }
+
+            // 0x1584: RLC
+            {
+                s.setCY((s.A & 0x80) != 0);
+                s.A = (s.A << 1) | (s.A >> 7);
+            }
+
+            // 0x1585: ADD B
+            {
+                byte value = s.B;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x1586: ADD B
+            {
+                byte value = s.B;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x1587: ADD B
+            {
+                byte value = s.B;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x1588: ADD C
+            {
+                byte value = s.C;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x1589: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x158A: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x158B: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x158E: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x158F: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 13;
+            context.executedMachineCycles += 71;
+            s.PC = target;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x1590(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1590: INR C
+            {
+                s.setIncrementFlags(s.C);
+                ++s.C;
+            }
+
+            // 0x1591: ADI 10
+            {
+                byte value = 0x10;
+                byte carry = 0;
+                s.setAddFlags(s.A, value, carry);
+                s.A += value + carry;
+            }
+
+            // 0x1593: JM 1590
+            if (s.getS())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 22;
+                s.PC = 0x1590;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x1596;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1596(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1596: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x1597(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1597: LDA 200D
+            {
+                s.A = m.get<false>(0x200D);
+            }
+
+            // 0x159A: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x159B: JNZ 15B7
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x15B7;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x159E;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x159E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x159E: LXI HL, 3EA4
+            {
+                s.setHL(0x3EA4);
+            }
+
+            // 0x15A1: CALL 15C5
+            m.setWord<false>(s.SP - 2, 0x15A4);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x15C5;
+            return;
+        }
+
+        // 11 machine cycles at most.
+        void block0x15A4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15A4: RNC
+            if (!s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 11;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x15A5;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x15A5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x15A5: MVI B, FE
+            {
+                s.B = 0xFE;
+            }
+
+            // 0x15A7: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x15A9;
+            return;
+        }
+
+        // 67 machine cycles at most.
+        void block0x15A9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15A9: STA 200D
+            {
+                m.set<false>(0x200D, s.A);
+            }
+
+            // 0x15AC: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x15AD: STA 2008
+            {
+                m.set<false>(0x2008, s.A);
+            }
+
+            // 0x15B0: LDA 200E
+            {
+                s.A = m.get<false>(0x200E);
+            }
+
+            // 0x15B3: STA 2007
+            {
+                m.set<false>(0x2007, s.A);
+            }
+
+            // 0x15B6: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 67;
+            s.PC = target;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x15B7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15B7: LXI HL, 2524
+            {
+                s.setHL(0x2524);
+            }
+
+            // 0x15BA: CALL 15C5
+            m.setWord<false>(s.SP - 2, 0x15BD);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x15C5;
+            return;
+        }
+
+        // 11 machine cycles at most.
+        void block0x15BD(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15BD: RNC
+            if (!s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 11;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x15BE;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x15BE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15BE: CALL 18F1
+            m.setWord<false>(s.SP - 2, 0x15C1);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x18F1;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x15C1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x15C1: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x15C2: JMP 15A9
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x15A9;
+            return;
+        }
+
+        // 7 machine cycles at most.
+        void block0x15C5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x15C5: MVI B, 17
+            {
+                s.B = 0x17;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 7;
+            s.PC = 0x15C7;
+            return;
+        }
+
+        // 21 machine cycles at most.
+        void block0x15C7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15C7: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x15C8: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x15C9: JNZ 166B
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 21;
+                s.PC = 0x166B;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 21;
+            s.PC = 0x15CC;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x15CC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x15CC: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x15CD: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x15CE: JNZ 15C7
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 20;
+                s.PC = 0x15C7;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 20;
+            s.PC = 0x15D1;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x15D1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15D1: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x15D3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15D3: CALL 1474
+            m.setWord<false>(s.SP - 2, 0x15D6);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1474;
+            return;
+        }
+
+        // 11 machine cycles at most.
+        void block0x15D6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15D6: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 11;
+            s.PC = 0x15D7;
+            return;
+        }
+
+        // 152 machine cycles at most.
+        void block0x15D7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x15D7: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x15D8: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            // 0x15D9: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x15DA: OUT 04
+            {
+                context.executedMachineCycles += 29;
+                io.set(0x04, s.A);
+            }
+
+            // 0x15DC: IN 03
+            {
+                context.executedMachineCycles += 10;
+                s.A = io.get(0x03);
+            }
+
+            // 0x15DE: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x15DF: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x15E0: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x15E1: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x15E2: OUT 04
+            {
+                context.executedMachineCycles += 31;
+                io.set(0x04, s.A);
+            }
+
+            // 0x15E4: IN 03
+            {
+                context.executedMachineCycles += 10;
+                s.A = io.get(0x03);
+            }
+
+            // 0x15E6: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x15E7: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x15E8: LXI BC, 0020
+            {
+                s.setBC(0x0020);
+            }
+
+            // 0x15EB: DAD BC
+            {
+                word value = s.getBC();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x15EC: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x15ED: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x15EE: JNZ 15D7
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 18;
+                context.executedMachineCycles += 72;
+                s.PC = 0x15D7;
+                return;
+            }
+
+            context.executedInstructionCycles += 18;
+            context.executedMachineCycles += 72;
+            s.PC = 0x15F1;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x15F1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15F1: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x15F2: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x15F3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15F3: CALL 1611
+            m.setWord<false>(s.SP - 2, 0x15F6);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1611;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x15F6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x15F6: LXI BC, 3700
+            {
+                s.setBC(0x3700);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x15F9;
+            return;
+        }
+
+        // 21 machine cycles at most.
+        void block0x15F9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x15F9: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x15FA: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x15FB: JZ 15FF
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 21;
+                s.PC = 0x15FF;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 21;
+            s.PC = 0x15FE;
+            return;
+        }
+
+        // 5 machine cycles at most.
+        void block0x15FE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x15FE: INR C
+            {
+                s.setIncrementFlags(s.C);
+                ++s.C;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x15FF;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x15FF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x15FF: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1600: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x1601: JNZ 15F9
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 20;
+                s.PC = 0x15F9;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 20;
+            s.PC = 0x1604;
+            return;
+        }
+
+        // 36 machine cycles at most.
+        void block0x1604(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1604: MOV A, C
+            {
+                s.A = s.C;
+            }
+
+            // 0x1605: STA 2082
+            {
+                m.set<false>(0x2082, s.A);
+            }
+
+            // 0x1608: CPI 01
+            {
+                byte value = 0x01;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x160A: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 36;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 30;
+            s.PC = 0x160B;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x160B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x160B: LXI HL, 206B
+            {
+                s.setHL(0x206B);
+            }
+
+            // 0x160E: MVI M, 01
+            {
+                m.set<false>(s.getHL(), 0x01);
+            }
+
+            // 0x1610: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = target;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x1611(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1611: MVI L, 00
+            {
+                s.L = 0x00;
+            }
+
+            // 0x1613: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x1616: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x1617: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 35;
+            s.PC = target;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x1618(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1618: LDA 2015
+            {
+                s.A = m.get<false>(0x2015);
+            }
+
+            // 0x161B: CPI FF
+            {
+                byte value = 0xFF;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x161D: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 31;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 25;
+            s.PC = 0x161E;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x161E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x161E: LXI HL, 2010
+            {
+                s.setHL(0x2010);
+            }
+
+            // 0x1621: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1622: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1623: MOV B, M
+            {
+                s.B = m.get<false>(s.getHL());
+            }
+
+            // 0x1624: ORA B
+            {
+                byte value = s.B;
+                s.A |= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x1625: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 44;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 38;
+            s.PC = 0x1626;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x1626(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1626: LDA 2025
+            {
+                s.A = m.get<false>(0x2025);
+            }
+
+            // 0x1629: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x162A: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x162B;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x162B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x162B: LDA 20EF
+            {
+                s.A = m.get<false>(0x20EF);
+            }
+
+            // 0x162E: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x162F: JZ 1652
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x1652;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x1632;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x1632(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1632: LDA 202D
+            {
+                s.A = m.get<false>(0x202D);
+            }
+
+            // 0x1635: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1636: JNZ 1648
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x1648;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x1639;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1639(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1639: CALL 17C0
+            m.setWord<false>(s.SP - 2, 0x163C);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x17C0;
+            return;
+        }
+
+        // 18 machine cycles at most.
+        void block0x163C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x163C: ANI 10
+            {
+                byte value = 0x10;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x163E: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 18;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 12;
+            s.PC = 0x163F;
+            return;
+        }
+
+        // 43 machine cycles at most.
+        void block0x163F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x163F: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x1641: STA 2025
+            {
+                m.set<false>(0x2025, s.A);
+            }
+
+            // 0x1644: STA 202D
+            {
+                m.set<false>(0x202D, s.A);
+            }
+
+            // 0x1647: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 43;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1648(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1648: CALL 17C0
+            m.setWord<false>(s.SP - 2, 0x164B);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x17C0;
+            return;
+        }
+
+        // 18 machine cycles at most.
+        void block0x164B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x164B: ANI 10
+            {
+                byte value = 0x10;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x164D: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 18;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 12;
+            s.PC = 0x164E;
+            return;
+        }
+
+        // 23 machine cycles at most.
+        void block0x164E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x164E: STA 202D
+            {
+                m.set<false>(0x202D, s.A);
+            }
+
+            // 0x1651: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 23;
+            s.PC = target;
+            return;
+        }
+
+        // 63 machine cycles at most.
+        void block0x1652(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1652: LXI HL, 2025
+            {
+                s.setHL(0x2025);
+            }
+
+            // 0x1655: MVI M, 01
+            {
+                m.set<false>(s.getHL(), 0x01);
+            }
+
+            // 0x1657: LHLD 20ED
+            {
+                s.setHL(m.getWord<false>(0x20ED));
+            }
+
+            // 0x165A: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x165B: MOV A, L
+            {
+                s.A = s.L;
+            }
+
+            // 0x165C: CPI 7E
+            {
+                byte value = 0x7E;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x165E: JC 1663
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 7;
+                context.executedMachineCycles += 63;
+                s.PC = 0x1663;
+                return;
+            }
+
+            context.executedInstructionCycles += 7;
+            context.executedMachineCycles += 63;
+            s.PC = 0x1661;
+            return;
+        }
+
+        // 7 machine cycles at most.
+        void block0x1661(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1661: MVI L, 74
+            {
+                s.L = 0x74;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 7;
+            s.PC = 0x1663;
+            return;
+        }
+
+        // 46 machine cycles at most.
+        void block0x1663(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1663: SHLD 20ED
+            {
+                m.setWord<false>(0x20ED, s.getHL());
+            }
+
+            // 0x1666: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1667: STA 201D
+            {
+                m.set<false>(0x201D, s.A);
+            }
+
+            // 0x166A: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 46;
+            s.PC = target;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x166B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x166B: STC
+            {
+                s.setCY(true);
+            }
+
+            // 0x166C: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1671(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1671: CALL 1910
+            m.setWord<false>(s.SP - 2, 0x1674);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1910;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x1674(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1674: MVI M, 00
+            {
+                m.set<false>(s.getHL(), 0x00);
+            }
+
+            // 0x1676: CALL 09CA
+            m.setWord<false>(s.SP - 2, 0x1679);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x09CA;
+            return;
+        }
+
+        // 56 machine cycles at most.
+        void block0x1679(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1679: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x167A: LXI DE, 20F5
+            {
+                s.setDE(0x20F5);
+            }
+
+            // 0x167D: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x167E: CMP M
+            {
+                byte value = m.get<false>(s.getHL());
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x167F: DCX DE
+            {
+                s.setDE(s.getDE() - 1);
+            }
+
+            // 0x1680: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x1681: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x1682: JZ 168B
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 8;
+                context.executedMachineCycles += 56;
+                s.PC = 0x168B;
+                return;
+            }
+
+            context.executedInstructionCycles += 8;
+            context.executedMachineCycles += 56;
+            s.PC = 0x1685;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1685(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1685: JNC 1698
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x1698;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x1688;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1688(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1688: JMP 168F
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x168F;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x168B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x168B: CMP M
+            {
+                byte value = m.get<false>(s.getHL());
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x168C: JNC 1698
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 17;
+                s.PC = 0x1698;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x168F;
+            return;
+        }
+
+        // 55 machine cycles at most.
+        void block0x168F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x168F: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1690: STAX D
+            {
+                m.set<false>(s.getDE(), s.A);
+            }
+
+            // 0x1691: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x1692: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1693: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1694: STAX D
+            {
+                m.set<false>(s.getDE(), s.A);
+            }
+
+            // 0x1695: CALL 1950
+            m.setWord<false>(s.SP - 2, 0x1698);
+            s.SP -= 2;
+            context.executedInstructionCycles += 7;
+            context.executedMachineCycles += 55;
+            s.PC = 0x1950;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x1698(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1698: LDA 20CE
+            {
+                s.A = m.get<false>(0x20CE);
+            }
+
+            // 0x169B: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x169C: JZ 16C9
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x16C9;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x169F;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x169F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x169F: LXI HL, 2803
+            {
+                s.setHL(0x2803);
+            }
+
+            // 0x16A2: LXI DE, 1AA6
+            {
+                s.setDE(0x1AA6);
+            }
+
+            // 0x16A5: MVI C, 14
+            {
+                s.C = 0x14;
+            }
+
+            // 0x16A7: CALL 0A93
+            m.setWord<false>(s.SP - 2, 0x16AA);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 44;
+            s.PC = 0x0A93;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x16AA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16AA: DCR H
+            {
+                s.setDecrementFlags(s.H);
+                --s.H;
+            }
+
+            // 0x16AB: DCR H
+            {
+                s.setDecrementFlags(s.H);
+                --s.H;
+            }
+
+            // 0x16AC: MVI B, 1B
+            {
+                s.B = 0x1B;
+            }
+
+            // 0x16AE: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x16B1: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x16B2: JC 16B7
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 44;
+                s.PC = 0x16B7;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 44;
+            s.PC = 0x16B5;
+            return;
+        }
+
+        // 7 machine cycles at most.
+        void block0x16B5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x16B5: MVI B, 1C
+            {
+                s.B = 0x1C;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 7;
+            s.PC = 0x16B7;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x16B7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16B7: MOV A, B
+            {
+                s.A = s.B;
+            }
+
+            // 0x16B8: CALL 08FF
+            m.setWord<false>(s.SP - 2, 0x16BB);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 22;
+            s.PC = 0x08FF;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x16BB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16BB: CALL 0AB1
+            m.setWord<false>(s.SP - 2, 0x16BE);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB1;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x16BE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16BE: CALL 18E7
+            m.setWord<false>(s.SP - 2, 0x16C1);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x18E7;
+            return;
+        }
+
+        // 21 machine cycles at most.
+        void block0x16C1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16C1: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x16C2: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x16C3: JZ 16C9
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 21;
+                s.PC = 0x16C9;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 21;
+            s.PC = 0x16C6;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x16C6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x16C6: JMP 02ED
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x02ED;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x16C9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16C9: LXI HL, 2D18
+            {
+                s.setHL(0x2D18);
+            }
+
+            // 0x16CC: LXI DE, 1AA6
+            {
+                s.setDE(0x1AA6);
+            }
+
+            // 0x16CF: MVI C, 0A
+            {
+                s.C = 0x0A;
+            }
+
+            // 0x16D1: CALL 0A93
+            m.setWord<false>(s.SP - 2, 0x16D4);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 44;
+            s.PC = 0x0A93;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x16D4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16D4: CALL 0AB6
+            m.setWord<false>(s.SP - 2, 0x16D7);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB6;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x16D7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16D7: CALL 09D6
+            m.setWord<false>(s.SP - 2, 0x16DA);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x16DA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x16DA: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x16DB: STA 20EF
+            {
+                m.set<false>(0x20EF, s.A);
+            }
+
+            // 0x16DE: OUT 05
+            {
+                context.executedMachineCycles += 17;
+                io.set(0x05, s.A);
+            }
+
+            // 0x16E0: CALL 19D1
+            m.setWord<false>(s.SP - 2, 0x16E3);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 27;
+            s.PC = 0x19D1;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x16E3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x16E3: JMP 0B89
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0B89;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x16E6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16E6: LXI SP, 2400
+            {
+                s.SP = 0x2400;
+            }
+
+            // 0x16E9: EI
+            {
+                s.interruptsEnabled = true;
+            }
+
+            // 0x16EA: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x16EB: STA 2015
+            {
+                m.set<false>(0x2015, s.A);
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 31;
+            s.PC = 0x16EE;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x16EE(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16EE: CALL 14D8
+            m.setWord<false>(s.SP - 2, 0x16F1);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x14D8;
+            return;
+        }
+
+        // 24 machine cycles at most.
+        void block0x16F1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16F1: MVI B, 04
+            {
+                s.B = 0x04;
+            }
+
+            // 0x16F3: CALL 18FA
+            m.setWord<false>(s.SP - 2, 0x16F6);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 24;
+            s.PC = 0x18FA;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x16F6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16F6: CALL 0A59
+            m.setWord<false>(s.SP - 2, 0x16F9);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0A59;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x16F9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x16F9: JNZ 16EE
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x16EE;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x16FC;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x16FC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16FC: CALL 19D7
+            m.setWord<false>(s.SP - 2, 0x16FF);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x19D7;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x16FF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x16FF: LXI HL, 2701
+            {
+                s.setHL(0x2701);
+            }
+
+            // 0x1702: CALL 19FA
+            m.setWord<false>(s.SP - 2, 0x1705);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 27;
+            s.PC = 0x19FA;
+            return;
+        }
+
+        // 21 machine cycles at most.
+        void block0x1705(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1705: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x1706: CALL 1A8B
+            m.setWord<false>(s.SP - 2, 0x1709);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 21;
+            s.PC = 0x1A8B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1709(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1709: MVI B, FB
+            {
+                s.B = 0xFB;
+            }
+
+            // 0x170B: JMP 196B
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x196B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x170E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x170E: CALL 09CA
+            m.setWord<false>(s.SP - 2, 0x1711);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09CA;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x1711(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1711: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1712: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1713: LXI DE, 1CB8
+            {
+                s.setDE(0x1CB8);
+            }
+
+            // 0x1716: LXI HL, 1AA1
+            {
+                s.setHL(0x1AA1);
+            }
+
+            // 0x1719: MVI C, 04
+            {
+                s.C = 0x04;
+            }
+
+            // 0x171B: MOV B, A
+            {
+                s.B = s.A;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 44;
+            s.PC = 0x171C;
+            return;
+        }
+
+        // 21 machine cycles at most.
+        void block0x171C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x171C: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x171D: CMP B
+            {
+                byte value = s.B;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x171E: JNC 1727
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 21;
+                s.PC = 0x1727;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 21;
+            s.PC = 0x1721;
+            return;
+        }
+
+        // 25 machine cycles at most.
+        void block0x1721(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1721: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1722: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x1723: DCR C
+            {
+                s.setDecrementFlags(s.C);
+                --s.C;
+            }
+
+            // 0x1724: JNZ 171C
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 25;
+                s.PC = 0x171C;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 25;
+            s.PC = 0x1727;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x1727(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1727: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1728: STA 20CF
+            {
+                m.set<false>(0x20CF, s.A);
+            }
+
+            // 0x172B: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = target;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x172C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x172C: LDA 2025
+            {
+                s.A = m.get<false>(0x2025);
+            }
+
+            // 0x172F: CPI 00
+            {
+                byte value = 0x00;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x1731: JNZ 1739
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 30;
+                s.PC = 0x1739;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x1734;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1734(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1734: MVI B, FD
+            {
+                s.B = 0xFD;
+            }
+
+            // 0x1736: JMP 19DC
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x19DC;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1739(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1739: MVI B, 02
+            {
+                s.B = 0x02;
+            }
+
+            // 0x173B: JMP 18FA
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x18FA;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x1740(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1740: LXI HL, 209B
+            {
+                s.setHL(0x209B);
+            }
+
+            // 0x1743: DCR M
+            {
+                word address = s.getHL();
+                byte value = m.get<false>(address);
+                s.setDecrementFlags(value);
+                m.set<false>(address, --value);
+            }
+
+            // 0x1744: CZ 176D
+            if (s.getZ())
+            {
+                m.setWord<false>(s.SP - 2, 0x1747);
+                s.SP -= 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 37;
+                s.PC = 0x176D;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 31;
+            s.PC = 0x1747;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x1747(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1747: LDA 2068
+            {
+                s.A = m.get<false>(0x2068);
+            }
+
+            // 0x174A: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x174B: JZ 176D
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x176D;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x174E;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x174E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x174E: LXI HL, 2096
+            {
+                s.setHL(0x2096);
+            }
+
+            // 0x1751: DCR M
+            {
+                word address = s.getHL();
+                byte value = m.get<false>(address);
+                s.setDecrementFlags(value);
+                m.set<false>(address, --value);
+            }
+
+            // 0x1752: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 31;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 25;
+            s.PC = 0x1753;
+            return;
+        }
+
+        // 54 machine cycles at most.
+        void block0x1753(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x1753: LXI HL, 2098
+            {
+                s.setHL(0x2098);
+            }
+
+            // 0x1756: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1757: OUT 05
+            {
+                context.executedMachineCycles += 17;
+                io.set(0x05, s.A);
+            }
+
+            // 0x1759: LDA 2082
+            {
+                s.A = m.get<false>(0x2082);
+            }
+
+            // 0x175C: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x175D: JZ 176D
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 37;
+                s.PC = 0x176D;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 37;
+            s.PC = 0x1760;
+            return;
+        }
+
+        // 69 machine cycles at most.
+        void block0x1760(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1760: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x1761: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1762: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x1763: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x1764: DCX HL
+            {
+                s.setHL(s.getHL() - 1);
+            }
+
+            // 0x1765: MVI M, 01
+            {
+                m.set<false>(s.getHL(), 0x01);
+            }
+
+            // 0x1767: MVI A, 04
+            {
+                s.A = 0x04;
+            }
+
+            // 0x1769: STA 209B
+            {
+                m.set<false>(0x209B, s.A);
+            }
+
+            // 0x176C: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 9;
+            context.executedMachineCycles += 69;
+            s.PC = target;
+            return;
+        }
+
+        // 40 machine cycles at most.
+        void block0x176D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x176D: LDA 2098
+            {
+                s.A = m.get<false>(0x2098);
+            }
+
+            // 0x1770: ANI 30
+            {
+                byte value = 0x30;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1772: OUT 05
+            {
+                context.executedMachineCycles += 20;
+                io.set(0x05, s.A);
+            }
+
+            // 0x1774: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x1775(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1775: LDA 2095
+            {
+                s.A = m.get<false>(0x2095);
+            }
+
+            // 0x1778: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1779: JZ 17AA
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x17AA;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x177C;
+            return;
+        }
+
+        // 33 machine cycles at most.
+        void block0x177C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x177C: LXI HL, 1A11
+            {
+                s.setHL(0x1A11);
+            }
+
+            // 0x177F: LXI DE, 1A21
+            {
+                s.setDE(0x1A21);
+            }
+
+            // 0x1782: LDA 2082
+            {
+                s.A = m.get<false>(0x2082);
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 33;
+            s.PC = 0x1785;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1785(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1785: CMP M
+            {
+                byte value = m.get<false>(s.getHL());
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x1786: JNC 178E
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 17;
+                s.PC = 0x178E;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1789;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x1789(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1789: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x178A: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x178B: JMP 1785
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 20;
+            s.PC = 0x1785;
+            return;
+        }
+
+        // 84 machine cycles at most.
+        void block0x178E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x178E: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x178F: STA 2097
+            {
+                m.set<false>(0x2097, s.A);
+            }
+
+            // 0x1792: LXI HL, 2098
+            {
+                s.setHL(0x2098);
+            }
+
+            // 0x1795: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1796: ANI 30
+            {
+                byte value = 0x30;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1798: MOV B, A
+            {
+                s.B = s.A;
+            }
+
+            // 0x1799: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x179A: ANI 0F
+            {
+                byte value = 0x0F;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x179C: RLC
+            {
+                s.setCY((s.A & 0x80) != 0);
+                s.A = (s.A << 1) | (s.A >> 7);
+            }
+
+            // 0x179D: CPI 10
+            {
+                byte value = 0x10;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x179F: JNZ 17A4
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 11;
+                context.executedMachineCycles += 84;
+                s.PC = 0x17A4;
+                return;
+            }
+
+            context.executedInstructionCycles += 11;
+            context.executedMachineCycles += 84;
+            s.PC = 0x17A2;
+            return;
+        }
+
+        // 7 machine cycles at most.
+        void block0x17A2(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x17A2: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 7;
+            s.PC = 0x17A4;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x17A4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17A4: ORA B
+            {
+                byte value = s.B;
+                s.A |= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x17A5: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x17A6: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x17A7: STA 2095
+            {
+                m.set<false>(0x2095, s.A);
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 28;
+            s.PC = 0x17AA;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x17AA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17AA: LXI HL, 2099
+            {
+                s.setHL(0x2099);
+            }
+
+            // 0x17AD: DCR M
+            {
+                word address = s.getHL();
+                byte value = m.get<false>(address);
+                s.setDecrementFlags(value);
+                m.set<false>(address, --value);
+            }
+
+            // 0x17AE: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 31;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 25;
+            s.PC = 0x17AF;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x17AF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x17AF: MVI B, EF
+            {
+                s.B = 0xEF;
+            }
+
+            // 0x17B1: JMP 19DC
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x19DC;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x17C0(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17C0: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x17C3: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x17C4: JNC 17CA
+            if (!s.getCY())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x17CA;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x17C7;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x17C7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x17C7: IN 01
+            {
+                s.A = io.get(0x01);
+            }
+
+            // 0x17C9: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x17CA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x17CA: IN 02
+            {
+                s.A = io.get(0x02);
+            }
+
+            // 0x17CC: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x17CD(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x17CD: IN 02
+            {
+                s.A = io.get(0x02);
+            }
+
+            // 0x17CF: ANI 04
+            {
+                byte value = 0x04;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x17D1: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x17D2;
+            return;
+        }
+
+        // 28 machine cycles at most.
+        void block0x17D2(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17D2: LDA 209A
+            {
+                s.A = m.get<false>(0x209A);
+            }
+
+            // 0x17D5: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x17D6: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 28;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x17D7;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x17D7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x17D7: LXI SP, 2400
+            {
+                s.SP = 0x2400;
+            }
+
+            // 0x17DA: MVI B, 04
+            {
+                s.B = 0x04;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x17DC;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x17DC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17DC: CALL 09D6
+            m.setWord<false>(s.SP - 2, 0x17DF);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x17DF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x17DF: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x17E0: JNZ 17DC
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 15;
+                s.PC = 0x17DC;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 15;
+            s.PC = 0x17E3;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x17E3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17E3: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x17E5: STA 209A
+            {
+                m.set<false>(0x209A, s.A);
+            }
+
+            // 0x17E8: CALL 19D7
+            m.setWord<false>(s.SP - 2, 0x17EB);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 37;
+            s.PC = 0x19D7;
+            return;
+        }
+
+        // 48 machine cycles at most.
+        void block0x17EB(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17EB: EI
+            {
+                s.interruptsEnabled = true;
+            }
+
+            // 0x17EC: LXI DE, 1CBC
+            {
+                s.setDE(0x1CBC);
+            }
+
+            // 0x17EF: LXI HL, 3016
+            {
+                s.setHL(0x3016);
+            }
+
+            // 0x17F2: MVI C, 04
+            {
+                s.C = 0x04;
+            }
+
+            // 0x17F4: CALL 0A93
+            m.setWord<false>(s.SP - 2, 0x17F7);
+            s.SP -= 2;
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 48;
+            s.PC = 0x0A93;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x17F7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17F7: CALL 0AB1
+            m.setWord<false>(s.SP - 2, 0x17FA);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x0AB1;
+            return;
+        }
+
+        // 40 machine cycles at most.
+        void block0x17FA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x17FA: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x17FB: STA 209A
+            {
+                m.set<false>(0x209A, s.A);
+            }
+
+            // 0x17FE: STA 2093
+            {
+                m.set<false>(0x2093, s.A);
+            }
+
+            // 0x1801: JMP 16C9
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 40;
+            s.PC = 0x16C9;
+            return;
+        }
+
+        // 31 machine cycles at most.
+        void block0x1804(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1804: LXI HL, 2084
+            {
+                s.setHL(0x2084);
+            }
+
+            // 0x1807: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1808: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1809: JZ 0707
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 31;
+                s.PC = 0x0707;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 31;
+            s.PC = 0x180C;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x180C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x180C: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x180D: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x180E: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x180F: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 27;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 21;
+            s.PC = 0x1810;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1810(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1810: MVI B, 01
+            {
+                s.B = 0x01;
+            }
+
+            // 0x1812: JMP 18FA
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 17;
+            s.PC = 0x18FA;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x1815(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1815: LXI HL, 2810
+            {
+                s.setHL(0x2810);
+            }
+
+            // 0x1818: LXI DE, 1CA3
+            {
+                s.setDE(0x1CA3);
+            }
+
+            // 0x181B: MVI C, 15
+            {
+                s.C = 0x15;
+            }
+
+            // 0x181D: CALL 08F3
+            m.setWord<false>(s.SP - 2, 0x1820);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 44;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x1820(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1820: MVI A, 0A
+            {
+                s.A = 0x0A;
+            }
+
+            // 0x1822: STA 206C
+            {
+                m.set<false>(0x206C, s.A);
+            }
+
+            // 0x1825: LXI BC, 1DBE
+            {
+                s.setBC(0x1DBE);
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x1828;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1828(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1828: CALL 1856
+            m.setWord<false>(s.SP - 2, 0x182B);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1856;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x182B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x182B: JC 1837
+            if (s.getCY())
+            {
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 10;
+                s.PC = 0x1837;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x182E;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x182E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x182E: CALL 1844
+            m.setWord<false>(s.SP - 2, 0x1831);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1844;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1831(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1831: JMP 1828
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x1828;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1837(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1837: LXI BC, 1DCF
+            {
+                s.setBC(0x1DCF);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x183A;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x183A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x183A: CALL 1856
+            m.setWord<false>(s.SP - 2, 0x183D);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1856;
+            return;
+        }
+
+        // 11 machine cycles at most.
+        void block0x183D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x183D: RC
+            if (s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 1;
+                context.executedMachineCycles += 11;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 5;
+            s.PC = 0x183E;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x183E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x183E: CALL 184C
+            m.setWord<false>(s.SP - 2, 0x1841);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x184C;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1841(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1841: JMP 183A
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x183A;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x1844(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1844: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x1845: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            // 0x1847: CALL 1439
+            m.setWord<false>(s.SP - 2, 0x184A);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 35;
+            s.PC = 0x1439;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x184A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x184A: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x184B: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 46 machine cycles at most.
+        void block0x184C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x184C: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x184D: LDA 206C
+            {
+                s.A = m.get<false>(0x206C);
+            }
+
+            // 0x1850: MOV C, A
+            {
+                s.C = s.A;
+            }
+
+            // 0x1851: CALL 0A93
+            m.setWord<false>(s.SP - 2, 0x1854);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 46;
+            s.PC = 0x0A93;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x1854(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1854: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x1855: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 29 machine cycles at most.
+        void block0x1856(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1856: LDAX B
+            {
+                s.A = m.get<false>(s.getBC());
+            }
+
+            // 0x1857: CPI FF
+            {
+                byte value = 0xFF;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x1859: STC
+            {
+                s.setCY(true);
+            }
+
+            // 0x185A: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 29;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 23;
+            s.PC = 0x185B;
+            return;
+        }
+
+        // 75 machine cycles at most.
+        void block0x185B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x185B: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x185C: INX BC
+            {
+                s.setBC(s.getBC() + 1);
+            }
+
+            // 0x185D: LDAX B
+            {
+                s.A = m.get<false>(s.getBC());
+            }
+
+            // 0x185E: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x185F: INX BC
+            {
+                s.setBC(s.getBC() + 1);
+            }
+
+            // 0x1860: LDAX B
+            {
+                s.A = m.get<false>(s.getBC());
+            }
+
+            // 0x1861: MOV E, A
+            {
+                s.E = s.A;
+            }
+
+            // 0x1862: INX BC
+            {
+                s.setBC(s.getBC() + 1);
+            }
+
+            // 0x1863: LDAX B
+            {
+                s.A = m.get<false>(s.getBC());
+            }
+
+            // 0x1864: MOV D, A
+            {
+                s.D = s.A;
+            }
+
+            // 0x1865: INX BC
+            {
+                s.setBC(s.getBC() + 1);
+            }
+
+            // 0x1866: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1867: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 13;
+            context.executedMachineCycles += 75;
+            s.PC = target;
+            return;
+        }
+
+        // 49 machine cycles at most.
+        void block0x1868(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1868: LXI HL, 20C2
+            {
+                s.setHL(0x20C2);
+            }
+
+            // 0x186B: INR M
+            {
+                word address = s.getHL();
+                byte value = m.get<false>(address);
+                s.setIncrementFlags(value);
+                m.set<false>(address, ++value);
+            }
+
+            // 0x186C: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x186D: MOV C, M
+            {
+                s.C = m.get<false>(s.getHL());
+            }
+
+            // 0x186E: CALL 01D9
+            m.setWord<false>(s.SP - 2, 0x1871);
+            s.SP -= 2;
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 49;
+            s.PC = 0x01D9;
+            return;
+        }
+
+        // 32 machine cycles at most.
+        void block0x1871(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1871: MOV B, A
+            {
+                s.B = s.A;
+            }
+
+            // 0x1872: LDA 20CA
+            {
+                s.A = m.get<false>(0x20CA);
+            }
+
+            // 0x1875: CMP B
+            {
+                byte value = s.B;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x1876: JZ 1898
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 32;
+                s.PC = 0x1898;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 32;
+            s.PC = 0x1879;
+            return;
+        }
+
+        // 46 machine cycles at most.
+        void block0x1879(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1879: LDA 20C2
+            {
+                s.A = m.get<false>(0x20C2);
+            }
+
+            // 0x187C: ANI 04
+            {
+                byte value = 0x04;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x187E: LHLD 20CC
+            {
+                s.setHL(m.getWord<false>(0x20CC));
+            }
+
+            // 0x1881: JNZ 1888
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 46;
+                s.PC = 0x1888;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 46;
+            s.PC = 0x1884;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x1884(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1884: LXI DE, 0030
+            {
+                s.setDE(0x0030);
+            }
+
+            // 0x1887: DAD DE
+            {
+                word value = s.getDE();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x1888;
+            return;
+        }
+
+        // 43 machine cycles at most.
+        void block0x1888(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1888: SHLD 20C7
+            {
+                m.setWord<false>(0x20C7, s.getHL());
+            }
+
+            // 0x188B: LXI HL, 20C5
+            {
+                s.setHL(0x20C5);
+            }
+
+            // 0x188E: CALL 1A3B
+            m.setWord<false>(s.SP - 2, 0x1891);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 43;
+            s.PC = 0x1A3B;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x1891(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1891: XCHG
+            {
+                word value = s.getHL();
+                s.setHL(s.getDE());
+                s.setDE(value);
+            }
+
+            // 0x1892: JMP 15D3
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x15D3;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x1898(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1898: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x189A: STA 20CB
+            {
+                m.set<false>(0x20CB, s.A);
+            }
+
+            // 0x189D: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = target;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x189E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x189E: LXI HL, 2050
+            {
+                s.setHL(0x2050);
+            }
+
+            // 0x18A1: LXI DE, 1BC0
+            {
+                s.setDE(0x1BC0);
+            }
+
+            // 0x18A4: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            // 0x18A6: CALL 1A32
+            m.setWord<false>(s.SP - 2, 0x18A9);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 44;
+            s.PC = 0x1A32;
+            return;
+        }
+
+        // 60 machine cycles at most.
+        void block0x18A9(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18A9: MVI A, 02
+            {
+                s.A = 0x02;
+            }
+
+            // 0x18AB: STA 2080
+            {
+                m.set<false>(0x2080, s.A);
+            }
+
+            // 0x18AE: MVI A, FF
+            {
+                s.A = 0xFF;
+            }
+
+            // 0x18B0: STA 207E
+            {
+                m.set<false>(0x207E, s.A);
+            }
+
+            // 0x18B3: MVI A, 04
+            {
+                s.A = 0x04;
+            }
+
+            // 0x18B5: STA 20C1
+            {
+                m.set<false>(0x20C1, s.A);
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 60;
+            s.PC = 0x18B8;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x18B8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18B8: LDA 2055
+            {
+                s.A = m.get<false>(0x2055);
+            }
+
+            // 0x18BB: ANI 01
+            {
+                byte value = 0x01;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x18BD: JZ 18B8
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 30;
+                s.PC = 0x18B8;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x18C0;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x18C0(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18C0: LDA 2055
+            {
+                s.A = m.get<false>(0x2055);
+            }
+
+            // 0x18C3: ANI 01
+            {
+                byte value = 0x01;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x18C5: JNZ 18C0
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 30;
+                s.PC = 0x18C0;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x18C8;
+            return;
+        }
+
+        // 38 machine cycles at most.
+        void block0x18C8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18C8: LXI HL, 3311
+            {
+                s.setHL(0x3311);
+            }
+
+            // 0x18CB: MVI A, 26
+            {
+                s.A = 0x26;
+            }
+
+            // 0x18CD: NOP
+
+            // 0x18CE: CALL 08FF
+            m.setWord<false>(s.SP - 2, 0x18D1);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 38;
+            s.PC = 0x08FF;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x18D1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x18D1: JMP 0AB6
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x0AB6;
+            return;
+        }
+
+        // 34 machine cycles at most.
+        void block0x18D4(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18D4: LXI SP, 2400
+            {
+                s.SP = 0x2400;
+            }
+
+            // 0x18D7: MVI B, 00
+            {
+                s.B = 0x00;
+            }
+
+            // 0x18D9: CALL 01E6
+            m.setWord<false>(s.SP - 2, 0x18DC);
+            s.SP -= 2;
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 34;
+            s.PC = 0x01E6;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x18DC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18DC: CALL 1956
+            m.setWord<false>(s.SP - 2, 0x18DF);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1956;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x18DF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18DF: MVI A, 08
+            {
+                s.A = 0x08;
+            }
+
+            // 0x18E1: STA 20CF
+            {
+                m.set<false>(0x20CF, s.A);
+            }
+
+            // 0x18E4: JMP 0AEA
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x0AEA;
+            return;
+        }
+
+        // 38 machine cycles at most.
+        void block0x18E7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18E7: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x18EA: LXI HL, 20E7
+            {
+                s.setHL(0x20E7);
+            }
+
+            // 0x18ED: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x18EE: RNC
+            if (!s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 38;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 32;
+            s.PC = 0x18EF;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x18EF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18EF: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x18F0: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 15;
+            s.PC = target;
+            return;
+        }
+
+        // 36 machine cycles at most.
+        void block0x18F1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18F1: MVI B, 02
+            {
+                s.B = 0x02;
+            }
+
+            // 0x18F3: LDA 2082
+            {
+                s.A = m.get<false>(0x2082);
+            }
+
+            // 0x18F6: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x18F7: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 36;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 30;
+            s.PC = 0x18F8;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x18F8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x18F8: INR B
+            {
+                s.setIncrementFlags(s.B);
+                ++s.B;
+            }
+
+            // 0x18F9: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 15;
+            s.PC = target;
+            return;
+        }
+
+        // 50 machine cycles at most.
+        void block0x18FA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x18FA: LDA 2094
+            {
+                s.A = m.get<false>(0x2094);
+            }
+
+            // 0x18FD: ORA B
+            {
+                byte value = s.B;
+                s.A |= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x18FE: STA 2094
+            {
+                m.set<false>(0x2094, s.A);
+            }
+
+            // 0x1901: OUT 03
+            {
+                context.executedMachineCycles += 30;
+                io.set(0x03, s.A);
+            }
+
+            // 0x1903: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x1904(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1904: LXI HL, 2200
+            {
+                s.setHL(0x2200);
+            }
+
+            // 0x1907: JMP 01C3
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x01C3;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x190A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x190A: CALL 14D8
+            m.setWord<false>(s.SP - 2, 0x190D);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x14D8;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x190D(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x190D: JMP 1597
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x1597;
+            return;
+        }
+
+        // 38 machine cycles at most.
+        void block0x1910(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1910: LXI HL, 20E7
+            {
+                s.setHL(0x20E7);
+            }
+
+            // 0x1913: LDA 2067
+            {
+                s.A = m.get<false>(0x2067);
+            }
+
+            // 0x1916: RRC
+            {
+                s.setCY((s.A & 0x01) != 0);
+                s.A = (s.A >> 1) | (s.A << 7);
+            }
+
+            // 0x1917: RC
+            if (s.getCY())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 38;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 32;
+            s.PC = 0x1918;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x1918(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1918: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1919: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 15;
+            s.PC = target;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x191A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x191A: MVI C, 1C
+            {
+                s.C = 0x1C;
+            }
+
+            // 0x191C: LXI HL, 241E
+            {
+                s.setHL(0x241E);
+            }
+
+            // 0x191F: LXI DE, 1AE4
+            {
+                s.setDE(0x1AE4);
+            }
+
+            // 0x1922: JMP 08F3
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 37;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x1925(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1925: LXI HL, 20F8
+            {
+                s.setHL(0x20F8);
+            }
+
+            // 0x1928: JMP 1931
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x1931;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x192B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x192B: LXI HL, 20FC
+            {
+                s.setHL(0x20FC);
+            }
+
+            // 0x192E: JMP 1931
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x1931;
+            return;
+        }
+
+        // 58 machine cycles at most.
+        void block0x1931(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1931: MOV E, M
+            {
+                s.E = m.get<false>(s.getHL());
+            }
+
+            // 0x1932: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1933: MOV D, M
+            {
+                s.D = m.get<false>(s.getHL());
+            }
+
+            // 0x1934: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1935: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1936: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1937: MOV H, M
+            {
+                s.H = m.get<false>(s.getHL());
+            }
+
+            // 0x1938: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x1939: JMP 09AD
+            context.executedInstructionCycles += 9;
+            context.executedMachineCycles += 58;
+            s.PC = 0x09AD;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x193C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x193C: MVI C, 07
+            {
+                s.C = 0x07;
+            }
+
+            // 0x193E: LXI HL, 3501
+            {
+                s.setHL(0x3501);
+            }
+
+            // 0x1941: LXI DE, 1FA9
+            {
+                s.setDE(0x1FA9);
+            }
+
+            // 0x1944: JMP 08F3
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 37;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 33 machine cycles at most.
+        void block0x1947(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1947: LDA 20EB
+            {
+                s.A = m.get<false>(0x20EB);
+            }
+
+            // 0x194A: LXI HL, 3C01
+            {
+                s.setHL(0x3C01);
+            }
+
+            // 0x194D: JMP 09B2
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 33;
+            s.PC = 0x09B2;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x1950(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1950: LXI HL, 20F4
+            {
+                s.setHL(0x20F4);
+            }
+
+            // 0x1953: JMP 1931
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x1931;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1956(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1956: CALL 1A5C
+            m.setWord<false>(s.SP - 2, 0x1959);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1A5C;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1959(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1959: CALL 191A
+            m.setWord<false>(s.SP - 2, 0x195C);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x191A;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x195C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x195C: CALL 1925
+            m.setWord<false>(s.SP - 2, 0x195F);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1925;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x195F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x195F: CALL 192B
+            m.setWord<false>(s.SP - 2, 0x1962);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x192B;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1962(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1962: CALL 1950
+            m.setWord<false>(s.SP - 2, 0x1965);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1950;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1965(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1965: CALL 193C
+            m.setWord<false>(s.SP - 2, 0x1968);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x193C;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1968(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1968: JMP 1947
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x1947;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x196B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x196B: CALL 19DC
+            m.setWord<false>(s.SP - 2, 0x196E);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x19DC;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x196E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x196E: JMP 1671
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x1671;
+            return;
+        }
+
+        // 30 machine cycles at most.
+        void block0x1971(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1971: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            // 0x1973: STA 206D
+            {
+                m.set<false>(0x206D, s.A);
+            }
+
+            // 0x1976: JMP 16E6
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 30;
+            s.PC = 0x16E6;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1979(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1979: CALL 19D7
+            m.setWord<false>(s.SP - 2, 0x197C);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x19D7;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x197C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x197C: CALL 1947
+            m.setWord<false>(s.SP - 2, 0x197F);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x1947;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x197F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x197F: JMP 193C
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x193C;
+            return;
+        }
+
+        // 23 machine cycles at most.
+        void block0x1982(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1982: STA 20C1
+            {
+                m.set<false>(0x20C1, s.A);
+            }
+
+            // 0x1985: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 23;
+            s.PC = target;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1988(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1988: JMP 09D6
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x09D6;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x199A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x199A: LDA 201E
+            {
+                s.A = m.get<false>(0x201E);
+            }
+
+            // 0x199D: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x199E: JNZ 19AC
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 27;
+                s.PC = 0x19AC;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x19A1;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x19A1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x19A1: IN 01
+            {
+                s.A = io.get(0x01);
+            }
+
+            // 0x19A3: ANI 76
+            {
+                byte value = 0x76;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x19A5: SUI 72
+            {
+                byte value = 0x72;
+                byte carry = 0;
+                s.setSubtractFlags(s.A, value, carry);
+                s.A -= value + carry;
+            }
+
+            // 0x19A7: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 35;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 29;
+            s.PC = 0x19A8;
+            return;
+        }
+
+        // 18 machine cycles at most.
+        void block0x19A8(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x19A8: INR A
+            {
+                s.setIncrementFlags(s.A);
+                ++s.A;
+            }
+
+            // 0x19A9: STA 201E
+            {
+                m.set<false>(0x201E, s.A);
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 18;
+            s.PC = 0x19AC;
+            return;
+        }
+
+        // 35 machine cycles at most.
+        void block0x19AC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x19AC: IN 01
+            {
+                s.A = io.get(0x01);
+            }
+
+            // 0x19AE: ANI 76
+            {
+                byte value = 0x76;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x19B0: CPI 34
+            {
+                byte value = 0x34;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x19B2: RNZ
+            if (!s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 4;
+                context.executedMachineCycles += 35;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 29;
+            s.PC = 0x19B3;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x19B3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x19B3: LXI HL, 2E1B
+            {
+                s.setHL(0x2E1B);
+            }
+
+            // 0x19B6: LXI DE, 0BF7
+            {
+                s.setDE(0x0BF7);
+            }
+
+            // 0x19B9: MVI C, 09
+            {
+                s.C = 0x09;
+            }
+
+            // 0x19BB: JMP 08F3
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 37;
+            s.PC = 0x08F3;
+            return;
+        }
+
+        // 7 machine cycles at most.
+        void block0x19D1(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x19D1: MVI A, 01
+            {
+                s.A = 0x01;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 7;
+            s.PC = 0x19D3;
+            return;
+        }
+
+        // 23 machine cycles at most.
+        void block0x19D3(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x19D3: STA 20E9
+            {
+                m.set<false>(0x20E9, s.A);
+            }
+
+            // 0x19D6: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 23;
+            s.PC = target;
+            return;
+        }
+
+        // 14 machine cycles at most.
+        void block0x19D7(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x19D7: XRA A
+            {
+                byte value = s.A;
+                s.A ^= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x19D8: JMP 19D3
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 14;
+            s.PC = 0x19D3;
+            return;
+        }
+
+        // 50 machine cycles at most.
+        void block0x19DC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+            SpaceInvadersIO& io = context.io;
+
+            // 0x19DC: LDA 2094
+            {
+                s.A = m.get<false>(0x2094);
+            }
+
+            // 0x19DF: ANA B
+            {
+                byte value = s.B;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x19E0: STA 2094
+            {
+                m.set<false>(0x2094, s.A);
+            }
+
+            // 0x19E3: OUT 03
+            {
+                context.executedMachineCycles += 30;
+                io.set(0x03, s.A);
+            }
+
+            // 0x19E5: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 20;
+            s.PC = target;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x19E6(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x19E6: LXI HL, 2701
+            {
+                s.setHL(0x2701);
+            }
+
+            // 0x19E9: JZ 19FA
+            if (s.getZ())
+            {
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 20;
+                s.PC = 0x19FA;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 20;
+            s.PC = 0x19EC;
+            return;
+        }
+
+        // 39 machine cycles at most.
+        void block0x19EC(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x19EC: LXI DE, 1C60
+            {
+                s.setDE(0x1C60);
+            }
+
+            // 0x19EF: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            // 0x19F1: MOV C, A
+            {
+                s.C = s.A;
+            }
+
+            // 0x19F2: CALL 1439
+            m.setWord<false>(s.SP - 2, 0x19F5);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 39;
+            s.PC = 0x1439;
+            return;
+        }
+
+        // 20 machine cycles at most.
+        void block0x19F5(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x19F5: MOV A, C
+            {
+                s.A = s.C;
+            }
+
+            // 0x19F6: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x19F7: JNZ 19EC
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 20;
+                s.PC = 0x19EC;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 20;
+            s.PC = 0x19FA;
+            return;
+        }
+
+        // 24 machine cycles at most.
+        void block0x19FA(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x19FA: MVI B, 10
+            {
+                s.B = 0x10;
+            }
+
+            // 0x19FC: CALL 14CB
+            m.setWord<false>(s.SP - 2, 0x19FF);
+            s.SP -= 2;
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 24;
+            s.PC = 0x14CB;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x19FF(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x19FF: MOV A, H
+            {
+                s.A = s.H;
+            }
+
+            // 0x1A00: CPI 35
+            {
+                byte value = 0x35;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x1A02: JNZ 19FA
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 3;
+                context.executedMachineCycles += 22;
+                s.PC = 0x19FA;
+                return;
+            }
+
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 22;
+            s.PC = 0x1A05;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1A05(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A05: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 39 machine cycles at most.
+        void block0x1A32(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A32: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x1A33: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x1A34: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1A35: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x1A36: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x1A37: JNZ 1A32
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 39;
+                s.PC = 0x1A32;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 39;
+            s.PC = 0x1A3A;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1A3A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A3A: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 75 machine cycles at most.
+        void block0x1A3B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A3B: MOV E, M
+            {
+                s.E = m.get<false>(s.getHL());
+            }
+
+            // 0x1A3C: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1A3D: MOV D, M
+            {
+                s.D = m.get<false>(s.getHL());
+            }
+
+            // 0x1A3E: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1A3F: MOV A, M
+            {
+                s.A = m.get<false>(s.getHL());
+            }
+
+            // 0x1A40: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1A41: MOV C, M
+            {
+                s.C = m.get<false>(s.getHL());
+            }
+
+            // 0x1A42: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1A43: MOV B, M
+            {
+                s.B = m.get<false>(s.getHL());
+            }
+
+            // 0x1A44: MOV H, C
+            {
+                s.H = s.C;
+            }
+
+            // 0x1A45: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x1A46: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 12;
+            context.executedMachineCycles += 75;
+            s.PC = target;
+            return;
+        }
+
+        // 18 machine cycles at most.
+        void block0x1A47(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A47: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x1A48: MVI B, 03
+            {
+                s.B = 0x03;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 18;
+            s.PC = 0x1A4A;
+            return;
+        }
+
+        // 43 machine cycles at most.
+        void block0x1A4A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1A4A: MOV A, H
+            {
+                s.A = s.H;
+            }
+
+            // 0x1A4B: RAR
+            {
+                byte carry = s.A & 0x01;
+                s.A = (s.A >> 1) | (s.getCY() << 7);
+                s.setCY(carry);
+            }
+
+            // 0x1A4C: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x1A4D: MOV A, L
+            {
+                s.A = s.L;
+            }
+
+            // 0x1A4E: RAR
+            {
+                byte carry = s.A & 0x01;
+                s.A = (s.A >> 1) | (s.getCY() << 7);
+                s.setCY(carry);
+            }
+
+            // 0x1A4F: MOV L, A
+            {
+                s.L = s.A;
+            }
+
+            // 0x1A50: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x1A51: JNZ 1A4A
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 8;
+                context.executedMachineCycles += 43;
+                s.PC = 0x1A4A;
+                return;
+            }
+
+            context.executedInstructionCycles += 8;
+            context.executedMachineCycles += 43;
+            s.PC = 0x1A54;
+            return;
+        }
+
+        // 44 machine cycles at most.
+        void block0x1A54(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A54: MOV A, H
+            {
+                s.A = s.H;
+            }
+
+            // 0x1A55: ANI 3F
+            {
+                byte value = 0x3F;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1A57: ORI 20
+            {
+                byte value = 0x20;
+                s.A |= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x1A59: MOV H, A
+            {
+                s.H = s.A;
+            }
+
+            // 0x1A5A: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x1A5B: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 44;
+            s.PC = target;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1A5C(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1A5C: LXI HL, 2400
+            {
+                s.setHL(0x2400);
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x1A5F;
+            return;
+        }
+
+        // 37 machine cycles at most.
+        void block0x1A5F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A5F: MVI M, 00
+            {
+                m.set<false>(s.getHL(), 0x00);
+            }
+
+            // 0x1A61: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1A62: MOV A, H
+            {
+                s.A = s.H;
+            }
+
+            // 0x1A63: CPI 40
+            {
+                byte value = 0x40;
+                s.setSubtractFlags(s.A, value, 0);
+            }
+
+            // 0x1A65: JNZ 1A5F
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 5;
+                context.executedMachineCycles += 37;
+                s.PC = 0x1A5F;
+                return;
+            }
+
+            context.executedInstructionCycles += 5;
+            context.executedMachineCycles += 37;
+            s.PC = 0x1A68;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1A68(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A68: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 22 machine cycles at most.
+        void block0x1A69(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A69: PUSH BC
+            {
+                m.setWord<false>(s.SP - 2, s.getBC());
+                s.SP -= 2;
+            }
+
+            // 0x1A6A: PUSH HL
+            {
+                m.setWord<false>(s.SP - 2, s.getHL());
+                s.SP -= 2;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 22;
+            s.PC = 0x1A6B;
+            return;
+        }
+
+        // 46 machine cycles at most.
+        void block0x1A6B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A6B: LDAX D
+            {
+                s.A = m.get<false>(s.getDE());
+            }
+
+            // 0x1A6C: ORA M
+            {
+                byte value = m.get<false>(s.getHL());
+                s.A |= value;
+                s.setLogicFlags(s.A, 0);
+            }
+
+            // 0x1A6D: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x1A6E: INX DE
+            {
+                s.setDE(s.getDE() + 1);
+            }
+
+            // 0x1A6F: INX HL
+            {
+                s.setHL(s.getHL() + 1);
+            }
+
+            // 0x1A70: DCR C
+            {
+                s.setDecrementFlags(s.C);
+                --s.C;
+            }
+
+            // 0x1A71: JNZ 1A6B
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 7;
+                context.executedMachineCycles += 46;
+                s.PC = 0x1A6B;
+                return;
+            }
+
+            context.executedInstructionCycles += 7;
+            context.executedMachineCycles += 46;
+            s.PC = 0x1A74;
+            return;
+        }
+
+        // 55 machine cycles at most.
+        void block0x1A74(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A74: POP HL
+            {
+                s.setHL(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x1A75: LXI BC, 0020
+            {
+                s.setBC(0x0020);
+            }
+
+            // 0x1A78: DAD BC
+            {
+                word value = s.getBC();
+                s.setCY(value > (0xFFFF - s.getHL()));
+                s.setHL(s.getHL() + value);
+            }
+
+            // 0x1A79: POP BC
+            {
+                s.setBC(m.getWord<false>(s.SP));
+                s.SP += 2;
+            }
+
+            // 0x1A7A: DCR B
+            {
+                s.setDecrementFlags(s.B);
+                --s.B;
+            }
+
+            // 0x1A7B: JNZ 1A69
+            if (!s.getZ())
+            {
+                context.executedInstructionCycles += 6;
+                context.executedMachineCycles += 55;
+                s.PC = 0x1A69;
+                return;
+            }
+
+            context.executedInstructionCycles += 6;
+            context.executedMachineCycles += 55;
+            s.PC = 0x1A7E;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1A7E(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A7E: RET
+            word target = m.getWord<false>(s.SP);
+            s.SP += 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = target;
+            return;
+        }
+
+        // 17 machine cycles at most.
+        void block0x1A7F(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A7F: CALL 092E
+            m.setWord<false>(s.SP - 2, 0x1A82);
+            s.SP -= 2;
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 17;
+            s.PC = 0x092E;
+            return;
+        }
+
+        // 15 machine cycles at most.
+        void block0x1A82(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A82: ANA A
+            {
+                byte value = s.A;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1A83: RZ
+            if (s.getZ())
+            {
+                word target = m.getWord<false>(s.SP);
+                s.SP += 2;
+                context.executedInstructionCycles += 2;
+                context.executedMachineCycles += 15;
+                s.PC = target;
+                return;
+            }
+
+            context.executedInstructionCycles += 2;
+            context.executedMachineCycles += 9;
+            s.PC = 0x1A84;
+            return;
+        }
+
+        // 40 machine cycles at most.
+        void block0x1A84(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A84: PUSH PSW
+            {
+                m.set<false>(s.SP - 1, s.A);
+                m.set<false>(s.SP - 2, s.packFlags());
+                s.SP -= 2;
+            }
+
+            // 0x1A85: DCR A
+            {
+                s.setDecrementFlags(s.A);
+                --s.A;
+            }
+
+            // 0x1A86: MOV M, A
+            {
+                m.set<false>(s.getHL(), s.A);
+            }
+
+            // 0x1A87: CALL 19E6
+            m.setWord<false>(s.SP - 2, 0x1A8A);
+            s.SP -= 2;
+            context.executedInstructionCycles += 4;
+            context.executedMachineCycles += 40;
+            s.PC = 0x19E6;
+            return;
+        }
+
+        // 10 machine cycles at most.
+        void block0x1A8A(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+            Memory& m = context.memory;
+
+            // 0x1A8A: POP PSW
+            {
+                s.unpackFlags(m.get<false>(s.SP));
+                s.A = m.get<false>(s.SP + 1);
+                s.SP += 2;
+            }
+
+            context.executedInstructionCycles += 1;
+            context.executedMachineCycles += 10;
+            s.PC = 0x1A8B;
+            return;
+        }
+
+        // 27 machine cycles at most.
+        void block0x1A8B(RecompiledCpu::Context& context)
+        {
+            CpuState& s = context.state;
+
+            // 0x1A8B: LXI HL, 2501
+            {
+                s.setHL(0x2501);
+            }
+
+            // 0x1A8E: ANI 0F
+            {
+                byte value = 0x0F;
+                byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;
+                s.A &= value;
+                s.setLogicFlags(s.A, auxiliaryCarry);
+            }
+
+            // 0x1A90: JMP 09C5
+            context.executedInstructionCycles += 3;
+            context.executedMachineCycles += 27;
+            s.PC = 0x09C5;
+            return;
+        }
+
+        const RecompiledCpu::Block blocks[] =
+        {
+            {0x0000, 22, block0x0000},
+            {0x0008, 54, block0x0008},
+            {0x0010, 101, block0x0010},
+            {0x0020, 24, block0x0020},
+            {0x0026, 27, block0x0026},
+            {0x002D, 30, block0x002D},
+            {0x0035, 41, block0x0035},
+            {0x003E, 4, block0x003E},
+            {0x003F, 13, block0x003F},
+            {0x0042, 27, block0x0042},
+            {0x0049, 27, block0x0049},
+            {0x0050, 27, block0x0050},
+            {0x0057, 17, block0x0057},
+            {0x005A, 10, block0x005A},
+            {0x005D, 27, block0x005D},
+            {0x0064, 10, block0x0064},
+            {0x0067, 30, block0x0067},
+            {0x006F, 17, block0x006F},
+            {0x0072, 43, block0x0072},
+            {0x007B, 17, block0x007B},
+            {0x007E, 17, block0x007E},
+            {0x0081, 4, block0x0081},
+            {0x0082, 54, block0x0082},
+            {0x008C, 44, block0x008C},
+            {0x0097, 27, block0x0097},
+            {0x009E, 27, block0x009E},
+            {0x00A5, 27, block0x00A5},
+            {0x00AB, 17, block0x00AB},
+            {0x00AE, 10, block0x00AE},
+            {0x00B1, 17, block0x00B1},
+            {0x00B4, 106, block0x00B4},
+            {0x00C7, 5, block0x00C7},
+            {0x00C8, 37, block0x00C8},
+            {0x00D2, 5, block0x00D2},
+            {0x00D3, 23, block0x00D3},
+            {0x00D7, 43, block0x00D7},
+            {0x0100, 31, block0x0100},
+            {0x0108, 78, block0x0108},
+            {0x0117, 110, block0x0117},
+            {0x012E, 40, block0x012E},
+            {0x0136, 27, block0x0136},
+            {0x013B, 34, block0x013B},
+            {0x0141, 28, block0x0141},
+            {0x0146, 28, block0x0146},
+            {0x014B, 38, block0x014B},
+            {0x0154, 29, block0x0154},
+            {0x015A, 27, block0x015A},
+            {0x0160, 30, block0x0160},
+            {0x0166, 43, block0x0166},
+            {0x0170, 48, block0x0170},
+            {0x017A, 41, block0x017A},
+            {0x0183, 17, block0x0183},
+            {0x0188, 49, block0x0188},
+            {0x0194, 5, block0x0194},
+            {0x0195, 15, block0x0195},
+            {0x0197, 42, block0x0197},
+            {0x01A1, 15, block0x01A1},
+            {0x01A5, 59, block0x01A5},
+            {0x01B1, 67, block0x01B1},
+            {0x01C0, 10, block0x01C0},
+            {0x01C3, 7, block0x01C3},
+            {0x01C5, 30, block0x01C5},
+            {0x01CC, 10, block0x01CC},
+            {0x01CD, 20, block0x01CD},
+            {0x01CF, 34, block0x01CF},
+            {0x01D9, 70, block0x01D9},
+            {0x01E4, 7, block0x01E4},
+            {0x01E6, 30, block0x01E6},
+            {0x01EF, 20, block0x01EF},
+            {0x01F5, 10, block0x01F5},
+            {0x01F8, 17, block0x01F8},
+            {0x01FD, 35, block0x01FD},
+            {0x0203, 25, block0x0203},
+            {0x0208, 10, block0x0208},
+            {0x0209, 17, block0x0209},
+            {0x020E, 17, block0x020E},
+            {0x0213, 4, block0x0213},
+            {0x0214, 20, block0x0214},
+            {0x021A, 4, block0x021A},
+            {0x021B, 10, block0x021B},
+            {0x021E, 40, block0x021E},
+            {0x0229, 49, block0x0229},
+            {0x0232, 17, block0x0232},
+            {0x0235, 36, block0x0235},
+            {0x0239, 51, block0x0239},
+            {0x0242, 17, block0x0242},
+            {0x0245, 10, block0x0245},
+            {0x0248, 10, block0x0248},
+            {0x024B, 25, block0x024B},
+            {0x024F, 17, block0x024F},
+            {0x0254, 36, block0x0254},
+            {0x025C, 26, block0x025C},
+            {0x0262, 94, block0x0262},
+            {0x0277, 20, block0x0277},
+            {0x027C, 5, block0x027C},
+            {0x027D, 24, block0x027D},
+            {0x0281, 30, block0x0281},
+            {0x0288, 30, block0x0288},
+            {0x02ED, 38, block0x02ED},
+            {0x02F5, 17, block0x02F5},
+            {0x02F8, 17, block0x02F8},
+            {0x02FB, 57, block0x02FB},
+            {0x0305, 38, block0x0305},
+            {0x030E, 14, block0x030E},
+            {0x0312, 30, block0x0312},
+            {0x0318, 67, block0x0318},
+            {0x0326, 17, block0x0326},
+            {0x0329, 10, block0x0329},
+            {0x0332, 17, block0x0332},
+            {0x0335, 10, block0x0335},
+            {0x0707, 17, block0x0707},
+            {0x0765, 51, block0x0765},
+            {0x0771, 17, block0x0771},
+            {0x0774, 44, block0x0774},
+            {0x077F, 45, block0x077F},
+            {0x078B, 27, block0x078B},
+            {0x0791, 27, block0x0791},
+            {0x0798, 11, block0x0798},
+            {0x079B, 64, block0x079B},
+            {0x07A9, 59, block0x07A9},
+            {0x07B5, 17, block0x07B5},
+            {0x07B8, 17, block0x07B8},
+            {0x07BB, 77, block0x07BB},
+            {0x07CB, 17, block0x07CB},
+            {0x07CE, 17, block0x07CE},
+            {0x07D1, 17, block0x07D1},
+            {0x07D4, 43, block0x07D4},
+            {0x07DD, 47, block0x07DD},
+            {0x07E7, 17, block0x07E7},
+            {0x07EA, 59, block0x07EA},
+            {0x07F6, 17, block0x07F6},
+            {0x07F9, 17, block0x07F9},
+            {0x07FC, 17, block0x07FC},
+            {0x07FF, 21, block0x07FF},
+            {0x0804, 17, block0x0804},
+            {0x0807, 27, block0x0807},
+            {0x080E, 17, block0x080E},
+            {0x0811, 17, block0x0811},
+            {0x0814, 17, block0x0814},
+            {0x0817, 17, block0x0817},
+            {0x081A, 24, block0x081A},
+            {0x081F, 17, block0x081F},
+            {0x0822, 17, block0x0822},
+            {0x0825, 17, block0x0825},
+            {0x0828, 17, block0x0828},
+            {0x082B, 27, block0x082B},
+            {0x0832, 17, block0x0832},
+            {0x0835, 17, block0x0835},
+            {0x0838, 17, block0x0838},
+            {0x083B, 17, block0x083B},
+            {0x083E, 17, block0x083E},
+            {0x0841, 10, block0x0841},
+            {0x0844, 24, block0x0844},
+            {0x0849, 17, block0x0849},
+            {0x084C, 27, block0x084C},
+            {0x0851, 10, block0x0851},
+            {0x0857, 27, block0x0857},
+            {0x085D, 35, block0x085D},
+            {0x0866, 14, block0x0866},
+            {0x086A, 10, block0x086A},
+            {0x086D, 17, block0x086D},
+            {0x0872, 17, block0x0872},
+            {0x0875, 10, block0x0875},
+            {0x0878, 48, block0x0878},
+            {0x0886, 35, block0x0886},
+            {0x088D, 44, block0x088D},
+            {0x0898, 51, block0x0898},
+            {0x08A4, 20, block0x08A4},
+            {0x08A9, 28, block0x08A9},
+            {0x08AE, 17, block0x08AE},
+            {0x08B3, 17, block0x08B3},
+            {0x08B6, 17, block0x08B6},
+            {0x08B9, 10, block0x08B9},
+            {0x08BC, 44, block0x08BC},
+            {0x08C8, 10, block0x08C8},
+            {0x08CB, 17, block0x08CB},
+            {0x08CE, 10, block0x08CE},
+            {0x08D1, 34, block0x08D1},
+            {0x08D8, 31, block0x08D8},
+            {0x08DE, 30, block0x08DE},
+            {0x08E4, 28, block0x08E4},
+            {0x08E9, 27, block0x08E9},
+            {0x08F3, 35, block0x08F3},
+            {0x08F8, 30, block0x08F8},
+            {0x08FE, 10, block0x08FE},
+            {0x08FF, 114, block0x08FF},
+            {0x0913, 31, block0x0913},
+            {0x0919, 35, block0x0919},
+            {0x0921, 30, block0x0921},
+            {0x0929, 31, block0x0929},
+            {0x092E, 17, block0x092E},
+            {0x0931, 24, block0x0931},
+            {0x0935, 17, block0x0935},
+            {0x0938, 32, block0x0938},
+            {0x093D, 34, block0x093D},
+            {0x0946, 7, block0x0946},
+            {0x0948, 17, block0x0948},
+            {0x094B, 27, block0x094B},
+            {0x094F, 17, block0x094F},
+            {0x0952, 38, block0x0952},
+            {0x0958, 25, block0x0958},
+            {0x095E, 34, block0x095E},
+            {0x0966, 32, block0x0966},
+            {0x096B, 17, block0x096B},
+            {0x096E, 57, block0x096E},
+            {0x097C, 28, block0x097C},
+            {0x0982, 23, block0x0982},
+            {0x0986, 15, block0x0986},
+            {0x0988, 17, block0x0988},
+            {0x098B, 28, block0x098B},
+            {0x0990, 156, block0x0990},
+            {0x09AD, 22, block0x09AD},
+            {0x09B1, 5, block0x09B1},
+            {0x09B2, 62, block0x09B2},
+            {0x09BD, 34, block0x09BD},
+            {0x09C3, 20, block0x09C3},
+            {0x09C5, 17, block0x09C5},
+            {0x09CA, 38, block0x09CA},
+            {0x09D2, 20, block0x09D2},
+            {0x09D6, 10, block0x09D6},
+            {0x09D9, 44, block0x09D9},
+            {0x09E4, 20, block0x09E4},
+            {0x09E8, 22, block0x09E8},
+            {0x09EE, 10, block0x09EE},
+            {0x09EF, 17, block0x09EF},
+            {0x09F2, 34, block0x09F2},
+            {0x09F9, 41, block0x09F9},
+            {0x0A00, 95, block0x0A00},
+            {0x0A13, 20, block0x0A13},
+            {0x0A18, 65, block0x0A18},
+            {0x0A25, 37, block0x0A25},
+            {0x0A2D, 17, block0x0A2D},
+            {0x0A30, 10, block0x0A30},
+            {0x0A33, 17, block0x0A33},
+            {0x0A36, 17, block0x0A36},
+            {0x0A39, 10, block0x0A39},
+            {0x0A3C, 17, block0x0A3C},
+            {0x0A3F, 10, block0x0A3F},
+            {0x0A42, 20, block0x0A42},
+            {0x0A47, 28, block0x0A47},
+            {0x0A4C, 17, block0x0A4C},
+            {0x0A4F, 10, block0x0A4F},
+            {0x0A52, 17, block0x0A52},
+            {0x0A55, 10, block0x0A55},
+            {0x0A58, 10, block0x0A58},
+            {0x0A59, 30, block0x0A59},
+            {0x0A5F, 27, block0x0A5F},
+            {0x0A66, 29, block0x0A66},
+            {0x0A6C, 27, block0x0A6C},
+            {0x0A71, 54, block0x0A71},
+            {0x0A7C, 20, block0x0A7C},
+            {0x0A80, 20, block0x0A80},
+            {0x0A85, 37, block0x0A85},
+            {0x0A8E, 27, block0x0A8E},
+            {0x0A93, 35, block0x0A93},
+            {0x0A98, 30, block0x0A98},
+            {0x0A9E, 28, block0x0A9E},
+            {0x0AA5, 20, block0x0AA5},
+            {0x0AAA, 10, block0x0AAA},
+            {0x0AAB, 20, block0x0AAB},
+            {0x0AB1, 17, block0x0AB1},
+            {0x0AB6, 17, block0x0AB6},
+            {0x0ABB, 20, block0x0ABB},
+            {0x0ABF, 27, block0x0ABF},
+            {0x0AC6, 14, block0x0AC6},
+            {0x0ACA, 14, block0x0ACA},
+            {0x0ACE, 10, block0x0ACE},
+            {0x0ACF, 27, block0x0ACF},
+            {0x0AD7, 13, block0x0AD7},
+            {0x0ADA, 27, block0x0ADA},
+            {0x0AE1, 10, block0x0AE1},
+            {0x0AE2, 27, block0x0AE2},
+            {0x0AEA, 41, block0x0AEA},
+            {0x0AF2, 21, block0x0AF2},
+            {0x0AF6, 44, block0x0AF6},
+            {0x0B02, 27, block0x0B02},
+            {0x0B08, 10, block0x0B08},
+            {0x0B0B, 17, block0x0B0B},
+            {0x0B0E, 17, block0x0B0E},
+            {0x0B11, 17, block0x0B11},
+            {0x0B14, 17, block0x0B14},
+            {0x0B17, 27, block0x0B17},
+            {0x0B1E, 27, block0x0B1E},
+            {0x0B24, 17, block0x0B24},
+            {0x0B27, 27, block0x0B27},
+            {0x0B2D, 17, block0x0B2D},
+            {0x0B30, 17, block0x0B30},
+            {0x0B33, 27, block0x0B33},
+            {0x0B39, 17, block0x0B39},
+            {0x0B3C, 17, block0x0B3C},
+            {0x0B3F, 34, block0x0B3F},
+            {0x0B47, 17, block0x0B47},
+            {0x0B4A, 17, block0x0B4A},
+            {0x0B4D, 27, block0x0B4D},
+            {0x0B54, 17, block0x0B54},
+            {0x0B57, 30, block0x0B57},
+            {0x0B5D, 17, block0x0B5D},
+            {0x0B60, 17, block0x0B60},
+            {0x0B63, 17, block0x0B63},
+            {0x0B66, 17, block0x0B66},
+            {0x0B69, 37, block0x0B69},
+            {0x0B71, 17, block0x0B71},
+            {0x0B74, 17, block0x0B74},
+            {0x0B77, 27, block0x0B77},
+            {0x0B7C, 10, block0x0B7C},
+            {0x0B7F, 17, block0x0B7F},
+            {0x0B83, 17, block0x0B83},
+            {0x0B86, 10, block0x0B86},
+            {0x0B89, 34, block0x0B89},
+            {0x0B90, 17, block0x0B90},
+            {0x0B93, 44, block0x0B93},
+            {0x0B9E, 30, block0x0B9E},
+            {0x0BA6, 34, block0x0BA6},
+            {0x0BAE, 27, block0x0BAE},
+            {0x0BB4, 17, block0x0BB4},
+            {0x0BB7, 24, block0x0BB7},
+            {0x0BBD, 27, block0x0BBD},
+            {0x0BC3, 17, block0x0BC3},
+            {0x0BC6, 30, block0x0BC6},
+            {0x0BCE, 27, block0x0BCE},
+            {0x0BD4, 17, block0x0BD4},
+            {0x0BD7, 17, block0x0BD7},
+            {0x0BDA, 53, block0x0BDA},
+            {0x0BE5, 10, block0x0BE5},
+            {0x0BE8, 27, block0x0BE8},
+            {0x0BEE, 10, block0x0BEE},
+            {0x0BF1, 17, block0x0BF1},
+            {0x0BF4, 10, block0x0BF4},
+            {0x1424, 17, block0x1424},
+            {0x1427, 105, block0x1427},
+            {0x1438, 10, block0x1438},
+            {0x1439, 75, block0x1439},
+            {0x1446, 10, block0x1446},
+            {0x1474, 32, block0x1474},
+            {0x147C, 22, block0x147C},
+            {0x147E, 39, block0x147E},
+            {0x1486, 55, block0x1486},
+            {0x1490, 10, block0x1490},
+            {0x14CB, 4, block0x14CB},
+            {0x14CC, 63, block0x14CC},
+            {0x14D7, 10, block0x14D7},
+            {0x14D8, 31, block0x14D8},
+            {0x14DE, 18, block0x14DE},
+            {0x14E1, 35, block0x14E1},
+            {0x14EA, 28, block0x14EA},
+            {0x14EF, 22, block0x14EF},
+            {0x14F5, 42, block0x14F5},
+            {0x1500, 14, block0x1500},
+            {0x1504, 22, block0x1504},
+            {0x1508, 35, block0x1508},
+            {0x150F, 53, block0x150F},
+            {0x151A, 21, block0x151A},
+            {0x151F, 27, block0x151F},
+            {0x1524, 17, block0x1524},
+            {0x1527, 17, block0x1527},
+            {0x152A, 30, block0x152A},
+            {0x1530, 30, block0x1530},
+            {0x1538, 31, block0x1538},
+            {0x153D, 40, block0x153D},
+            {0x1545, 20, block0x1545},
+            {0x154A, 34, block0x154A},
+            {0x1554, 28, block0x1554},
+            {0x155A, 15, block0x155A},
+            {0x155C, 22, block0x155C},
+            {0x1562, 35, block0x1562},
+            {0x1569, 32, block0x1569},
+            {0x156F, 30, block0x156F},
+            {0x1575, 22, block0x1575},
+            {0x1579, 30, block0x1579},
+            {0x1581, 71, block0x1581},
+            {0x1590, 22, block0x1590},
+            {0x1596, 10, block0x1596},
+            {0x1597, 27, block0x1597},
+            {0x159E, 27, block0x159E},
+            {0x15A4, 11, block0x15A4},
+            {0x15A5, 14, block0x15A5},
+            {0x15A9, 67, block0x15A9},
+            {0x15B7, 27, block0x15B7},
+            {0x15BD, 11, block0x15BD},
+            {0x15BE, 17, block0x15BE},
+            {0x15C1, 14, block0x15C1},
+            {0x15C5, 7, block0x15C5},
+            {0x15C7, 21, block0x15C7},
+            {0x15CC, 20, block0x15CC},
+            {0x15D1, 10, block0x15D1},
+            {0x15D3, 17, block0x15D3},
+            {0x15D6, 11, block0x15D6},
+            {0x15D7, 152, block0x15D7},
+            {0x15F1, 20, block0x15F1},
+            {0x15F3, 17, block0x15F3},
+            {0x15F6, 10, block0x15F6},
+            {0x15F9, 21, block0x15F9},
+            {0x15FE, 5, block0x15FE},
+            {0x15FF, 20, block0x15FF},
+            {0x1604, 36, block0x1604},
+            {0x160B, 30, block0x160B},
+            {0x1611, 35, block0x1611},
+            {0x1618, 31, block0x1618},
+            {0x161E, 44, block0x161E},
+            {0x1626, 28, block0x1626},
+            {0x162B, 27, block0x162B},
+            {0x1632, 27, block0x1632},
+            {0x1639, 17, block0x1639},
+            {0x163C, 18, block0x163C},
+            {0x163F, 43, block0x163F},
+            {0x1648, 17, block0x1648},
+            {0x164B, 18, block0x164B},
+            {0x164E, 23, block0x164E},
+            {0x1652, 63, block0x1652},
+            {0x1661, 7, block0x1661},
+            {0x1663, 46, block0x1663},
+            {0x166B, 14, block0x166B},
+            {0x1671, 17, block0x1671},
+            {0x1674, 27, block0x1674},
+            {0x1679, 56, block0x1679},
+            {0x1685, 10, block0x1685},
+            {0x1688, 10, block0x1688},
+            {0x168B, 17, block0x168B},
+            {0x168F, 55, block0x168F},
+            {0x1698, 27, block0x1698},
+            {0x169F, 44, block0x169F},
+            {0x16AA, 44, block0x16AA},
+            {0x16B5, 7, block0x16B5},
+            {0x16B7, 22, block0x16B7},
+            {0x16BB, 17, block0x16BB},
+            {0x16BE, 17, block0x16BE},
+            {0x16C1, 21, block0x16C1},
+            {0x16C6, 10, block0x16C6},
+            {0x16C9, 44, block0x16C9},
+            {0x16D4, 17, block0x16D4},
+            {0x16D7, 17, block0x16D7},
+            {0x16DA, 44, block0x16DA},
+            {0x16E3, 10, block0x16E3},
+            {0x16E6, 31, block0x16E6},
+            {0x16EE, 17, block0x16EE},
+            {0x16F1, 24, block0x16F1},
+            {0x16F6, 17, block0x16F6},
+            {0x16F9, 10, block0x16F9},
+            {0x16FC, 17, block0x16FC},
+            {0x16FF, 27, block0x16FF},
+            {0x1705, 21, block0x1705},
+            {0x1709, 17, block0x1709},
+            {0x170E, 17, block0x170E},
+            {0x1711, 44, block0x1711},
+            {0x171C, 21, block0x171C},
+            {0x1721, 25, block0x1721},
+            {0x1727, 30, block0x1727},
+            {0x172C, 30, block0x172C},
+            {0x1734, 17, block0x1734},
+            {0x1739, 17, block0x1739},
+            {0x1740, 37, block0x1740},
+            {0x1747, 27, block0x1747},
+            {0x174E, 31, block0x174E},
+            {0x1753, 54, block0x1753},
+            {0x1760, 69, block0x1760},
+            {0x176D, 40, block0x176D},
+            {0x1775, 27, block0x1775},
+            {0x177C, 33, block0x177C},
+            {0x1785, 17, block0x1785},
+            {0x1789, 20, block0x1789},
+            {0x178E, 84, block0x178E},
+            {0x17A2, 7, block0x17A2},
+            {0x17A4, 28, block0x17A4},
+            {0x17AA, 31, block0x17AA},
+            {0x17AF, 17, block0x17AF},
+            {0x17C0, 27, block0x17C0},
+            {0x17C7, 20, block0x17C7},
+            {0x17CA, 20, block0x17CA},
+            {0x17CD, 28, block0x17CD},
+            {0x17D2, 28, block0x17D2},
+            {0x17D7, 17, block0x17D7},
+            {0x17DC, 17, block0x17DC},
+            {0x17DF, 15, block0x17DF},
+            {0x17E3, 37, block0x17E3},
+            {0x17EB, 48, block0x17EB},
+            {0x17F7, 17, block0x17F7},
+            {0x17FA, 40, block0x17FA},
+            {0x1804, 31, block0x1804},
+            {0x180C, 27, block0x180C},
+            {0x1810, 17, block0x1810},
+            {0x1815, 44, block0x1815},
+            {0x1820, 30, block0x1820},
+            {0x1828, 17, block0x1828},
+            {0x182B, 10, block0x182B},
+            {0x182E, 17, block0x182E},
+            {0x1831, 10, block0x1831},
+            {0x1837, 10, block0x1837},
+            {0x183A, 17, block0x183A},
+            {0x183D, 11, block0x183D},
+            {0x183E, 17, block0x183E},
+            {0x1841, 10, block0x1841},
+            {0x1844, 35, block0x1844},
+            {0x184A, 20, block0x184A},
+            {0x184C, 46, block0x184C},
+            {0x1854, 20, block0x1854},
+            {0x1856, 29, block0x1856},
+            {0x185B, 75, block0x185B},
+            {0x1868, 49, block0x1868},
+            {0x1871, 32, block0x1871},
+            {0x1879, 46, block0x1879},
+            {0x1884, 20, block0x1884},
+            {0x1888, 43, block0x1888},
+            {0x1891, 14, block0x1891},
+            {0x1898, 30, block0x1898},
+            {0x189E, 44, block0x189E},
+            {0x18A9, 60, block0x18A9},
+            {0x18B8, 30, block0x18B8},
+            {0x18C0, 30, block0x18C0},
+            {0x18C8, 38, block0x18C8},
+            {0x18D1, 10, block0x18D1},
+            {0x18D4, 34, block0x18D4},
+            {0x18DC, 17, block0x18DC},
+            {0x18DF, 30, block0x18DF},
+            {0x18E7, 38, block0x18E7},
+            {0x18EF, 15, block0x18EF},
+            {0x18F1, 36, block0x18F1},
+            {0x18F8, 15, block0x18F8},
+            {0x18FA, 50, block0x18FA},
+            {0x1904, 20, block0x1904},
+            {0x190A, 17, block0x190A},
+            {0x190D, 10, block0x190D},
+            {0x1910, 38, block0x1910},
+            {0x1918, 15, block0x1918},
+            {0x191A, 37, block0x191A},
+            {0x1925, 20, block0x1925},
+            {0x192B, 20, block0x192B},
+            {0x1931, 58, block0x1931},
+            {0x193C, 37, block0x193C},
+            {0x1947, 33, block0x1947},
+            {0x1950, 20, block0x1950},
+            {0x1956, 17, block0x1956},
+            {0x1959, 17, block0x1959},
+            {0x195C, 17, block0x195C},
+            {0x195F, 17, block0x195F},
+            {0x1962, 17, block0x1962},
+            {0x1965, 17, block0x1965},
+            {0x1968, 10, block0x1968},
+            {0x196B, 17, block0x196B},
+            {0x196E, 10, block0x196E},
+            {0x1971, 30, block0x1971},
+            {0x1979, 17, block0x1979},
+            {0x197C, 17, block0x197C},
+            {0x197F, 10, block0x197F},
+            {0x1982, 23, block0x1982},
+            {0x1988, 10, block0x1988},
+            {0x199A, 27, block0x199A},
+            {0x19A1, 35, block0x19A1},
+            {0x19A8, 18, block0x19A8},
+            {0x19AC, 35, block0x19AC},
+            {0x19B3, 37, block0x19B3},
+            {0x19D1, 7, block0x19D1},
+            {0x19D3, 23, block0x19D3},
+            {0x19D7, 14, block0x19D7},
+            {0x19DC, 50, block0x19DC},
+            {0x19E6, 20, block0x19E6},
+            {0x19EC, 39, block0x19EC},
+            {0x19F5, 20, block0x19F5},
+            {0x19FA, 24, block0x19FA},
+            {0x19FF, 22, block0x19FF},
+            {0x1A05, 10, block0x1A05},
+            {0x1A32, 39, block0x1A32},
+            {0x1A3A, 10, block0x1A3A},
+            {0x1A3B, 75, block0x1A3B},
+            {0x1A47, 18, block0x1A47},
+            {0x1A4A, 43, block0x1A4A},
+            {0x1A54, 44, block0x1A54},
+            {0x1A5C, 10, block0x1A5C},
+            {0x1A5F, 37, block0x1A5F},
+            {0x1A68, 10, block0x1A68},
+            {0x1A69, 22, block0x1A69},
+            {0x1A6B, 46, block0x1A6B},
+            {0x1A74, 55, block0x1A74},
+            {0x1A7E, 10, block0x1A7E},
+            {0x1A7F, 17, block0x1A7F},
+            {0x1A82, 15, block0x1A82},
+            {0x1A84, 40, block0x1A84},
+            {0x1A8A, 10, block0x1A8A},
+            {0x1A8B, 27, block0x1A8B}
+        };
+    }
+
+    const RecompiledCpu::Program spaceInvadersProgram =
+    {
+        0xA02B653391170906, 8192, blocks, sizeof(blocks) / sizeof(blocks[0])
+    };
+} // namespace emulator
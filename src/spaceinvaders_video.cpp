@@ -4,143 +4,330 @@
 #include "memory.hpp"
 
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <array>
+#include <cstring>
 
 namespace emulator
 {
-    SpaceInvadersVideo::SpaceInvadersVideo(sf::RenderWindow& window_, Memory& memory_): 
-        window(window_), memory(memory_)
+    namespace
     {
-        texture.create(crtWidth, crtHeight);
-        texture.setSmooth(false);
+        // The masks of the 8 pixels encoded by every byte, as 8 bytes in memory of which those of the pixels
+        // that are on have all bits set. The lowest bit of a byte is the first pixel, the first byte of its mask.
+        const std::array<std::uint64_t, 256> pixelMasks = []()
+        {
+            std::array<std::uint64_t, 256> masks{};
 
-        sprite.setTexture(texture);
+            for (std::size_t value = 0; value < masks.size(); ++value)
+            {
+                byte bytes[8];
+                for (std::size_t bit = 0; bit < 8; ++bit)
+                    bytes[bit] = ((value >> bit) & 1) != 0 ? 0xFF : 0;
 
-        sprite.setPosition(50, 50 + scalingFactor * crtWidth);
-        sprite.setScale(sf::Vector2f(scalingFactor, scalingFactor));
+                std::memcpy(&masks[value], bytes, sizeof(bytes));
+            }
 
-        // The CRT in the Space Invaders cabinet was rotated 90 degrees counter-clockwise.
-        sprite.setRotation(-90.f);
+            return masks;
+        }();
 
-        // The SFML texture by default takes data buffer with RGBA pixels.
-        videoData = std::make_unique<byte[]>(static_cast<std::size_t>(4 * crtWidth * crtHeight));
+        // Transposes the 8x8 matrix of bits in which byte i holds row i, such that byte i of the result
+        // holds bit i of every row (bit j being bit i of row j). See Hacker's Delight, section 7-3.
+        std::uint64_t transposeBits(std::uint64_t x)
+        {
+            std::uint64_t t = (x ^ (x >> 7)) & 0x00AA00AA00AA00AA;
+            x ^= t ^ (t << 7);
+            t = (x ^ (x >> 14)) & 0x0000CCCC0000CCCC;
+            x ^= t ^ (t << 14);
+            t = (x ^ (x >> 28)) & 0x00000000F0F0F0F0;
+            x ^= t ^ (t << 28);
+            return x;
+        }
 
-        outline.setOutlineColor(sf::Color::White);
-        outline.setOutlineThickness(1.0f);
-        outline.setPosition(sf::Vector2f(49, 49));
-        outline.setSize(sf::Vector2f(scalingFactor * crtHeight + 2, scalingFactor * crtWidth + 2));
-    }
+        // The pixel of the texture data with the given color.
+        std::uint32_t toPixel(sf::Color color)
+        {
+            const byte bytes[4] = {color.r, color.g, color.b, color.a};
 
-    void SpaceInvadersVideo::update(unsigned short x, unsigned short y, 
-        unsigned short width, unsigned short height,
-        sf::Color foregroundColor, sf::Color backgroundColor)
+            std::uint32_t pixel;
+            std::memcpy(&pixel, bytes, sizeof(pixel));
+            return pixel;
+        }
+    } // namespace
+
+    SpaceInvadersVideo::SpaceInvadersVideo(sf::RenderWindow& window_, Memory& memory_, Upscaler::Filter filter):
+        window(window_), palette{toPixel(sf::Color::Black), toPixel(sf::Color::White), toPixel(sf::Color::Red),
+            toPixel(sf::Color::Green)},
+        upscaler(frameWidth, frameHeight, scalingFactor, filter, palette.data(), palette.size()),
+        frames(std::vector<byte>(static_cast<std::size_t>(frameWidth * frameHeight), Black)),
+        drawnFrame(static_cast<std::size_t>(frameWidth * frameHeight), Black), memory(memory_)
     {
-        if (x < 0 || (x + width) > crtWidth || y < 0 || (y + height) > crtHeight)
-            throw EmulatorException("Invalid update rectangle specified in SpaceInvadersVideo::update.");
+        // The frame is already rotated, like the CRT in the Space Invaders cabinet, and scaled.
+        texture.create(optimalWindowWidth, optimalWindowHeight);
+        texture.setSmooth(false);
 
-        for (unsigned short j = 0; j < height; ++j)
-        {
-            unsigned short pixelY = y + j;
+        sprite.setTexture(texture);
 
-            for (unsigned short i = 0; i < width; ++i)
-            {
-                unsigned short pixelX = x + i;                
-                unsigned short pixelNumber = pixelY * crtWidth + pixelX;
+        frame = std::make_unique<byte[]>(static_cast<std::size_t>(frameWidth * frameHeight));
 
-                // Each byte encodes 8 pixels.
-                word address = videoBufferAddress + (pixelNumber / 8);
-                byte bitNumber = pixelNumber % 8;
+        overlay.resize(static_cast<std::size_t>(bytesPerRow * crtHeight));
+        buildOverlay();
 
-                byte value = memory.get(address);
-                bool pixelEnabled = (value >> (bitNumber)) & 1;
+        latchedBuffer.resize(videoBufferSize);
 
-                sf::Color color = pixelEnabled ? foregroundColor : backgroundColor;
+        drawBorder();
 
-                unsigned int index = 4 * pixelNumber;
-                
-                videoData[index] = color.r;
-                videoData[index + 1] = color.g;
-                videoData[index + 2] = color.b;
-                videoData[index + 3] = color.a;
-            }
+        // Every row is translated once, after which only written rows are. The texture starts out black,
+        // like drawnFrame.
+        dirtyRows.set();
+
+        memory.addWatcher(this);
+
+        for (std::size_t page = videoBufferAddress / Memory::pageSize;
+            page < (videoBufferAddress + videoBufferSize) / Memory::pageSize; ++page)
+        {
+            memory.watchPage(page);
         }
+    }
 
-        textureUpdateRequired = true;
+    SpaceInvadersVideo::~SpaceInvadersVideo()
+    {
+        for (std::size_t page = videoBufferAddress / Memory::pageSize;
+            page < (videoBufferAddress + videoBufferSize) / Memory::pageSize; ++page)
+        {
+            memory.unwatchPage(page);
+        }
+
+        memory.removeWatcher(this);
     }
 
-    void SpaceInvadersVideo::updateTopHalf()
+    void SpaceInvadersVideo::setOverlay(unsigned short x, unsigned short y,
+        unsigned short width, unsigned short height, PaletteIndex color)
+    {
+        if ((x + width) > crtWidth || (y + height) > crtHeight || x % 8 != 0 || width % 8 != 0)
+            throw EmulatorException("Invalid overlay rectangle specified in SpaceInvadersVideo::setOverlay.");
+
+        for (unsigned short pixelY = y; pixelY < y + height; ++pixelY)
+        {
+            for (unsigned short pixelX = x; pixelX < x + width; pixelX += 8)
+                overlay[(pixelX / 8) * crtHeight + pixelY] = color;
+        }
+    }
+
+    void SpaceInvadersVideo::buildOverlay()
     {
-        // Update the top half of the CRT (that is, top half before rotation).
-        // We update the various colored regions of the CRT separately.
         // Keep in mind that the CRT is rotated 90 degrees counter-clockwise. Hence, the x coordinate
         // measures the height of an element on the screen.
 
+        // The bottom of the screen, which is white but for the green region between the bases.
         unsigned short x = 0, y = 0;
 
-        update(x, y, bottomWhiteRegionHeight, bottomWhiteRegionWidth1, 
-            sf::Color::White, sf::Color::Black);
+        setOverlay(x, y, bottomWhiteRegionHeight, bottomWhiteRegionWidth1, White);
 
         y += bottomWhiteRegionWidth1;
 
-        update(x, y, bottomWhiteRegionHeight, bottomGreenRegionWidth, 
-            sf::Color::Green, sf::Color::Black);
+        setOverlay(x, y, bottomWhiteRegionHeight, bottomGreenRegionWidth, Green);
 
         y += bottomGreenRegionWidth;
 
-        update(x, y, bottomWhiteRegionHeight, crtHeight / 2 - y, 
-            sf::Color::Green, sf::Color::Black);
+        setOverlay(x, y, bottomWhiteRegionHeight, crtHeight / 2 - y, Green);
 
+        y = crtHeight / 2;
+
+        setOverlay(x, y, bottomWhiteRegionHeight, crtHeight / 2, White);
+
+        // The regions above it span the whole width of the screen.
         y = 0;
         x += bottomWhiteRegionHeight;
 
-        updateCommonPart(x, y);
+        setOverlay(x, y, greenRegionHeight1, crtHeight, Green);
+
+        x += greenRegionHeight1;
+
+        setOverlay(x, y, middleWhiteRegionHeight, crtHeight, White);
+
+        x += middleWhiteRegionHeight;
+
+        setOverlay(x, y, redRegionHeight, crtHeight, Red);
+
+        x += redRegionHeight;
+
+        setOverlay(x, y, topWhiteRegionHeight, crtHeight, White);
     }
 
-    void SpaceInvadersVideo::updateBottomHalf()
+    void SpaceInvadersVideo::drawBorder()
     {
-        // Update the various colored regions of the CRT separately.
-        // Keep in mind that the CRT is rotated 90 degrees counter-clockwise. Hence, the x coordinate
-        // measures the height of an element on the screen.
+        std::vector<std::uint32_t> pixels(static_cast<std::size_t>(optimalWindowWidth * optimalWindowHeight),
+            palette[Black]);
 
-        unsigned short x = 0, y = crtHeight / 2;
+        unsigned short left = frameOffset - borderWidth, top = frameOffset - borderWidth;
+        unsigned short right = frameOffset + scalingFactor * frameWidth + borderWidth;
+        unsigned short bottom = frameOffset + scalingFactor * frameHeight + borderWidth;
 
-        update(x, y, bottomWhiteRegionHeight, crtHeight / 2, 
-            sf::Color::White, sf::Color::Black);
+        for (unsigned short y = top; y < bottom; ++y)
+        {
+            for (unsigned short x = left; x < right; ++x)
+            {
+                bool inside = x >= left + borderWidth && x < right - borderWidth &&
+                    y >= top + borderWidth && y < bottom - borderWidth;
 
-        x += bottomWhiteRegionHeight;
+                if (!inside)
+                    pixels[y * optimalWindowWidth + x] = palette[White];
+            }
+        }
+
+        texture.update(reinterpret_cast<const sf::Uint8*>(pixels.data()), optimalWindowWidth, optimalWindowHeight, 0, 0);
+    }
+
+    void SpaceInvadersVideo::updateRows(unsigned short first, unsigned short count)
+    {
+        for (unsigned short row = first; row < first + count; ++row)
+            latchRow(row);
 
-        updateCommonPart(x, y);
+        for (unsigned short blockRow = first; blockRow < first + count; blockRow += 8)
+            translateBlock(blockRow);
     }
 
-    void SpaceInvadersVideo::draw()
+    void SpaceInvadersVideo::latchRow(unsigned short row)
     {
-        if (textureUpdateRequired)
+        if (!dirtyRows[row])
+            return;
+
+        std::size_t index = row * bytesPerRow;
+        for (std::size_t i = index; i < index + bytesPerRow; ++i)
+            latchedBuffer[i] = memory.get<false>(videoBufferAddress + i);
+
+        dirtyRows.reset(row);
+        latchedRows.set(row);
+    }
+
+    void SpaceInvadersVideo::translateBlock(unsigned short blockRow)
+    {
+        bool latched = false;
+        for (unsigned short row = blockRow; row < blockRow + 8; ++row)
+            latched |= latchedRows[row];
+
+        if (!latched)
+            return;
+
+        // Row y of the block becomes column blockRow + y of the frame, the pixel x of a row
+        // becomes row (frameHeight - 1 - x) of the frame.
+        for (unsigned short column = 0; column < bytesPerRow; ++column)
         {
-            texture.update(videoData.get());
-            textureUpdateRequired = false;
+            std::uint64_t bits = 0;
+            std::uint64_t overlayColors;
+
+            for (unsigned short y = 0; y < 8; ++y)
+                bits |= static_cast<std::uint64_t>(latchedBuffer[(blockRow + y) * bytesPerRow + column]) << (8 * y);
+
+            // The colors are in the same order in memory as the pixels in the frame and their masks.
+            // The masks clear the pixels that are off to index 0.
+            static_assert(Black == 0, "The background has to be the first color of the palette.");
+            std::memcpy(&overlayColors, &overlay[column * crtHeight + blockRow], sizeof(overlayColors));
+
+            bits = transposeBits(bits);
+
+            for (unsigned short x = 0; x < 8; ++x)
+            {
+                std::uint64_t pixels = overlayColors & pixelMasks[(bits >> (8 * x)) & 0xFF];
+                std::memcpy(frame.get() + (frameHeight - 1 - (8 * column + x)) * frameWidth + blockRow,
+                    &pixels, sizeof(pixels));
+            }
         }
-        
-        window.draw(outline);
-        window.draw(sprite);
+
+        for (unsigned short row = blockRow; row < blockRow + 8; ++row)
+            latchedRows.reset(row);
     }
 
-    void SpaceInvadersVideo::updateCommonPart(unsigned short x, unsigned short y)
+    void SpaceInvadersVideo::updateTopHalf()
     {
-        update(x, y, greenRegionHeight1, crtHeight / 2, 
-            sf::Color::Green, sf::Color::Black);
+        // Update the top half of the CRT (that is, top half before rotation).
+        updateRows(0, crtHeight / 2);
+    }
 
-        x += greenRegionHeight1;
+    void SpaceInvadersVideo::updateBottomHalf()
+    {
+        updateRows(crtHeight / 2, crtHeight / 2);
+    }
 
-        update(x, y, middleWhiteRegionHeight, crtHeight / 2, 
-            sf::Color::White, sf::Color::Black);
+    void SpaceInvadersVideo::updateScanline(unsigned short scanline)
+    {
+        if (scanline >= crtHeight)
+            return;
 
-        x += middleWhiteRegionHeight;
+        latchRow(scanline);
 
-        update(x, y, redRegionHeight, crtHeight / 2, 
-            sf::Color::Red, sf::Color::Black);      
+        if (scanline % 8 == 7)
+            translateBlock(scanline - 7);
+    }
 
-        x += redRegionHeight;
-        
-        update(x, y, topWhiteRegionHeight, crtHeight / 2, 
-            sf::Color::White, sf::Color::Black);  
+    void SpaceInvadersVideo::publishFrame()
+    {
+        std::vector<byte>& buffer = frames.getBackBuffer();
+        std::copy(frame.get(), frame.get() + buffer.size(), buffer.begin());
+        frames.publish();
+    }
+
+    bool SpaceInvadersVideo::draw()
+    {
+        if (!frames.update())
+            return false;
+
+        const std::vector<byte>& newFrame = frames.getFrontBuffer();
+
+        // The scaled pixels are only needed for drawing.
+        if (!uploadData)
+        {
+            uploadData = std::make_unique<std::uint32_t[]>(
+                static_cast<std::size_t>(frameWidth * frameHeight) * scalingFactor * scalingFactor);
+        }
+
+        std::bitset<frameWidth> columns;
+        for (std::size_t i = 0; i < newFrame.size(); ++i)
+        {
+            if (newFrame[i] != drawnFrame[i])
+                columns.set(i % frameWidth);
+        }
+
+        // The scaled pixels of a column may also depend on the columns next to it.
+        for (unsigned short i = 0; i < upscaler.getReach(); ++i)
+            columns |= (columns << 1) | (columns >> 1);
+
+        // Scale and upload every run of consecutive changed columns as one rectangle.
+        for (unsigned short first = 0; first < frameWidth && columns.any(); ++first)
+        {
+            if (!columns[first])
+                continue;
+
+            unsigned short end = first + 1;
+            while (end < frameWidth && columns[end])
+                ++end;
+
+            unsigned short width = (end - first) * scalingFactor;
+            upscaler.scale(newFrame.data(), first, end, uploadData.get(), width);
+
+            texture.update(reinterpret_cast<const sf::Uint8*>(uploadData.get()), width, frameHeight * scalingFactor,
+                frameOffset + first * scalingFactor, frameOffset);
+
+            for (; first < end; ++first)
+                columns.reset(first);
+        }
+
+        drawnFrame = newFrame;
+
+        window.draw(sprite);
+        return true;
+    }
+
+    void SpaceInvadersVideo::onMemoryWritten(std::size_t address, std::size_t size)
+    {
+        // Writes are also reported at the addresses of the mirrors of video memory, which are ignored.
+        std::size_t first = std::max<std::size_t>(address, videoBufferAddress);
+        std::size_t end = std::min<std::size_t>(address + size, videoBufferAddress + videoBufferSize);
+
+        for (std::size_t row = (first - videoBufferAddress) / bytesPerRow;
+            first < end && row <= (end - 1 - videoBufferAddress) / bytesPerRow; ++row)
+        {
+            dirtyRows.set(row);
+        }
     }
 } // namespace emulator
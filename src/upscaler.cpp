@@ -0,0 +1,268 @@
+#include "upscaler.hpp"
+
+#include "defines.hpp"
+#include "emulator_exception.hpp"
+
+#include <cstring>
+
+#if EMULATOR_SSSE3_SUPPORTED
+    #include <tmmintrin.h>
+
+    #if defined(_MSC_VER)
+        #include <intrin.h>
+    #endif
+#endif
+
+namespace emulator
+{
+    namespace
+    {
+        // The color at half the intensity, with the same alpha.
+        std::uint32_t dim(std::uint32_t color)
+        {
+            byte bytes[4];
+            std::memcpy(bytes, &color, sizeof(bytes));
+
+            for (std::size_t i = 0; i < 3; ++i)
+                bytes[i] /= 2;
+
+            std::memcpy(&color, bytes, sizeof(color));
+            return color;
+        }
+
+        #if EMULATOR_SSSE3_SUPPORTED
+            bool isSsse3Supported()
+            {
+                #if defined(_MSC_VER)
+                    int info[4];
+                    __cpuid(info, 1);
+                    return (info[2] & (1 << 9)) != 0;
+                #else
+                    return __builtin_cpu_supports("ssse3");
+                #endif
+            }
+
+            // Writes the colors of count indices into pixels, 16 at a time. Returns the number of pixels written,
+            // the remaining indices are fewer than 16. Every index has to be less than 16.
+            #if defined(__GNUC__)
+                __attribute__((target("ssse3")))
+            #endif
+            std::size_t expandShuffled(const std::array<std::array<byte, 16>, 4>& colorBytes, const byte* indices,
+                std::size_t count, std::uint32_t* pixels)
+            {
+                const __m128i red = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colorBytes[0].data()));
+                const __m128i green = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colorBytes[1].data()));
+                const __m128i blue = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colorBytes[2].data()));
+                const __m128i alpha = _mm_loadu_si128(reinterpret_cast<const __m128i*>(colorBytes[3].data()));
+
+                std::size_t i = 0;
+
+                for (; i + 16 <= count; i += 16)
+                {
+                    // Looks up every byte of the colors of the 16 indices, then interleaves the bytes into pixels.
+                    __m128i bytes = _mm_loadu_si128(reinterpret_cast<const __m128i*>(indices + i));
+
+                    __m128i reds = _mm_shuffle_epi8(red, bytes);
+                    __m128i greens = _mm_shuffle_epi8(green, bytes);
+                    __m128i blues = _mm_shuffle_epi8(blue, bytes);
+                    __m128i alphas = _mm_shuffle_epi8(alpha, bytes);
+
+                    __m128i redGreen = _mm_unpacklo_epi8(reds, greens);
+                    __m128i redGreenHigh = _mm_unpackhi_epi8(reds, greens);
+                    __m128i blueAlpha = _mm_unpacklo_epi8(blues, alphas);
+                    __m128i blueAlphaHigh = _mm_unpackhi_epi8(blues, alphas);
+
+                    __m128i* output = reinterpret_cast<__m128i*>(pixels + i);
+                    _mm_storeu_si128(output, _mm_unpacklo_epi16(redGreen, blueAlpha));
+                    _mm_storeu_si128(output + 1, _mm_unpackhi_epi16(redGreen, blueAlpha));
+                    _mm_storeu_si128(output + 2, _mm_unpacklo_epi16(redGreenHigh, blueAlphaHigh));
+                    _mm_storeu_si128(output + 3, _mm_unpackhi_epi16(redGreenHigh, blueAlphaHigh));
+                }
+
+                return i;
+            }
+        #endif
+    } // namespace
+
+    Upscaler::Upscaler(unsigned short width_, unsigned short height_, unsigned short factor_, Filter filter_,
+        const std::uint32_t* palette, std::size_t paletteSize): width(width_), height(height_), factor(factor_),
+        filter(filter_), colors(palette, palette + paletteSize)
+    {
+        if (factor == 0)
+            throw EmulatorException("The factor of the upscaler is 0 in Upscaler::Upscaler.");
+
+        if (filter == Filter::ScaleNx && factor != 2 && factor != 3)
+            throw EmulatorException("ScaleNx requires a factor of 2 or 3 in Upscaler::Upscaler.");
+
+        // The dimmed colors follow the colors, at indices which still have to fit in a byte.
+        std::size_t maxPaletteSize = filter == Filter::Scanlines ? 128 : 256;
+        if (paletteSize == 0 || paletteSize > maxPaletteSize)
+            throw EmulatorException("Invalid palette size specified in Upscaler::Upscaler.");
+
+        if (filter == Filter::Scanlines)
+        {
+            for (std::size_t i = 0; i < paletteSize; ++i)
+                colors.push_back(dim(palette[i]));
+        }
+
+        scaledRows.resize(static_cast<std::size_t>(width) * factor * factor);
+
+        #if EMULATOR_SSSE3_SUPPORTED
+            shuffle = colors.size() <= maxShufflePaletteSize && isSsse3Supported();
+        #endif
+
+        for (std::size_t color = 0; shuffle && color < colors.size(); ++color)
+        {
+            byte bytes[4];
+            std::memcpy(bytes, &colors[color], sizeof(bytes));
+
+            for (std::size_t i = 0; i < colorBytes.size(); ++i)
+                colorBytes[i][color] = bytes[i];
+        }
+    }
+
+    void Upscaler::scale(const byte* frame, unsigned short first, unsigned short end, std::uint32_t* output,
+        std::size_t pitch)
+    {
+        if (first > end || end > width)
+            throw EmulatorException("Invalid columns specified in Upscaler::scale.");
+
+        std::size_t rowLength = static_cast<std::size_t>(end - first) * factor;
+
+        for (unsigned short y = 0; y < height; ++y)
+        {
+            if (filter != Filter::ScaleNx)
+                scaleNearest(frame, y, first, end);
+            else if (factor == 2)
+                scale2x(frame, y, first, end);
+            else
+                scale3x(frame, y, first, end);
+
+            for (unsigned short i = 0; i < factor; ++i)
+            {
+                std::uint32_t* pixels = output + (static_cast<std::size_t>(y) * factor + i) * pitch;
+
+                // The rows of Nearest and Scanlines are all the same, hence only the first is expanded.
+                if (i == 0 || filter == Filter::ScaleNx)
+                    expand(scaledRows.data() + i * rowLength, rowLength, pixels);
+                else
+                    std::memcpy(pixels, pixels - pitch, rowLength * sizeof(std::uint32_t));
+            }
+        }
+    }
+
+    void Upscaler::scaleNearest(const byte* frame, unsigned short y, unsigned short first, unsigned short end)
+    {
+        const byte* row = frame + static_cast<std::size_t>(y) * width;
+        byte* indices = scaledRows.data();
+        byte dimmed = static_cast<byte>(colors.size() / 2);
+
+        for (unsigned short x = first; x < end; ++x)
+        {
+            std::memset(indices, row[x], factor);
+
+            if (filter == Filter::Scanlines)
+                indices[factor - 1] = row[x] + dimmed;
+
+            indices += factor;
+        }
+    }
+
+    void Upscaler::scale2x(const byte* frame, unsigned short y, unsigned short first, unsigned short end)
+    {
+        // Pixels beyond the edges of the frame are taken to be those at the edges.
+        const byte* row = frame + static_cast<std::size_t>(y) * width;
+        const byte* above = y > 0 ? row - width : row;
+        const byte* below = y + 1 < height ? row + width : row;
+
+        std::size_t rowLength = static_cast<std::size_t>(end - first) * 2;
+        byte* top = scaledRows.data();
+        byte* bottom = top + rowLength;
+
+        for (unsigned short x = first; x < end; ++x)
+        {
+            //  . B .
+            //  D E F
+            //  . H .
+            unsigned short left = x > 0 ? x - 1 : x;
+            unsigned short right = x + 1 < width ? x + 1 : x;
+
+            byte b = above[x], d = row[left], e = row[x], f = row[right], h = below[x];
+
+            if (b != h && d != f)
+            {
+                *top++ = d == b ? d : e;
+                *top++ = b == f ? f : e;
+                *bottom++ = d == h ? d : e;
+                *bottom++ = h == f ? f : e;
+            }
+            else
+            {
+                top[0] = top[1] = e;
+                bottom[0] = bottom[1] = e;
+                top += 2;
+                bottom += 2;
+            }
+        }
+    }
+
+    void Upscaler::scale3x(const byte* frame, unsigned short y, unsigned short first, unsigned short end)
+    {
+        const byte* row = frame + static_cast<std::size_t>(y) * width;
+        const byte* above = y > 0 ? row - width : row;
+        const byte* below = y + 1 < height ? row + width : row;
+
+        std::size_t rowLength = static_cast<std::size_t>(end - first) * 3;
+        byte* top = scaledRows.data();
+        byte* middle = top + rowLength;
+        byte* bottom = middle + rowLength;
+
+        for (unsigned short x = first; x < end; ++x)
+        {
+            //  A B C
+            //  D E F
+            //  G H I
+            unsigned short left = x > 0 ? x - 1 : x;
+            unsigned short right = x + 1 < width ? x + 1 : x;
+
+            byte a = above[left], b = above[x], c = above[right];
+            byte d = row[left], e = row[x], f = row[right];
+            byte g = below[left], h = below[x], i = below[right];
+
+            if (b != h && d != f)
+            {
+                *top++ = d == b ? d : e;
+                *top++ = (d == b && e != c) || (b == f && e != a) ? b : e;
+                *top++ = b == f ? f : e;
+                *middle++ = (d == b && e != g) || (d == h && e != a) ? d : e;
+                *middle++ = e;
+                *middle++ = (b == f && e != i) || (h == f && e != c) ? f : e;
+                *bottom++ = d == h ? d : e;
+                *bottom++ = (d == h && e != i) || (h == f && e != g) ? h : e;
+                *bottom++ = h == f ? f : e;
+            }
+            else
+            {
+                std::memset(top, e, 3);
+                std::memset(middle, e, 3);
+                std::memset(bottom, e, 3);
+                top += 3;
+                middle += 3;
+                bottom += 3;
+            }
+        }
+    }
+
+    void Upscaler::expand(const byte* indices, std::size_t count, std::uint32_t* pixels) const
+    {
+        std::size_t i = 0;
+
+        #if EMULATOR_SSSE3_SUPPORTED
+            if (shuffle)
+                i = expandShuffled(colorBytes, indices, count, pixels);
+        #endif
+
+        for (; i < count; ++i)
+            pixels[i] = colors[indices[i]];
+    }
+} // namespace emulator
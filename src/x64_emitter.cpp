@@ -0,0 +1,545 @@
+#include "x64_emitter.hpp"
+
+#include "emulator_exception.hpp"
+
+#include <algorithm>
+
+#if defined(_WIN32)
+    #include <windows.h>
+#else
+    #include <sys/mman.h>
+    #include <unistd.h>
+#endif
+
+namespace emulator
+{
+    namespace x64
+    {
+        namespace
+        {
+            // Sets the protection of the size bytes at data, returns whether the system allowed it.
+            bool protect(byte* data, std::size_t size, bool executable)
+            {
+                #if defined(_WIN32)
+                    DWORD previousProtection = 0;
+                    if (!VirtualProtect(data, size, executable ? PAGE_EXECUTE_READ : PAGE_READWRITE, &previousProtection))
+                        return false;
+
+                    if (executable)
+                        FlushInstructionCache(GetCurrentProcess(), data, size);
+
+                    return true;
+                #else
+                    return mprotect(data, size, executable ? PROT_READ | PROT_EXEC : PROT_READ | PROT_WRITE) == 0;
+                #endif
+            }
+
+            void release(byte* data, std::size_t size)
+            {
+                #if defined(_WIN32)
+                    (void)size;
+                    VirtualFree(data, 0, MEM_RELEASE);
+                #else
+                    munmap(data, size);
+                #endif
+            }
+        } // namespace
+
+        CodeBuffer::CodeBuffer(std::size_t size_)
+        {
+            if (size_ == 0)
+                return;
+
+            #if defined(_WIN32)
+                void* memory = VirtualAlloc(nullptr, size_, MEM_COMMIT | MEM_RESERVE, PAGE_READWRITE);
+                if (memory == nullptr)
+                    return;
+            #else
+                void* memory = mmap(nullptr, size_, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+                if (memory == MAP_FAILED)
+                    return;
+            #endif
+
+            // A system which refuses executable memory does so when the protection is changed,
+            // hence it is tried once up front.
+            if (!protect(static_cast<byte*>(memory), size_, true) || !protect(static_cast<byte*>(memory), size_, false))
+            {
+                release(static_cast<byte*>(memory), size_);
+                return;
+            }
+
+            #if defined(_WIN32)
+                SYSTEM_INFO systemInfo{};
+                GetSystemInfo(&systemInfo);
+                pageSize = systemInfo.dwPageSize;
+            #else
+                pageSize = static_cast<std::size_t>(sysconf(_SC_PAGESIZE));
+            #endif
+
+            data = static_cast<byte*>(memory);
+            size = size_;
+        }
+
+        CodeBuffer::~CodeBuffer()
+        {
+            if (data != nullptr)
+                release(data, size);
+        }
+
+        void CodeBuffer::setExecutable(std::size_t offset, std::size_t length, bool executable)
+        {
+            if (data == nullptr || offset >= size)
+                return;
+
+            std::size_t begin = offset / pageSize * pageSize;
+            std::size_t end = std::min(offset + length, size);
+
+            if (!protect(data + begin, end - begin, executable))
+                throw EmulatorException("Unable to change the protection of the code in CodeBuffer::setExecutable.");
+        }
+
+        Emitter::Emitter(CodeBuffer& buffer_): buffer(buffer_)
+        {}
+
+        void Emitter::movzxByte(Register destination, const Address& source)
+        {
+            emitRex(false, destination, source);
+            emitByte(0x0F);
+            emitByte(0xB6);
+            emitOperand(destination, source);
+        }
+
+        void Emitter::movzxWord(Register destination, const Address& source)
+        {
+            emitRex(false, destination, source);
+            emitByte(0x0F);
+            emitByte(0xB7);
+            emitOperand(destination, source);
+        }
+
+        void Emitter::movByte(const Address& destination, Register source)
+        {
+            emitRex(false, source, destination);
+            emitByte(0x88);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::movByte(const Address& destination, byte value)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0xC6);
+            emitOperand(0, destination);
+            emitByte(value);
+        }
+
+        void Emitter::movWord(const Address& destination, Register source)
+        {
+            emitByte(0x66);
+            emitRex(false, source, destination);
+            emitByte(0x89);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::movWord(const Address& destination, word value)
+        {
+            emitByte(0x66);
+            emitRex(false, RAX, destination);
+            emitByte(0xC7);
+            emitOperand(0, destination);
+            emitWord(value);
+        }
+
+        void Emitter::movDouble(Register destination, Register source)
+        {
+            emitRex(false, source, destination);
+            emitByte(0x89);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::movDouble(Register destination, std::uint32_t value)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0xB8 + (destination & 7));
+            emitDouble(value);
+        }
+
+        void Emitter::movQuad(Register destination, Register source)
+        {
+            emitRex(true, source, destination);
+            emitByte(0x89);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::movQuad(Register destination, const Address& source)
+        {
+            emitRex(true, destination, source);
+            emitByte(0x8B);
+            emitOperand(destination, source);
+        }
+
+        void Emitter::movQuad(const Address& destination, Register source)
+        {
+            emitRex(true, source, destination);
+            emitByte(0x89);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::movQuad(Register destination, std::uint64_t value)
+        {
+            emitRex(true, RAX, destination);
+            emitByte(0xB8 + (destination & 7));
+            emitQuad(value);
+        }
+
+        void Emitter::byteOperation(Operation operation, Register destination, Register source)
+        {
+            emitRex(false, source, destination);
+            emitByte(static_cast<byte>(operation) << 3);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::byteOperation(Operation operation, Register destination, const Address& source)
+        {
+            emitRex(false, destination, source);
+            emitByte((static_cast<byte>(operation) << 3) | 0x02);
+            emitOperand(destination, source);
+        }
+
+        void Emitter::byteOperation(Operation operation, const Address& destination, Register source)
+        {
+            emitRex(false, source, destination);
+            emitByte(static_cast<byte>(operation) << 3);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::byteOperation(Operation operation, Register destination, byte value)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0x80);
+            emitOperand(static_cast<byte>(operation), destination);
+            emitByte(value);
+        }
+
+        void Emitter::byteOperation(Operation operation, const Address& destination, byte value)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0x80);
+            emitOperand(static_cast<byte>(operation), destination);
+            emitByte(value);
+        }
+
+        void Emitter::wordOperation(Operation operation, Register destination, Register source)
+        {
+            emitByte(0x66);
+            emitRex(false, source, destination);
+            emitByte((static_cast<byte>(operation) << 3) | 0x01);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::wordOperation(Operation operation, const Address& destination, std::int8_t value)
+        {
+            emitByte(0x66);
+            emitRex(false, RAX, destination);
+            emitByte(0x83);
+            emitOperand(static_cast<byte>(operation), destination);
+            emitByte(static_cast<byte>(value));
+        }
+
+        void Emitter::doubleOperation(Operation operation, Register destination, Register source)
+        {
+            emitRex(false, source, destination);
+            emitByte((static_cast<byte>(operation) << 3) | 0x01);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::doubleOperation(Operation operation, Register destination, std::int32_t value)
+        {
+            emitRex(false, RAX, destination);
+
+            if (value >= -128 && value <= 127)
+            {
+                emitByte(0x83);
+                emitOperand(static_cast<byte>(operation), destination);
+                emitByte(static_cast<byte>(value));
+            }
+            else
+            {
+                emitByte(0x81);
+                emitOperand(static_cast<byte>(operation), destination);
+                emitDouble(static_cast<std::uint32_t>(value));
+            }
+        }
+
+        void Emitter::quadOperation(Operation operation, Register destination, const Address& source)
+        {
+            emitRex(true, destination, source);
+            emitByte((static_cast<byte>(operation) << 3) | 0x03);
+            emitOperand(destination, source);
+        }
+
+        void Emitter::quadOperation(Operation operation, Register destination, std::int32_t value)
+        {
+            emitRex(true, RAX, destination);
+
+            if (value >= -128 && value <= 127)
+            {
+                emitByte(0x83);
+                emitOperand(static_cast<byte>(operation), destination);
+                emitByte(static_cast<byte>(value));
+            }
+            else
+            {
+                emitByte(0x81);
+                emitOperand(static_cast<byte>(operation), destination);
+                emitDouble(static_cast<std::uint32_t>(value));
+            }
+        }
+
+        void Emitter::shiftByte(Shift shift, Register destination)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0xD0);
+            emitOperand(static_cast<byte>(shift), destination);
+        }
+
+        void Emitter::shiftDouble(Shift shift, Register destination, byte count)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0xC1);
+            emitOperand(static_cast<byte>(shift), destination);
+            emitByte(count);
+        }
+
+        void Emitter::incrementByte(const Address& destination)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0xFE);
+            emitOperand(0, destination);
+        }
+
+        void Emitter::decrementByte(const Address& destination)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0xFE);
+            emitOperand(1, destination);
+        }
+
+        void Emitter::incrementWord(const Address& destination)
+        {
+            emitByte(0x66);
+            emitRex(false, RAX, destination);
+            emitByte(0xFF);
+            emitOperand(0, destination);
+        }
+
+        void Emitter::decrementWord(const Address& destination)
+        {
+            emitByte(0x66);
+            emitRex(false, RAX, destination);
+            emitByte(0xFF);
+            emitOperand(1, destination);
+        }
+
+        void Emitter::notByte(const Address& destination)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0xF6);
+            emitOperand(2, destination);
+        }
+
+        void Emitter::testByte(const Address& destination, byte value)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0xF6);
+            emitOperand(0, destination);
+            emitByte(value);
+        }
+
+        void Emitter::testDouble(Register destination, Register source)
+        {
+            emitRex(false, source, destination);
+            emitByte(0x85);
+            emitOperand(source, destination);
+        }
+
+        void Emitter::setCondition(Condition condition, Register destination)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0x0F);
+            emitByte(0x90 | static_cast<byte>(condition));
+            emitOperand(0, destination);
+        }
+
+        void Emitter::lahf()
+        {
+            emitByte(0x9F);
+        }
+
+        Emitter::Label Emitter::jump()
+        {
+            emitByte(0xE9);
+            Label label{size};
+            emitDouble(0);
+            return label;
+        }
+
+        Emitter::Label Emitter::jump(Condition condition)
+        {
+            emitByte(0x0F);
+            emitByte(0x80 | static_cast<byte>(condition));
+            Label label{size};
+            emitDouble(0);
+            return label;
+        }
+
+        void Emitter::bind(Label label)
+        {
+            std::uint32_t displacement = static_cast<std::uint32_t>(size - (label.position + 4));
+            byte* position = buffer.getData() + label.position;
+
+            for (int i = 0; i < 4; ++i)
+                position[i] = static_cast<byte>(displacement >> (8 * i));
+        }
+
+        void Emitter::jump(const void* target)
+        {
+            emitByte(0xE9);
+            emitRelative(target);
+        }
+
+        void Emitter::jump(Condition condition, const void* target)
+        {
+            emitByte(0x0F);
+            emitByte(0x80 | static_cast<byte>(condition));
+            emitRelative(target);
+        }
+
+        void Emitter::jump(Register target)
+        {
+            emitRex(false, RAX, target);
+            emitByte(0xFF);
+            emitOperand(4, target);
+        }
+
+        void Emitter::jump(const Address& target)
+        {
+            emitRex(false, RAX, target);
+            emitByte(0xFF);
+            emitOperand(4, target);
+        }
+
+        void Emitter::call(Register target)
+        {
+            emitRex(false, RAX, target);
+            emitByte(0xFF);
+            emitOperand(2, target);
+        }
+
+        void Emitter::push(Register source)
+        {
+            emitRex(false, RAX, source);
+            emitByte(0x50 + (source & 7));
+        }
+
+        void Emitter::pop(Register destination)
+        {
+            emitRex(false, RAX, destination);
+            emitByte(0x58 + (destination & 7));
+        }
+
+        void Emitter::ret()
+        {
+            emitByte(0xC3);
+        }
+
+        void Emitter::emitByte(byte value)
+        {
+            if (size == buffer.getSize())
+                throw EmulatorException("Code buffer is full in Emitter::emitByte.");
+
+            buffer.getData()[size++] = value;
+        }
+
+        void Emitter::emitWord(word value)
+        {
+            emitByte(static_cast<byte>(value));
+            emitByte(static_cast<byte>(value >> 8));
+        }
+
+        void Emitter::emitDouble(std::uint32_t value)
+        {
+            emitWord(static_cast<word>(value));
+            emitWord(static_cast<word>(value >> 16));
+        }
+
+        void Emitter::emitQuad(std::uint64_t value)
+        {
+            emitDouble(static_cast<std::uint32_t>(value));
+            emitDouble(static_cast<std::uint32_t>(value >> 32));
+        }
+
+        void Emitter::emitRex(bool wide, Register reg, const Address& address)
+        {
+            byte rex = 0x40 | (wide ? 0x08 : 0) | ((reg & 8) >> 1) |
+                (address.hasIndex ? (address.index & 8) >> 2 : 0) | ((address.base & 8) >> 3);
+
+            if (rex != 0x40)
+                emitByte(rex);
+        }
+
+        void Emitter::emitRex(bool wide, Register reg, Register destination)
+        {
+            byte rex = 0x40 | (wide ? 0x08 : 0) | ((reg & 8) >> 1) | ((destination & 8) >> 3);
+
+            if (rex != 0x40)
+                emitByte(rex);
+        }
+
+        void Emitter::emitOperand(byte reg, const Address& address)
+        {
+            byte base = address.base & 7;
+
+            // Without a displacement the base RBP (or R13) would denote an absolute address,
+            // hence those always get a displacement of one byte.
+            byte mod = 2;
+            if (address.displacement == 0 && base != RBP)
+                mod = 0;
+            else if (address.displacement >= -128 && address.displacement <= 127)
+                mod = 1;
+
+            if (address.hasIndex)
+            {
+                emitByte((mod << 6) | ((reg & 7) << 3) | 0x04);
+                emitByte((address.scale << 6) | ((address.index & 7) << 3) | base);
+            }
+            else if (base == RSP)
+            {
+                // The base RSP (or R12) can only be encoded with a SIB byte without an index.
+                emitByte((mod << 6) | ((reg & 7) << 3) | 0x04);
+                emitByte(0x24);
+            }
+            else
+                emitByte((mod << 6) | ((reg & 7) << 3) | base);
+
+            if (mod == 1)
+                emitByte(static_cast<byte>(address.displacement));
+            else if (mod == 2)
+                emitDouble(static_cast<std::uint32_t>(address.displacement));
+        }
+
+        void Emitter::emitOperand(byte reg, Register destination)
+        {
+            emitByte(0xC0 | ((reg & 7) << 3) | (destination & 7));
+        }
+
+        void Emitter::emitRelative(const void* target)
+        {
+            std::int64_t displacement = static_cast<const byte*>(target) - (getPosition() + 4);
+
+            if (displacement < INT32_MIN || displacement > INT32_MAX)
+                throw EmulatorException("Jump target out of range in Emitter::emitRelative.");
+
+            emitDouble(static_cast<std::uint32_t>(displacement));
+        }
+    } // namespace x64
+} // namespace emulator
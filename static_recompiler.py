@@ -0,0 +1,476 @@
+"""
+Static recompiler which translates the code of an intel 8080 ROM image ahead of time into a C++ source file
+for the RecompiledCpu (see headers/recompiled_cpu.hpp).
+
+Walks the code reachable from the entry points (the reset vector and the interrupt vectors) and emits
+one function per basic block. Jumps, calls and restarts of which the target is known are followed.
+Indirect jumps (RET and PCHL) and code which is not reached statically are left to the interpreter
+of the RecompiledCpu, which looks up the block at the new program counter.
+
+Usage:
+    python static_recompiler.py [rom] [output] [name] [entry points...]
+
+By default roms/invaders.rom is translated into src/spaceinvaders_recompiled.cpp as spaceInvadersProgram,
+with entry points 0x0000 (reset), 0x0008 (RST1) and 0x0010 (RST2).
+"""
+
+import re
+import sys
+
+opcode_info_path = "headers/opcode_info.hpp"
+
+default_rom_path = "roms/invaders.rom"
+default_output_path = "src/spaceinvaders_recompiled.cpp"
+default_program_name = "spaceInvadersProgram"
+default_entry_points = [0x0000, 0x0008, 0x0010]
+
+# Expressions for the registers, indexed as in the opcodes. Index 6 denotes the memory pointed at by HL.
+registers = ["s.B", "s.C", "s.D", "s.E", "s.H", "s.L", None, "s.A"]
+
+# Getters and setters of the register pairs, indexed by bits 4 and 5 of the opcode.
+pair_getters = ["s.getBC()", "s.getDE()", "s.getHL()", "s.SP"]
+pair_setters = ["s.setBC({})", "s.setDE({})", "s.setHL({})", "s.SP = {}"]
+
+# Conditions of the conditional jumps, calls and returns, indexed by bits 3 to 5 of the opcode.
+conditions = ["!s.getZ()", "s.getZ()", "!s.getCY()", "s.getCY()", "!s.getP()", "s.getP()", "!s.getS()", "s.getS()"]
+
+HLT = 0x76
+IN = 0xDB
+OUT = 0xD3
+
+# Read a table from opcode_info.hpp, such that the lengths and cycles are shared with the emulator.
+# Entries are either numbers or string literals.
+def read_table(source, name):
+    match = re.search(name + r"\[\] = \{(.*?)\};", source, re.DOTALL)
+    assert match, f"Table {name} not found in {opcode_info_path}"
+
+    entries = re.findall(r'"([^"]*)"|([0-9]+)', match[1])
+    entries = [int(number) if number else string for string, number in entries]
+    assert len(entries) == 256, f"Expected table {name} to have 256 entries"
+
+    return entries
+
+# Compute the hash with which RecompiledCpu::hashRom identifies the ROM (64 bit FNV-1a).
+def hash_rom(rom):
+    value = 0xCBF29CE484222325
+
+    for byte in rom:
+        value ^= byte
+        value = (value * 0x100000001B3) & 0xFFFFFFFFFFFFFFFF
+
+    return value
+
+def is_jump(opcode):
+    return opcode in (0xC3, 0xCB) or (opcode & 0xC7) == 0xC2
+
+def is_call(opcode):
+    return opcode in (0xCD, 0xDD, 0xED, 0xFD) or (opcode & 0xC7) == 0xC4
+
+def is_return(opcode):
+    return opcode in (0xC9, 0xD9) or (opcode & 0xC7) == 0xC0
+
+def is_restart(opcode):
+    return (opcode & 0xC7) == 0xC7
+
+def is_conditional(opcode):
+    return (opcode & 0xC7) in (0xC0, 0xC2, 0xC4)
+
+# Whether the instruction ends a basic block.
+def ends_block(opcode):
+    return is_jump(opcode) or is_call(opcode) or is_return(opcode) or is_restart(opcode) or opcode == 0xE9
+
+class Recompiler:
+    def __init__(self, rom, lengths, cycles, cycles_condition_not_met, nmemonics, arguments):
+        self.rom = rom
+        self.lengths = lengths
+        self.cycles = cycles
+        self.cycles_condition_not_met = cycles_condition_not_met
+        self.nmemonics = nmemonics
+        self.arguments = arguments
+
+        self.leaders = set()
+
+    # Whether the instruction at address can be translated. Instructions that do not lie entirely in the ROM
+    # are left to the interpreter, as is HLT, which has to return control to the machine.
+    def is_translatable(self, address):
+        return (address < len(self.rom) and address + self.lengths[self.rom[address]] <= len(self.rom)
+            and self.rom[address] != HLT)
+
+    def operand_byte(self, address):
+        return self.rom[address + 1]
+
+    def operand_word(self, address):
+        return self.rom[address + 1] | (self.rom[address + 2] << 8)
+
+    # Find the start addresses of all basic blocks reachable from the entry points.
+    def find_leaders(self, entry_points):
+        pending = list(entry_points)
+        visited = set()
+
+        while pending:
+            address = pending.pop()
+
+            if address in visited or not self.is_translatable(address):
+                continue
+
+            visited.add(address)
+            self.leaders.add(address)
+
+            while self.is_translatable(address):
+                opcode = self.rom[address]
+                next_address = address + self.lengths[opcode]
+
+                if is_jump(opcode) or is_call(opcode):
+                    pending.append(self.operand_word(address))
+                elif is_restart(opcode):
+                    pending.append(opcode & 0x38)
+
+                # The return address of calls and restarts is a leader, as is the instruction after
+                # a conditional instruction.
+                if is_call(opcode) or is_restart(opcode) or is_conditional(opcode):
+                    pending.append(next_address)
+
+                if ends_block(opcode):
+                    break
+
+                address = next_address
+
+    # Compute the number of machine cycles of the block starting at address if every condition is met.
+    def max_block_cycles(self, address):
+        cycles = 0
+
+        for instruction in self.block_instructions(address):
+            cycles += self.cycles[self.rom[instruction]]
+
+        return cycles
+
+    # The addresses of the instructions of the block starting at address.
+    def block_instructions(self, address):
+        instructions = []
+
+        while self.is_translatable(address):
+            instructions.append(address)
+            opcode = self.rom[address]
+            address += self.lengths[opcode]
+
+            if ends_block(opcode) or address in self.leaders:
+                break
+
+        return instructions
+
+    def describe(self, address):
+        opcode = self.rom[address]
+        argument = self.arguments[opcode]
+
+        if "wwww" in argument:
+            argument = argument.replace("wwww", f"{self.operand_word(address):04X}")
+        elif "bb" in argument:
+            argument = argument.replace("bb", f"{self.operand_byte(address):02X}")
+
+        return f"0x{address:04X}: {self.nmemonics[opcode]} {argument}".rstrip()
+
+    def function_name(self, address):
+        return f"block0x{address:04X}"
+
+    # Emit the statements which leave the block with the program counter set to target.
+    def emit_exit(self, target, instructions, cycles, indent):
+        return [
+            indent + f"context.executedInstructionCycles += {instructions};",
+            indent + f"context.executedMachineCycles += {cycles};",
+            indent + f"s.PC = {target};",
+            indent + "return;"
+        ]
+
+    # Emit the statements of an instruction which does not affect the control flow.
+    def emit_instruction(self, address):
+        opcode = self.rom[address]
+        destination = (opcode >> 3) & 0x07
+        source = opcode & 0x07
+        pair = (opcode >> 4) & 0x03
+
+        imm8 = f"0x{self.operand_byte(address):02X}" if self.lengths[opcode] >= 2 else None
+        imm16 = f"0x{self.operand_word(address):04X}" if self.lengths[opcode] == 3 else None
+
+        def read(register):
+            return registers[register] if register != 6 else "m.get<false>(s.getHL())"
+
+        # NOP and the undocumented opcodes which are treated as a NOP
+        if opcode in (0x00, 0x08, 0x10, 0x18, 0x20, 0x28, 0x30, 0x38):
+            return []
+
+        # MOV
+        if 0x40 <= opcode < 0x80:
+            if destination == 6:
+                return [f"m.set<false>(s.getHL(), {read(source)});"]
+            if destination == source:
+                return []
+            return [f"{registers[destination]} = {read(source)};"]
+
+        # ADD, ADC, SUB, SBB, ANA, XRA, ORA and CMP with a register, memory or an immediate
+        if 0x80 <= opcode < 0xC0 or (opcode & 0xC7) == 0xC6:
+            value = read(source) if opcode < 0xC0 else imm8
+            operation = destination
+            statements = [f"byte value = {value};"]
+
+            if operation in (0, 1, 2, 3):
+                setter = "setAddFlags" if operation < 2 else "setSubtractFlags"
+                carry = "s.getCY()" if operation in (1, 3) else "0"
+                sign = "+" if operation < 2 else "-"
+                statements += [
+                    f"byte carry = {carry};",
+                    f"s.{setter}(s.A, value, carry);",
+                    f"s.A {sign}= value + carry;"
+                ]
+            elif operation == 4:
+                statements += [
+                    "byte auxiliaryCarry = ((s.A | value) & 0x08) << 1;",
+                    "s.A &= value;",
+                    "s.setLogicFlags(s.A, auxiliaryCarry);"
+                ]
+            elif operation in (5, 6):
+                statements += [
+                    "s.A " + ("^" if operation == 5 else "|") + "= value;",
+                    "s.setLogicFlags(s.A, 0);"
+                ]
+            else:
+                statements += ["s.setSubtractFlags(s.A, value, 0);"]
+
+            return statements
+
+        # INR and DCR
+        if (opcode & 0xC6) == 0x04:
+            setter, operator = ("setDecrementFlags", "--") if opcode & 0x01 else ("setIncrementFlags", "++")
+
+            if destination == 6:
+                return [
+                    "word address = s.getHL();",
+                    "byte value = m.get<false>(address);",
+                    f"s.{setter}(value);",
+                    f"m.set<false>(address, {operator}value);"
+                ]
+
+            return [
+                f"s.{setter}({registers[destination]});",
+                f"{operator}{registers[destination]};"
+            ]
+
+        # MVI
+        if (opcode & 0xC7) == 0x06:
+            if destination == 6:
+                return [f"m.set<false>(s.getHL(), {imm8});"]
+            return [f"{registers[destination]} = {imm8};"]
+
+        # LXI
+        if (opcode & 0xCF) == 0x01:
+            return [pair_setters[pair].format(imm16) + ";"]
+
+        # INX and DCX
+        if (opcode & 0xC7) == 0x03:
+            change = "- 1" if opcode & 0x08 else "+ 1"
+            return [pair_setters[pair].format(f"{pair_getters[pair]} {change}") + ";"]
+
+        # DAD
+        if (opcode & 0xCF) == 0x09:
+            return [
+                f"word value = {pair_getters[pair]};",
+                "s.setCY(value > (0xFFFF - s.getHL()));",
+                "s.setHL(s.getHL() + value);"
+            ]
+
+        simple = {
+            0x02: ["m.set<false>(s.getBC(), s.A);"],
+            0x12: ["m.set<false>(s.getDE(), s.A);"],
+            0x0A: ["s.A = m.get<false>(s.getBC());"],
+            0x1A: ["s.A = m.get<false>(s.getDE());"],
+            0x22: [f"m.setWord<false>({imm16}, s.getHL());"],
+            0x2A: [f"s.setHL(m.getWord<false>({imm16}));"],
+            0x32: [f"m.set<false>({imm16}, s.A);"],
+            0x3A: [f"s.A = m.get<false>({imm16});"],
+            0x07: ["s.setCY((s.A & 0x80) != 0);", "s.A = (s.A << 1) | (s.A >> 7);"],
+            0x0F: ["s.setCY((s.A & 0x01) != 0);", "s.A = (s.A >> 1) | (s.A << 7);"],
+            0x17: ["byte carry = (s.A & 0x80) >> 7;", "s.A = (s.A << 1) | s.getCY();", "s.setCY(carry);"],
+            0x1F: ["byte carry = s.A & 0x01;", "s.A = (s.A >> 1) | (s.getCY() << 7);", "s.setCY(carry);"],
+            0x27: [
+                "const alu::DecimalAdjustment& adjustment = alu::decimalAdjustments[alu::decimalAdjustIndex(s.A, s.getCY(), s.getCA())];",
+                "s.A = adjustment.result;",
+                "s.unpackFlags(adjustment.flags);"
+            ],
+            0x2F: ["s.A = ~s.A;"],
+            0x37: ["s.setCY(true);"],
+            0x3F: ["s.setCY(!s.getCY());"],
+            0xC5: ["m.setWord<false>(s.SP - 2, s.getBC());", "s.SP -= 2;"],
+            0xD5: ["m.setWord<false>(s.SP - 2, s.getDE());", "s.SP -= 2;"],
+            0xE5: ["m.setWord<false>(s.SP - 2, s.getHL());", "s.SP -= 2;"],
+            0xF5: ["m.set<false>(s.SP - 1, s.A);", "m.set<false>(s.SP - 2, s.packFlags());", "s.SP -= 2;"],
+            0xC1: ["s.setBC(m.getWord<false>(s.SP));", "s.SP += 2;"],
+            0xD1: ["s.setDE(m.getWord<false>(s.SP));", "s.SP += 2;"],
+            0xE1: ["s.setHL(m.getWord<false>(s.SP));", "s.SP += 2;"],
+            0xF1: ["s.unpackFlags(m.get<false>(s.SP));", "s.A = m.get<false>(s.SP + 1);", "s.SP += 2;"],
+            0xE3: ["word value = m.getWord<false>(s.SP);", "m.setWord<false>(s.SP, s.getHL());", "s.setHL(value);"],
+            0xEB: ["word value = s.getHL();", "s.setHL(s.getDE());", "s.setDE(value);"],
+            0xF9: ["s.SP = s.getHL();"],
+            IN: [f"s.A = io.get({imm8});"],
+            OUT: [f"io.set({imm8}, s.A);"],
+            0xF3: ["s.interruptsEnabled = false;"],
+            0xFB: ["s.interruptsEnabled = true;"]
+        }
+
+        assert opcode in simple, f"Opcode 0x{opcode:02X} at 0x{address:04X} can not be translated"
+        return simple[opcode]
+
+    # Emit the function of the block starting at address.
+    def emit_block(self, address):
+        lines = []
+
+        instructions = 0
+        cycles = 0
+        indent = "        "
+        exited = False
+
+        # The machine cycles already added to the counter of the cpu, which the block adds as it goes
+        # before IN and OUT, such that the io sees the machine cycles executed before the instruction.
+        counted_cycles = 0
+
+        for instruction in self.block_instructions(address):
+            opcode = self.rom[instruction]
+            next_address = instruction + self.lengths[opcode]
+
+            previous_cycles = cycles
+            instructions += 1
+            cycles += self.cycles_condition_not_met[opcode]
+            met_cycles = cycles + self.cycles[opcode] - self.cycles_condition_not_met[opcode]
+
+            lines.append(indent + "// " + self.describe(instruction))
+
+            if is_conditional(opcode):
+                lines.append(indent + f"if ({conditions[(opcode >> 3) & 0x07]})")
+                lines.append(indent + "{")
+                inner = indent + "    "
+            else:
+                inner = indent
+
+            if is_jump(opcode):
+                lines += self.emit_exit(f"0x{self.operand_word(instruction):04X}", instructions, met_cycles - counted_cycles, inner)
+            elif is_call(opcode) or is_restart(opcode):
+                target = self.operand_word(instruction) if is_call(opcode) else opcode & 0x38
+                lines.append(inner + f"m.setWord<false>(s.SP - 2, 0x{next_address & 0xFFFF:04X});")
+                lines.append(inner + "s.SP -= 2;")
+                lines += self.emit_exit(f"0x{target:04X}", instructions, met_cycles - counted_cycles, inner)
+            elif is_return(opcode):
+                lines.append(inner + "word target = m.getWord<false>(s.SP);")
+                lines.append(inner + "s.SP += 2;")
+                lines += self.emit_exit("target", instructions, met_cycles - counted_cycles, inner)
+            elif opcode == 0xE9:
+                lines += self.emit_exit("s.getHL()", instructions, met_cycles - counted_cycles, inner)
+            else:
+                statements = self.emit_instruction(instruction)
+
+                if opcode in (IN, OUT) and previous_cycles > counted_cycles:
+                    statements = [f"context.executedMachineCycles += {previous_cycles - counted_cycles};"] + statements
+                    counted_cycles = previous_cycles
+
+                if statements:
+                    lines.append(indent + "{")
+                    lines += [indent + "    " + statement for statement in statements]
+                    lines.append(indent + "}")
+
+            if is_conditional(opcode):
+                lines.append(indent + "}")
+            elif ends_block(opcode):
+                exited = True
+
+            lines.append("")
+
+        if not exited:
+            lines += self.emit_exit(f"0x{next_address:04X}", instructions, cycles - counted_cycles, indent)
+        else:
+            lines.pop()
+
+        # The state is accessed in place. Copying it into a local costs more than it saves,
+        # since the flags are bit fields which would have to be unpacked and packed again.
+        header = [
+            f"    // {self.max_block_cycles(address)} machine cycles at most.",
+            f"    void {self.function_name(address)}(RecompiledCpu::Context& context)",
+            "    {",
+            "        CpuState& s = context.state;"
+        ]
+
+        body = "\n".join(lines)
+        if "m." in body:
+            header.append("        Memory& m = context.memory;")
+        if "io." in body:
+            header.append("        SpaceInvadersIO& io = context.io;")
+
+        return header + [""] + lines + ["    }"]
+
+    def generate(self, name, entry_points):
+        self.find_leaders(entry_points)
+        leaders = sorted(self.leaders)
+
+        lines = [
+            "// Generated by static_recompiler.py, do not edit.",
+            f"// {len(leaders)} basic blocks translated from a ROM of {len(self.rom)} bytes.",
+            "",
+            '#include "recompiled_cpu.hpp"',
+            '#include "spaceinvaders_io.hpp"',
+            '#include "alu_tables.hpp"',
+            "",
+            "namespace emulator",
+            "{",
+            "    namespace",
+            "    {"
+        ]
+
+        for leader in leaders:
+            lines += ["    " + line if line else line for line in self.emit_block(leader)]
+            lines.append("")
+
+        lines += [
+            "        const RecompiledCpu::Block blocks[] =",
+            "        {"
+        ]
+
+        for leader in leaders:
+            lines.append(f"            {{0x{leader:04X}, {self.max_block_cycles(leader)}, {self.function_name(leader)}}},")
+
+        lines[-1] = lines[-1].rstrip(",")
+
+        lines += [
+            "        };",
+            "    }",
+            "",
+            f"    const RecompiledCpu::Program {name} =",
+            "    {",
+            f"        0x{hash_rom(self.rom):016X}, {len(self.rom)}, blocks, sizeof(blocks) / sizeof(blocks[0])",
+            "    };",
+            "} // namespace emulator",
+            ""
+        ]
+
+        return "\n".join(lines)
+
+def main():
+    rom_path = sys.argv[1] if len(sys.argv) > 1 else default_rom_path
+    output_path = sys.argv[2] if len(sys.argv) > 2 else default_output_path
+    name = sys.argv[3] if len(sys.argv) > 3 else default_program_name
+    entry_points = [int(argument, 0) for argument in sys.argv[4:]] or default_entry_points
+
+    with open(opcode_info_path) as file:
+        source = file.read()
+
+    lengths = read_table(source, "instructionLengths")
+    cycles = read_table(source, "instructionCycles")
+    cycles_condition_not_met = read_table(source, "instructionCyclesConditionNotMet")
+    nmemonics = read_table(source, "nmemonics")
+    arguments = read_table(source, "arguments")
+
+    with open(rom_path, "rb") as file:
+        rom = file.read()
+
+    recompiler = Recompiler(rom, lengths, cycles, cycles_condition_not_met, nmemonics, arguments)
+
+    with open(output_path, "w") as file:
+        file.write(recompiler.generate(name, entry_points))
+
+if __name__ == "__main__":
+    main()